@@ -43,6 +43,10 @@ android {
     buildFeatures {
         prefab = true
     }
+    androidResources {
+        // .glb/.vkmodel은 AAsset_getBuffer로 APK에서 바로 매핑해 읽으므로 압축하지 않고 패키징
+        noCompress += listOf("glb", "vkmodel")
+    }
     externalNativeBuild {
         cmake {
             path = file("src/main/cpp/CMakeLists.txt")
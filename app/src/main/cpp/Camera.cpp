@@ -2,7 +2,7 @@
 #include <algorithm>
 #include "Log.h"
 
-Camera::Camera() : mVPMatrix(1.0f) {
+Camera::Camera() : mVPMatrix(1.0f), mPosition(0.0f), mFovY(glm::radians(45.0f)) {
     mYaw = glm::radians(45.0f);
     mPitch = glm::radians(30.0f);
     mRadius = 15.0f;
@@ -14,15 +14,17 @@ void Camera::update(float width, float height, VkSurfaceTransformFlagBitsKHR tra
     float camY = mRadius * sin(mPitch);
     float camZ = mRadius * cos(mPitch) * cos(mYaw);
 
+    mPosition = glm::vec3(camX, camY, camZ);
+
     // 2. 뷰 행렬
-    glm::mat4 view = glm::lookAt(glm::vec3(camX, camY, camZ),
+    glm::mat4 view = glm::lookAt(mPosition,
                                  glm::vec3(0.0f, 0.0f, 0.0f), // 원점을 바라봄
                                  glm::vec3(0.0f, 1.0f, 0.0f));
 
     // 3. 투영 행렬: 원근법 적용
     float aspect = width / height;
     glm::mat4 proj = glm::perspective(
-            glm::radians(45.0f), aspect, 0.1f, 100.0f); // 가시거리 0.1 ~ 100
+            mFovY, aspect, 0.1f, 100.0f); // 가시거리 0.1 ~ 100
 
     // 4. 기기 회전 보정
     glm::mat4 deviceRotation = calculateRotation(transform);
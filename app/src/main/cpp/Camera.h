@@ -17,11 +17,17 @@ public:
 
     // 최종 View-Projection 조합 행렬 반환 (Model 제외)
     glm::mat4 getViewProjectionMatrix() const { return mVPMatrix; }
+    // 월드 공간 카메라 위치 (백페이스 콘 컬링 등에 사용)
+    glm::vec3 getPosition() const { return mPosition; }
+    // 수직 시야각 (라디안), 화면 공간 오차 계산(LOD 선택)에 사용
+    float getFovY() const { return mFovY; }
 
     void rotate(float deltaYaw, float deltaPitch);
     void zoom(float delta);
 private:
     glm::mat4 mVPMatrix;
+    glm::vec3 mPosition;
+    float mFovY;
     float mYaw;   // 좌우 회전 (라디안)
     float mPitch; // 상하 회전 (라디안)
     float mRadius;
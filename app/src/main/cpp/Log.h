@@ -1,8 +1,11 @@
 #pragma once
 
+static const char* kTAG = "MyVulkan";
+
+#ifdef __ANDROID__
+
 #include <android/log.h>
 
-static const char* kTAG = "MyVulkan";
 #define LOGV(...) \
   ((void)__android_log_print(ANDROID_LOG_VERBOSE, kTAG, __VA_ARGS__))
 #define LOGD(...) \
@@ -13,3 +16,32 @@ static const char* kTAG = "MyVulkan";
   ((void)__android_log_print(ANDROID_LOG_WARN, kTAG, __VA_ARGS__))
 #define LOGE(...) \
   ((void)__android_log_print(ANDROID_LOG_ERROR, kTAG, __VA_ARGS__))
+
+#else
+
+// 호스트(데스크톱 Linux) 빌드: logcat 대신 stderr로 출력
+#include <cstdarg>
+#include <cstdio>
+
+static inline void hostLogPrint(char level, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "%c/%s: ", level, kTAG);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
+
+// 벤치마크 출력이 묻히지 않도록 VERBOSE/DEBUG는 MYGAME_VERBOSE_LOG일 때만 출력
+#ifdef MYGAME_VERBOSE_LOG
+#define LOGV(...) hostLogPrint('V', __VA_ARGS__)
+#define LOGD(...) hostLogPrint('D', __VA_ARGS__)
+#else
+#define LOGV(...) ((void)0)
+#define LOGD(...) ((void)0)
+#endif
+#define LOGI(...) hostLogPrint('I', __VA_ARGS__)
+#define LOGW(...) hostLogPrint('W', __VA_ARGS__)
+#define LOGE(...) hostLogPrint('E', __VA_ARGS__)
+
+#endif
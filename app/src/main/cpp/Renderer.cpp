@@ -6,8 +6,54 @@
 #include <array>
 #include <vector>
 #include <chrono>
+#include <cmath>
 
-Renderer::Renderer(struct android_app *app) : mApp(app) {
+Renderer::Renderer(struct android_app *app, VertexFormat vertexFormat) : mApp(app), mVertexFormat(vertexFormat) {
+}
+
+Renderer::Renderer(uint32_t width, uint32_t height, VertexFormat vertexFormat)
+        : mHeadlessExtent{width, height}, mVertexFormat(vertexFormat) {
+}
+
+AAssetManager* Renderer::getAssetManager() const {
+#ifdef __ANDROID__
+    if (mApp) return mApp->activity->assetManager;
+#endif
+    // 호스트 빌드는 AssetUtils의 에셋 루트 디렉터리에서 파일을 읽음
+    return nullptr;
+}
+
+VkExtent2D Renderer::getRenderExtent() const {
+    return isHeadless() ? mOffscreen->getExtent() : mSwapchain->getExtent();
+}
+
+VkFramebuffer Renderer::getFramebuffer(uint32_t imageIndex) const {
+    return isHeadless() ? mOffscreen->getFramebuffers()[imageIndex]
+                        : mSwapchain->getFramebuffers()[imageIndex];
+}
+
+VkSurfaceTransformFlagBitsKHR Renderer::getRenderTransform() const {
+    // 오프스크린 이미지는 기기 회전 보정이 필요 없음
+    return isHeadless() ? VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR : mSwapchain->getTransform();
+}
+
+bool Renderer::createRenderTarget() {
+    if (isHeadless()) {
+        mOffscreen = std::make_unique<VulkanOffscreenTarget>(
+                mContext.get(), mHeadlessExtent.width, mHeadlessExtent.height, MAX_FRAMES_IN_FLIGHT);
+        if (!mOffscreen->createImagesAndViews()) {
+            LOGE("Failed to initialize VulkanOffscreenTarget(Images and Views)");
+            return false;
+        }
+        return true;
+    }
+
+    mSwapchain = std::make_unique<VulkanSwapchain>(mContext.get());
+    if (!mSwapchain->createSwapchainAndViews()) {
+        LOGE("Failed to initialize VulkanSwapchain(Swapchain and Views)");
+        return false;
+    }
+    return true;
 }
 
 bool Renderer::initialize() {
@@ -23,21 +69,26 @@ bool Renderer::initialize() {
         return false;
     }
 
-    mSwapchain = std::make_unique<VulkanSwapchain>(mContext.get());
-    if (!mSwapchain->createSwapchainAndViews()) {
-        LOGE("Failed to initialize VulkanSwapchain(Swapchain and Views)");
-        return false;
-    }
+    if (!createRenderTarget()) return false;
 
     // 텍스처를 위해 DescriptorSetLayout을 생성할 때 Sampler 바인딩이 포함됨
-    mPipeline = std::make_unique<VulkanPipeline>(mContext->getDevice());
-    if (!mPipeline->initialize(mSwapchain->getImageFormat(),
-       mSwapchain->getDepthFormat(), mApp->activity->assetManager)) {
+    mPipeline = std::make_unique<VulkanPipeline>(mContext->getDevice(), mVertexFormat);
+    bool pipelineReady = isHeadless()
+            ? mPipeline->initialize(mOffscreen->getImageFormat(), mOffscreen->getDepthFormat(),
+                                    getAssetManager(), mOffscreen->getFinalLayout())
+            : mPipeline->initialize(mSwapchain->getImageFormat(), mSwapchain->getDepthFormat(),
+                                    getAssetManager());
+    if (!pipelineReady) {
         LOGE("Failed to initialize Vulkan Pipeline");
         return false;
     }
 
-    if (!mSwapchain->createFramebuffers(mPipeline->getRenderPass())) {
+    if (isHeadless()) {
+        if (!mOffscreen->createFramebuffers(mPipeline->getRenderPass())) {
+            LOGE("Failed to initialize VulkanOffscreenTarget(Framebuffers)");
+            return false;
+        }
+    } else if (!mSwapchain->createFramebuffers(mPipeline->getRenderPass())) {
         LOGE("Failed to initialize VulkanSwapchain(Framebuffers)");
         return false;
     }
@@ -57,20 +108,25 @@ bool Renderer::initialize() {
     }
 
     // 16. Uniform Buffers 생성
+    // UMA면 DEVICE_LOCAL 메모리를 직접 매핑해 사용 (GPU 읽기가 빠른 메모리에 CPU가 바로 기록)
+    VkMemoryPropertyFlags uniformRequiredFlags = mContext->isUnifiedMemory()
+            ? (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) : 0;
     mUniformBuffers.resize(MAX_FRAMES_IN_FLIGHT);
     for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
         mUniformBuffers[i] = std::make_unique<VulkanBuffer>(
                 mContext->getAllocator(), sizeof(UniformBufferObject),
                 VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-                VMA_MEMORY_USAGE_CPU_TO_GPU
+                VMA_MEMORY_USAGE_CPU_TO_GPU,
+                uniformRequiredFlags
         );
         mUniformBuffers[i]->map();
     }
 
     // 모델을 먼저 로드하여 텍스처를 확보한 뒤 디스크립터를 초기화합니다.
-    mModel = std::make_unique<VulkanModel>(mContext.get());
-    if (!mModel->loadFromFile(mApp->activity->assetManager, "glTF/AnimatedCube/AnimatedCube.gltf")) {
-        LOGE("Failed to load glTF model!");
+    mModel = std::make_unique<VulkanModel>(mContext.get(), true, mVertexFormat);
+    mModel->setLoadMemoryBudget(mLoadMemoryBudget);
+    if (!mModel->loadFromFile(getAssetManager(), mModelPath, MAX_FRAMES_IN_FLIGHT)) {
+        LOGE("Failed to load model: %s", mModelPath.c_str());
         return false;
     }
 
@@ -90,18 +146,28 @@ bool Renderer::initialize() {
 
 Renderer::~Renderer() {
     // Device 레벨 객체들 해제
+    waitIdle(); // 모든 작업(GPU)이 끝날 때까지 대기
+}
+
+void Renderer::waitIdle() {
     if (mContext && mContext->getDevice() != VK_NULL_HANDLE) {
-        vkDeviceWaitIdle(mContext->getDevice()); // 모든 작업(GPU)이 끝날 때까지 대기
+        vkDeviceWaitIdle(mContext->getDevice());
     }
 }
 
 void Renderer::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex) {
+    // 모프 타깃 -> GPU 스키닝 순서로 렌더패스 밖에서 먼저 실행 (출력 정점 버퍼를 이후 패스들이 그대로 사용)
+    if (mModel) {
+        mModel->recordMorphTargets(commandBuffer, mCurrentFrame);
+        mModel->recordSkinning(commandBuffer, mCurrentFrame);
+    }
+
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
     renderPassInfo.renderPass = mPipeline->getRenderPass();
-    renderPassInfo.framebuffer = mSwapchain->getFramebuffers()[imageIndex];
+    renderPassInfo.framebuffer = getFramebuffer(imageIndex);
     renderPassInfo.renderArea.offset = {0, 0};
-    renderPassInfo.renderArea.extent = mSwapchain->getExtent();
+    renderPassInfo.renderArea.extent = getRenderExtent();
 
     std::array<VkClearValue, 2> clearValues{};
     clearValues[0].color = {{0.2f, 0.2f, 0.2f, 1.0f}}; // 어두운 회색 클리어
@@ -118,28 +184,39 @@ void Renderer::recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t image
                             mPipeline->getPipelineLayout(), 0, 1, &set, 0, nullptr);
 
     // Dynamic State이므로 렌더링 시점에 뷰포트/시저 설정 필요
+    VkExtent2D extent = getRenderExtent();
     VkViewport viewport{};
     viewport.x = 0.0f;
-    viewport.y = (float)mSwapchain->getExtent().height;
-    viewport.width = (float)mSwapchain->getExtent().width;
-    viewport.height = -(float)mSwapchain->getExtent().height;
+    viewport.y = (float)extent.height;
+    viewport.width = (float)extent.width;
+    viewport.height = -(float)extent.height;
     viewport.minDepth = 0.0f;
     viewport.maxDepth = 1.0f;
     vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
 
     VkRect2D scissor{};
     scissor.offset = {0, 0};
-    scissor.extent = mSwapchain->getExtent();
+    scissor.extent = extent;
     vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
 
     if (mModel) {
-        mModel->draw(commandBuffer);
+        mModel->draw(commandBuffer, mPipeline->getPipelineLayout());
     }
 
     vkCmdEndRenderPass(commandBuffer);
 }
 
 void Renderer::render() {
+    // 모델 업로드 배치가 끝났으면 스테이징 버퍼 해제 (블로킹 없음)
+    if (mModel) {
+        mModel->pollUploadCompletion();
+    }
+
+    if (isHeadless()) {
+        renderHeadless();
+        return;
+    }
+
     if (mFramebufferResized) {
         LOGI("Buffer resized");
         mFramebufferResized = false;
@@ -219,6 +296,47 @@ void Renderer::render() {
     mCurrentFrame = (mCurrentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
 }
 
+void Renderer::renderHeadless() {
+    // 이전 프레임 작업이 끝날 때까지 대기
+    VkFence inFlightFence = mSync->getInFlightFence(mCurrentFrame);
+    vkWaitForFences(mContext->getDevice(), 1, &inFlightFence, VK_TRUE, UINT64_MAX);
+    vkResetFences(mContext->getDevice(), 1, &inFlightFence);
+
+    updateUniformBuffer(mCurrentFrame);
+
+    // 오프스크린 이미지는 프레임 인 플라이트마다 1장이므로 acquire 없이 프레임 인덱스를 그대로 사용
+    uint32_t imageIndex = mCurrentFrame;
+
+    mCommand->reset(mCurrentFrame);
+    mCommand->begin(mCurrentFrame, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+    recordCommandBuffer(mCommand->getBuffer(mCurrentFrame), imageIndex);
+    mCommand->end(mCurrentFrame);
+
+    // Present가 없으므로 세마포어 없이 펜스만 사용
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    VkCommandBuffer commandBuffer = mCommand->getBuffer(mCurrentFrame);
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &commandBuffer;
+
+    if (vkQueueSubmit(mContext->getGraphicsQueue(), 1,
+                      &submitInfo, inFlightFence) != VK_SUCCESS) {
+        LOGE("Failed to submit draw command buffer");
+    }
+
+    mLastRenderedImage = imageIndex;
+    mCurrentFrame = (mCurrentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+}
+
+bool Renderer::readLastFrame(std::vector<uint8_t>& outPixels) {
+    if (!isHeadless()) {
+        LOGE("readLastFrame is only supported in headless mode");
+        return false;
+    }
+    waitIdle();
+    return mOffscreen->readPixels(mLastRenderedImage, outPixels);
+}
+
 void Renderer::updateUniformBuffer(uint32_t currentImage) {
     // 1. 앱 시작 후 경과 시간 계산
     static auto startTime = std::chrono::steady_clock::now();
@@ -227,19 +345,34 @@ void Renderer::updateUniformBuffer(uint32_t currentImage) {
             currentTime - startTime).count();
 
     // 2. 카메라 업데이트 (VP 행렬 계산)
-    mCamera->update(static_cast<float>(mSwapchain->getExtent().width),
-                    static_cast<float>(mSwapchain->getExtent().height),
-                    mSwapchain->getTransform());
-
-    // 3. [핵심] 모델에게 현재 시간에 맞는 변환 행렬을 가져옴 -> 터치로 카메라 회전하도록 변경하여 주석처리.
-    // glm::mat4 modelMatrix = mModel->getAnimationTransform(time);
+    VkExtent2D extent = getRenderExtent();
+    mCamera->update(static_cast<float>(extent.width),
+                    static_cast<float>(extent.height),
+                    getRenderTransform());
 
+    // 3. 애니메이션은 노드 로컬 변환을 구동하므로 모델 행렬은 항등 (카메라는 터치로 회전)
     glm::mat4 modelMatrix = glm::mat4(1.0f);
 
     // 4. 최종 MVP 조합 (VP * M)
     UniformBufferObject ubo{};
     ubo.mvp = mCamera->getViewProjectionMatrix() * modelMatrix;
 
+    // 클러스터 컬링은 모델 공간에서 수행 (MVP로 평면 추출, 카메라 위치는 모델 공간으로 역변환)
+    // 애니메이션 LOD도 같은 뷰를 쓰므로 애니메이션 갱신 전에 설정
+    glm::vec3 cameraPositionModelSpace =
+            glm::vec3(glm::inverse(modelMatrix) * glm::vec4(mCamera->getPosition(), 1.0f));
+    float projectionScale = static_cast<float>(extent.height) / (2.0f * std::tan(mCamera->getFovY() * 0.5f));
+    mModel->setCullingView(ubo.mvp, cameraPositionModelSpace, projectionScale);
+
+    // 노드 계층: 애니메이션 샘플링 후 바뀐 서브트리의 월드 행렬만 갱신 (노드 행렬은 draw 시 push constant로 전달)
+    // 화면 밖/작게 보이는 객체는 애니메이션 LOD에 따라 몇 프레임에 한 번만 샘플링 (시간은 항상 time 기준)
+    mModel->updateAnimation(time - mLastAnimationTime);
+    mLastAnimationTime = time;
+    mModel->updateTransforms();
+    // 모프 가중치와 스킨 조인트 팔레트 (이번 프레임 인 플라이트 버퍼에 기록, 정점 변형은 GPU 컴퓨트에서)
+    mModel->updateMorphTargets(currentImage);
+    mModel->updateSkinning(currentImage);
+
     // 5. GPU 전송
     mUniformBuffers[currentImage]->copyTo(&ubo, sizeof(ubo));
 }
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "volk.h"
+#ifdef __ANDROID__
 #include <game-activity/native_app_glue/android_native_app_glue.h>
+#endif
+#include <string>
 #include <vector>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -13,41 +16,75 @@
 #include "VulkanDescriptor.h"
 #include "VulkanMesh.h"
 #include "VulkanModel.h"
+#include "VulkanOffscreenTarget.h"
 #include "VulkanPipeline.h"
 #include "VulkanSwapchain.h"
 #include "VulkanSync.h"
 
 class Renderer {
 public:
-    explicit Renderer(android_app* app);
+    // vertexFormat: 모델/파이프라인이 사용할 정점 레이아웃 (Compact = 16바이트 양자화 정점)
+    explicit Renderer(struct android_app* app, VertexFormat vertexFormat = VertexFormat::Standard);
+    // 헤드리스 모드: 스왑체인 없이 width x height 오프스크린 이미지에 렌더링
+    Renderer(uint32_t width, uint32_t height, VertexFormat vertexFormat = VertexFormat::Standard);
     virtual ~Renderer();
 
+    // 로드할 모델 (에셋 기준 경로, .gltf/.glb 또는 베이크한 .vkmodel). initialize 전에 설정
+    void setModelPath(const std::string& path) { mModelPath = path; }
+    // 모델 로드 중 CPU 측 임시 메모리 한도 (바이트, 0이면 한도 없음). initialize 전에 설정
+    void setLoadMemoryBudget(size_t bytes) { mLoadMemoryBudget = bytes; }
+
     bool initialize();
     void render();
     bool mFramebufferResized = false;
 
+    bool isHeadless() const { return mApp == nullptr; }
+    // 제출된 모든 프레임이 GPU에서 끝날 때까지 대기 (벤치마크 측정용)
+    void waitIdle();
+    // 헤드리스 모드에서 마지막으로 렌더링한 프레임을 RGBA8로 읽어옴
+    bool readLastFrame(std::vector<uint8_t>& outPixels);
+    VkExtent2D getRenderExtent() const;
+    // 마지막으로 기록한 프레임의 클러스터 컬링 통계
+    CullingStats getCullingStats() const { return mModel ? mModel->getCullingStats() : CullingStats{}; }
+    // 모델 로드의 메모리 사용량
+    LoadMemoryStats getLoadMemoryStats() const { return mModel ? mModel->getLoadMemoryStats() : LoadMemoryStats{}; }
+
     void handleTouchDrag(float dx, float dy);
     void handlePinchZoom(float delta);
 
 private:
-    android_app* mApp;
+    struct android_app* mApp = nullptr;
     std::unique_ptr<VulkanContext> mContext;
     std::unique_ptr<VulkanSwapchain> mSwapchain;
+    std::unique_ptr<VulkanOffscreenTarget> mOffscreen;
+    VkExtent2D mHeadlessExtent = {0, 0};
+    VertexFormat mVertexFormat = VertexFormat::Standard;
     std::unique_ptr<VulkanPipeline> mPipeline;
     std::unique_ptr<VulkanSync> mSync;
     std::unique_ptr<VulkanCommand> mCommand;
     std::unique_ptr<VulkanDescriptor> mDescriptor;
 
     std::unique_ptr<VulkanModel> mModel;
+    std::string mModelPath = "glTF/AnimatedCube/AnimatedCube.gltf";
+    size_t mLoadMemoryBudget = 0;
 
     std::unique_ptr<Camera> mCamera;
 
     uint32_t mCurrentFrame = 0;
+    uint32_t mLastRenderedImage = 0;
+    float mLastAnimationTime = 0.0f; // 애니메이션 delta 계산용 (앱 시작 후 경과 시간)
     const int MAX_FRAMES_IN_FLIGHT = 2;
 
     std::vector<std::unique_ptr<VulkanBuffer>> mUniformBuffers;
 
 private:
+    AAssetManager* getAssetManager() const;
+    VkFramebuffer getFramebuffer(uint32_t imageIndex) const;
+    VkSurfaceTransformFlagBitsKHR getRenderTransform() const;
+
+    bool createRenderTarget();
+    void renderHeadless();
+
     void recordCommandBuffer(VkCommandBuffer commandBuffer, uint32_t imageIndex);
 
     void updateUniformBuffer(uint32_t currentImage);
@@ -5,7 +5,8 @@
 VulkanBuffer::VulkanBuffer(VmaAllocator allocator,
                            VkDeviceSize size,
                            VkBufferUsageFlags usage,
-                           VmaMemoryUsage vmaUsage)
+                           VmaMemoryUsage vmaUsage,
+                           VkMemoryPropertyFlags requiredFlags)
         : mAllocator(allocator), mSize(size) {
     VkBufferCreateInfo bufferInfo{ VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
     bufferInfo.size = size;
@@ -15,11 +16,14 @@ VulkanBuffer::VulkanBuffer(VmaAllocator allocator,
     VmaAllocationCreateInfo allocInfo = {};
     allocInfo.usage = vmaUsage;
     allocInfo.flags = 0; // 명시적 0 초기화 (VMA 버전이나 컴파일러에 따라서 쓰레기 값 가능성 제거)
+    allocInfo.requiredFlags = requiredFlags;
 
     // 버퍼 생성과 메모리 할당을 한 번에 처리
     if (vmaCreateBuffer(mAllocator, &bufferInfo, &allocInfo, &mBuffer,
                         &mAllocation, nullptr) != VK_SUCCESS) {
         LOGE("Failed to create buffer using VMA");
+        mBuffer = VK_NULL_HANDLE;
+        mAllocation = VK_NULL_HANDLE;
     }
 }
 
@@ -49,14 +53,34 @@ void VulkanBuffer::unmap() {
     }
 }
 
-void VulkanBuffer::copyTo(const void* data, VkDeviceSize size) {
+void VulkanBuffer::invalidate() {
+    if (vmaInvalidateAllocation(mAllocator, mAllocation, 0, VK_WHOLE_SIZE) != VK_SUCCESS) {
+        LOGE("Failed to invalidate VMA allocation");
+    }
+}
+
+void VulkanBuffer::flush() {
+    if (vmaFlushAllocation(mAllocator, mAllocation, 0, VK_WHOLE_SIZE) != VK_SUCCESS) {
+        LOGE("Failed to flush VMA allocation");
+    }
+}
+
+bool VulkanBuffer::isHostVisible() const {
+    if (mAllocation == VK_NULL_HANDLE) return false;
+    VkMemoryPropertyFlags flags = 0;
+    vmaGetAllocationMemoryProperties(mAllocator, mAllocation, &flags);
+    return (flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+}
+
+void VulkanBuffer::copyTo(const void* data, VkDeviceSize size, VkDeviceSize offset) {
     if (data == nullptr) {
         LOGE("VulkanBuffer::copyTo received null data");
         return;
     }
-    if (size > mSize) {
-        LOGE("VulkanBuffer::copyTo overflow (requested=%llu, capacity=%llu)",
+    if (offset > mSize || size > mSize - offset) {
+        LOGE("VulkanBuffer::copyTo overflow (requested=%llu at %llu, capacity=%llu)",
              static_cast<unsigned long long>(size),
+             static_cast<unsigned long long>(offset),
              static_cast<unsigned long long>(mSize));
         return;
     }
@@ -65,8 +89,8 @@ void VulkanBuffer::copyTo(const void* data, VkDeviceSize size) {
     void* target = alreadyMapped ? mMappedData : map();
 
     if (target != nullptr) {
-        memcpy(target, data, static_cast<size_t>(size));
-        if (size > 0 && vmaFlushAllocation(mAllocator, mAllocation, 0, size) != VK_SUCCESS) {
+        memcpy(static_cast<uint8_t*>(target) + offset, data, static_cast<size_t>(size));
+        if (size > 0 && vmaFlushAllocation(mAllocator, mAllocation, offset, size) != VK_SUCCESS) {
             LOGE("Failed to flush VMA allocation");
         }
         if (!alreadyMapped) unmap();
@@ -5,10 +5,12 @@
 
 class VulkanBuffer {
 public:
+    // requiredFlags: 반드시 만족해야 하는 메모리 속성 (예: UMA에서 DEVICE_LOCAL | HOST_VISIBLE)
     VulkanBuffer(VmaAllocator allocator,
                  VkDeviceSize size,
                  VkBufferUsageFlags usage,
-                 VmaMemoryUsage vmaUsage);
+                 VmaMemoryUsage vmaUsage,
+                 VkMemoryPropertyFlags requiredFlags = 0);
     ~VulkanBuffer();
 
     // 복사 방지 (Vulkan 자원 중복 해제 방지)
@@ -17,10 +19,18 @@ public:
 
     VkBuffer getBuffer() const { return mBuffer; }
     VkDeviceSize getSize() const { return mSize; }
+    bool isValid() const { return mBuffer != VK_NULL_HANDLE; }
+    // CPU가 매핑해 직접 쓸 수 있는 메모리인지 (UMA 직접 할당, 스테이징 등)
+    bool isHostVisible() const;
 
-    void copyTo(const void* data, VkDeviceSize size);
+    // offset 위치부터 size 바이트를 기록 (매핑 가능한 메모리만)
+    void copyTo(const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
     void* map();
     void unmap();
+    // GPU가 쓴 데이터를 CPU에서 읽기 전 호출 (non-coherent 메모리 대비)
+    void invalidate();
+    // 매핑된 메모리에 CPU가 직접 쓴 데이터를 GPU에 가시화 (non-coherent 메모리 대비)
+    void flush();
 
 private:
     VmaAllocator mAllocator;
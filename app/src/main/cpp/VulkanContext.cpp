@@ -6,16 +6,27 @@
 #include "VulkanContext.h"
 #include "Log.h"
 
+#include <algorithm>
+#include <cstring>
+
 VulkanContext::VulkanContext(struct android_app* app) : mApp(app) {
 }
 
 VulkanContext::~VulkanContext() {
+    // VMA 할당자보다 먼저 해제
+    mStagingRing.reset();
     if (mAllocator != VK_NULL_HANDLE) {
         vmaDestroyAllocator(mAllocator);
     }
     if (mTransferCommandPool != VK_NULL_HANDLE) {
         vkDestroyCommandPool(mDevice, mTransferCommandPool, nullptr);
     }
+    if (mGraphicsTransientCommandPool != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(mDevice, mGraphicsTransientCommandPool, nullptr);
+    }
+    if (mUploadTimeline != VK_NULL_HANDLE) {
+        vkDestroySemaphore(mDevice, mUploadTimeline, nullptr);
+    }
     if (mDevice != VK_NULL_HANDLE) {
         vkDestroyDevice(mDevice, nullptr);
     }
@@ -29,12 +40,53 @@ VulkanContext::~VulkanContext() {
 
 bool VulkanContext::initialize() {
     if (!createInstance()) return false;
-    if (!createSurface()) return false;
+    if (!isHeadless() && !createSurface()) return false;
     if (!selectPhysicalDevice()) return false;
     if (!createLogicalDevice()) return false;
     if (!createTransferCommandPool()) return false;
+    if (!createUploadTimeline()) return false;
     if (!createAllocator()) return false;
+    if (!createStagingRing()) return false;
+    detectUnifiedMemory();
+
+    return true;
+}
+
+void VulkanContext::detectUnifiedMemory() {
+    VkPhysicalDeviceMemoryProperties memProps;
+    vkGetPhysicalDeviceMemoryProperties(mPhysicalDevice, &memProps);
+
+    // 가장 큰 DEVICE_LOCAL 힙 크기
+    VkDeviceSize largestDeviceLocalHeap = 0;
+    for (uint32_t i = 0; i < memProps.memoryHeapCount; i++) {
+        if (memProps.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+            largestDeviceLocalHeap = std::max(largestDeviceLocalHeap, memProps.memoryHeaps[i].size);
+        }
+    }
+
+    // DEVICE_LOCAL | HOST_VISIBLE 메모리 타입이 주 힙에 있어야 UMA로 판단
+    // (외장 GPU의 작은 BAR 윈도우(256MB)는 제외)
+    const VkMemoryPropertyFlags directFlags =
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    mUnifiedMemory = false;
+    for (uint32_t i = 0; i < memProps.memoryTypeCount; i++) {
+        const VkMemoryType& type = memProps.memoryTypes[i];
+        if ((type.propertyFlags & directFlags) == directFlags &&
+            memProps.memoryHeaps[type.heapIndex].size >= largestDeviceLocalHeap) {
+            mUnifiedMemory = true;
+            break;
+        }
+    }
 
+    LOGI("Unified memory (UMA): %s", mUnifiedMemory ? "yes, direct uploads enabled" : "no, using staging uploads");
+}
+
+bool VulkanContext::createStagingRing() {
+    mStagingRing = std::make_unique<VulkanStagingRing>(mAllocator, kStagingRingSize);
+    if (!mStagingRing->initialize()) {
+        LOGE("Failed to create staging ring");
+        return false;
+    }
     return true;
 }
 
@@ -85,16 +137,20 @@ bool VulkanContext::createInstance() {
     appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
     appInfo.apiVersion = VK_API_VERSION_1_1;
 
-    const char* extensions[] = {
-            VK_KHR_SURFACE_EXTENSION_NAME,
-            VK_KHR_ANDROID_SURFACE_EXTENSION_NAME
-    };
+    // 헤드리스 모드에서는 서피스 관련 인스턴스 확장이 필요 없음
+    std::vector<const char*> extensions;
+#ifdef __ANDROID__
+    if (!isHeadless()) {
+        extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+        extensions.push_back(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME);
+    }
+#endif
 
     VkInstanceCreateInfo createInfo = {};
     createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
     createInfo.pApplicationInfo = &appInfo;
-    createInfo.enabledExtensionCount = 2;
-    createInfo.ppEnabledExtensionNames = extensions;
+    createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    createInfo.ppEnabledExtensionNames = extensions.data();
 
     if (vkCreateInstance(&createInfo, nullptr, &mInstance) != VK_SUCCESS) {
         LOGE("Failed to create vkInstance");
@@ -106,6 +162,7 @@ bool VulkanContext::createInstance() {
 }
 
 bool VulkanContext::createSurface() {
+#ifdef __ANDROID__
     VkAndroidSurfaceCreateInfoKHR surfaceCreateInfo = {};
     surfaceCreateInfo.sType = VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR;
     surfaceCreateInfo.window = mApp->window;
@@ -114,6 +171,10 @@ bool VulkanContext::createSurface() {
         return false;
     }
     return true;
+#else
+    LOGE("Window surface is not supported on host builds (use headless mode)");
+    return false;
+#endif
 }
 
 bool VulkanContext::selectPhysicalDevice() {
@@ -164,25 +225,100 @@ bool VulkanContext::selectPhysicalDevice() {
         }
     }
 
+    // 업로드용 큐 패밀리: 1순위 전송 전용(DMA 엔진), 2순위 비동기 컴퓨트 (컴퓨트 큐는 전송도 지원)
+    // 타임라인 세마포어가 없으면 그래픽스 큐와 동기화할 수 없으므로 그래픽스 큐를 공유
+    // 확장이 노출돼도 기능 비트가 꺼져 있을 수 있으므로 timelineSemaphore 기능까지 확인
+    mTimelineSemaphoreSupported = false;
+    VkPhysicalDeviceProperties deviceProps;
+    vkGetPhysicalDeviceProperties(mPhysicalDevice, &deviceProps);
+    if (isDeviceExtensionSupported(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME) &&
+        deviceProps.apiVersion >= VK_API_VERSION_1_1 && vkGetPhysicalDeviceFeatures2 != nullptr) {
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineFeatures = {
+                VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR };
+        VkPhysicalDeviceFeatures2 features2 = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2 };
+        features2.pNext = &timelineFeatures;
+        vkGetPhysicalDeviceFeatures2(mPhysicalDevice, &features2);
+        mTimelineSemaphoreSupported = timelineFeatures.timelineSemaphore == VK_TRUE;
+    }
+    LOGV("Timeline semaphore: %s", mTimelineSemaphoreSupported ? "supported" : "unsupported");
+    mTransferQueueFamilyIndex = mGraphicsQueueFamilyIndex;
+    if (mTimelineSemaphoreSupported) {
+        int transferOnly = -1;
+        int asyncCompute = -1;
+        for (uint32_t i = 0; i < queueFamilyCount; i++) {
+            VkQueueFlags flags = queueFamilies[i].queueFlags;
+            if (flags & VK_QUEUE_GRAPHICS_BIT) continue;
+            if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & VK_QUEUE_COMPUTE_BIT) && transferOnly < 0) {
+                transferOnly = static_cast<int>(i);
+            } else if ((flags & VK_QUEUE_COMPUTE_BIT) && asyncCompute < 0) {
+                asyncCompute = static_cast<int>(i);
+            }
+        }
+        if (transferOnly >= 0) {
+            mTransferQueueFamilyIndex = static_cast<uint32_t>(transferOnly);
+        } else if (asyncCompute >= 0) {
+            mTransferQueueFamilyIndex = static_cast<uint32_t>(asyncCompute);
+        }
+    }
+    mTransferImageGranularity = queueFamilies[mTransferQueueFamilyIndex].minImageTransferGranularity;
+    LOGI("Queue families: graphics=%u, upload=%u (%s)", mGraphicsQueueFamilyIndex, mTransferQueueFamilyIndex,
+         hasDedicatedTransferQueue() ? "dedicated" : "shared with graphics");
+    LOGV("Upload queue image transfer granularity: %ux%ux%u", mTransferImageGranularity.width,
+         mTransferImageGranularity.height, mTransferImageGranularity.depth);
+
     return true;
 }
 
+bool VulkanContext::isDeviceExtensionSupported(const char* extensionName) const {
+    uint32_t extensionCount = 0;
+    vkEnumerateDeviceExtensionProperties(mPhysicalDevice, nullptr, &extensionCount, nullptr);
+    std::vector<VkExtensionProperties> extensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(mPhysicalDevice, nullptr, &extensionCount, extensions.data());
+    for (const auto& extension : extensions) {
+        if (strcmp(extension.extensionName, extensionName) == 0) return true;
+    }
+    return false;
+}
+
 bool VulkanContext::createLogicalDevice() {
     float queuePriority = 1.0f;
+    std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
+
     VkDeviceQueueCreateInfo queueCreateInfo = {};
     queueCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
     queueCreateInfo.queueFamilyIndex = mGraphicsQueueFamilyIndex;
     queueCreateInfo.queueCount = 1;
     queueCreateInfo.pQueuePriorities = &queuePriority;
+    queueCreateInfos.push_back(queueCreateInfo);
+
+    // 전송 전용 큐 (그래픽스보다 낮은 우선순위로 백그라운드 스트리밍)
+    float transferQueuePriority = 0.5f;
+    if (hasDedicatedTransferQueue()) {
+        queueCreateInfo.queueFamilyIndex = mTransferQueueFamilyIndex;
+        queueCreateInfo.pQueuePriorities = &transferQueuePriority;
+        queueCreateInfos.push_back(queueCreateInfo);
+    }
+
+    std::vector<const char*> deviceExtensions;
+    if (!isHeadless()) {
+        deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
 
-    const char* deviceExtensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+    // selectPhysicalDevice에서 기능 지원을 확인한 경우에만 확장과 기능을 함께 활성화
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineFeatures = {
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR };
+    timelineFeatures.timelineSemaphore = VK_TRUE;
+    if (mTimelineSemaphoreSupported) {
+        deviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    }
 
     VkDeviceCreateInfo deviceCreateInfo = {};
     deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-    deviceCreateInfo.queueCreateInfoCount = 1;
-    deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
-    deviceCreateInfo.enabledExtensionCount = 1;
-    deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions;
+    deviceCreateInfo.pNext = mTimelineSemaphoreSupported ? &timelineFeatures : nullptr;
+    deviceCreateInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
+    deviceCreateInfo.pQueueCreateInfos = queueCreateInfos.data();
+    deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
+    deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
     if (vkCreateDevice(mPhysicalDevice, &deviceCreateInfo, nullptr, &mDevice) != VK_SUCCESS) {
         LOGE("Failed to create Logical Device");
@@ -190,21 +326,42 @@ bool VulkanContext::createLogicalDevice() {
     }
     volkLoadDevice(mDevice);
     vkGetDeviceQueue(mDevice, mGraphicsQueueFamilyIndex, 0, &mGraphicsQueue);
+    vkGetDeviceQueue(mDevice, mTransferQueueFamilyIndex, 0, &mTransferQueue);
     return true;
 }
 
 bool VulkanContext::createTransferCommandPool() {
     VkCommandPoolCreateInfo poolInfo = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
-    poolInfo.queueFamilyIndex = mGraphicsQueueFamilyIndex;
+    poolInfo.queueFamilyIndex = mTransferQueueFamilyIndex;
     // 짧은 수명의 커맨드 버퍼를 위한 플래그 설정
     poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-    return vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mTransferCommandPool) == VK_SUCCESS;
+    if (vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mTransferCommandPool) != VK_SUCCESS) return false;
+
+    // 그래픽스 큐에 제출하는 짧은 수명의 커맨드 버퍼용 (소유권 획득, 리드백)
+    poolInfo.queueFamilyIndex = mGraphicsQueueFamilyIndex;
+    return vkCreateCommandPool(mDevice, &poolInfo, nullptr, &mGraphicsTransientCommandPool) == VK_SUCCESS;
+}
+
+bool VulkanContext::createUploadTimeline() {
+    if (!mTimelineSemaphoreSupported) return true;
+
+    VkSemaphoreTypeCreateInfoKHR typeInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR };
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    typeInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo semaphoreInfo = { VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+    semaphoreInfo.pNext = &typeInfo;
+    if (vkCreateSemaphore(mDevice, &semaphoreInfo, nullptr, &mUploadTimeline) != VK_SUCCESS) {
+        LOGE("Failed to create upload timeline semaphore");
+        return false;
+    }
+    return true;
 }
 
 VkCommandBuffer VulkanContext::beginSingleTimeCommands() {
     VkCommandBufferAllocateInfo allocInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
     allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    allocInfo.commandPool = mTransferCommandPool;
+    allocInfo.commandPool = mGraphicsTransientCommandPool;
     allocInfo.commandBufferCount = 1;
 
     VkCommandBuffer commandBuffer;
@@ -228,16 +385,29 @@ void VulkanContext::endSingleTimeCommands(VkCommandBuffer commandBuffer) {
     vkQueueSubmit(mGraphicsQueue, 1, &submitInfo, VK_NULL_HANDLE);
     vkQueueWaitIdle(mGraphicsQueue);
 
-    vkFreeCommandBuffers(mDevice, mTransferCommandPool, 1, &commandBuffer);
+    vkFreeCommandBuffers(mDevice, mGraphicsTransientCommandPool, 1, &commandBuffer);
 }
 
-void VulkanContext::copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
+VkFormat VulkanContext::findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features) {
+    for (VkFormat format : candidates) {
+        VkFormatProperties props;
+        vkGetPhysicalDeviceFormatProperties(mPhysicalDevice, format, &props);
 
-    VkBufferCopy copyRegion = { 0, 0, size };
-    vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+        if (tiling == VK_IMAGE_TILING_LINEAR && (props.linearTilingFeatures & features) == features) {
+            return format;
+        } else if (tiling == VK_IMAGE_TILING_OPTIMAL && (props.optimalTilingFeatures & features) == features) {
+            return format;
+        }
+    }
+    return VK_FORMAT_D32_SFLOAT;
+}
 
-    endSingleTimeCommands(commandBuffer);
+VkFormat VulkanContext::findDepthFormat() {
+    return findSupportedFormat(
+            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+            VK_IMAGE_TILING_OPTIMAL,
+            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
+    );
 }
 
 void VulkanContext::createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
@@ -267,60 +437,3 @@ void VulkanContext::createImage(uint32_t width, uint32_t height, VkFormat format
         return;
     }
 }
-
-void VulkanContext::transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
-
-    VkImageMemoryBarrier barrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-    barrier.oldLayout = oldLayout;
-    barrier.newLayout = newLayout;
-    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-    barrier.image = image;
-    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    barrier.subresourceRange.baseMipLevel = 0;
-    barrier.subresourceRange.levelCount = 1;
-    barrier.subresourceRange.baseArrayLayer = 0;
-    barrier.subresourceRange.layerCount = 1;
-
-    VkPipelineStageFlags sourceStage;
-    VkPipelineStageFlags destinationStage;
-
-    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
-        barrier.srcAccessMask = 0;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-        destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-    } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-        sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-        destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-    } else {
-        LOGE("Unsupported layout transition");
-        return;
-    }
-
-    vkCmdPipelineBarrier(commandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
-
-    endSingleTimeCommands(commandBuffer);
-}
-
-void VulkanContext::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height) {
-    VkCommandBuffer commandBuffer = beginSingleTimeCommands();
-
-    VkBufferImageCopy region = {};
-    region.bufferOffset = 0;
-    region.bufferRowLength = 0;
-    region.bufferImageHeight = 0;
-    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-    region.imageSubresource.mipLevel = 0;
-    region.imageSubresource.baseArrayLayer = 0;
-    region.imageSubresource.layerCount = 1;
-    region.imageOffset = {0, 0, 0};
-    region.imageExtent = {width, height, 1};
-
-    vkCmdCopyBufferToImage(commandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
-
-    endSingleTimeCommands(commandBuffer);
-}
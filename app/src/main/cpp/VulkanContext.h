@@ -2,12 +2,17 @@
 
 #include "volk.h"
 #include "vk_mem_alloc.h"
+#include "VulkanStagingRing.h"
 
+#ifdef __ANDROID__
 #include <game-activity/native_app_glue/android_native_app_glue.h>
+#endif
+#include <memory>
 #include <vector>
 
 class VulkanContext {
 public:
+    // app이 nullptr이면 헤드리스 모드: 서피스와 스왑체인 확장 없이 초기화
     explicit VulkanContext(struct android_app* app);
     ~VulkanContext();
 
@@ -17,6 +22,8 @@ public:
 
     bool initialize();
 
+    bool isHeadless() const { return mApp == nullptr; }
+
     VkInstance getInstance() const { return mInstance; }
     VkSurfaceKHR getSurface() const { return mSurface; }
     VkPhysicalDevice getPhysicalDevice() const { return mPhysicalDevice; }
@@ -24,22 +31,45 @@ public:
     VkQueue getGraphicsQueue() const { return mGraphicsQueue; }
     uint32_t getGraphicsQueueFamilyIndex() const { return mGraphicsQueueFamilyIndex; }
 
+    // 업로드 전용 큐: 전송 전용(DMA) 또는 비동기 컴퓨트 패밀리가 있고 타임라인 세마포어를 지원하면
+    // 그래픽스와 다른 큐를 사용하며, 없으면 그래픽스 큐를 그대로 반환
+    VkQueue getTransferQueue() const { return mTransferQueue; }
+    uint32_t getTransferQueueFamilyIndex() const { return mTransferQueueFamilyIndex; }
+    bool hasDedicatedTransferQueue() const { return mTransferQueueFamilyIndex != mGraphicsQueueFamilyIndex; }
+    // 업로드 큐 패밀리의 minImageTransferGranularity. 그래픽스/컴퓨트 패밀리는 항상 (1,1,1)이지만
+    // 전송 전용 패밀리는 더 클 수 있고, (0,0,0)이면 밉 레벨 전체 복사만 허용됨
+    VkExtent3D getTransferImageGranularity() const { return mTransferImageGranularity; }
+
+    // 업로드 완료를 알리는 타임라인 세마포어 (전송 큐가 signal, 그래픽스 큐가 wait)
+    VkSemaphore getUploadTimelineSemaphore() const { return mUploadTimeline; }
+    uint64_t acquireNextUploadTimelineValue() { return ++mUploadTimelineValue; }
+
     // VMA
     VmaAllocator getAllocator() const { return mAllocator; }
 
+    // UMA(통합 메모리) 여부: 주 DEVICE_LOCAL 힙을 CPU가 직접 매핑할 수 있으면 true
+    // true이면 정점/인덱스/유니폼 데이터를 스테이징 없이 GPU 메모리에 직접 기록
+    bool isUnifiedMemory() const { return mUnifiedMemory; }
+
+    // Format Utils
+    VkFormat findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
+    VkFormat findDepthFormat();
+
+    // 업로드용 커맨드 풀과 스테이징 링 (VulkanUploadBatch가 사용)
+    // transfer 풀은 전송 큐 패밀리, graphics 풀은 그래픽스 큐 패밀리 (소유권 획득/즉시 실행용)
+    VkCommandPool getTransferCommandPool() const { return mTransferCommandPool; }
+    VkCommandPool getGraphicsTransientCommandPool() const { return mGraphicsTransientCommandPool; }
+    VulkanStagingRing* getStagingRing() const { return mStagingRing.get(); }
+
     // Utilities
+    // 즉시 실행 후 대기가 필요한 경우(리드백 등)에만 사용. 에셋 업로드는 VulkanUploadBatch 사용
     VkCommandBuffer beginSingleTimeCommands();
     void endSingleTimeCommands(VkCommandBuffer commandBuffer);
-    
-    // Buffer Utils
-    void copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
-    
+
     // Image Utils
     void createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling,
                      VkImageUsageFlags usage, VmaMemoryUsage vmaUsage,
                      VkImage& image, VmaAllocation& allocation);
-    void transitionImageLayout(VkImage image, VkFormat format, VkImageLayout oldLayout, VkImageLayout newLayout);
-    void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height);
 
 private:
     struct android_app* mApp;
@@ -50,18 +80,37 @@ private:
     VkDevice mDevice = VK_NULL_HANDLE;
     VkQueue mGraphicsQueue = VK_NULL_HANDLE;
     uint32_t mGraphicsQueueFamilyIndex = 0;
+    VkQueue mTransferQueue = VK_NULL_HANDLE;
+    uint32_t mTransferQueueFamilyIndex = 0;
+    VkExtent3D mTransferImageGranularity = { 1, 1, 1 };
 
     VkCommandPool mTransferCommandPool = VK_NULL_HANDLE;
+    VkCommandPool mGraphicsTransientCommandPool = VK_NULL_HANDLE;
+
+    // VK_KHR_timeline_semaphore
+    bool mTimelineSemaphoreSupported = false;
+    VkSemaphore mUploadTimeline = VK_NULL_HANDLE;
+    uint64_t mUploadTimelineValue = 0;
 
     // VMA
     VmaAllocator mAllocator = VK_NULL_HANDLE;
 
+    bool mUnifiedMemory = false;
+
+    // 모든 업로드가 공유하는 스테이징 메모리 (한 번만 할당)
+    static constexpr VkDeviceSize kStagingRingSize = 16 * 1024 * 1024;
+    std::unique_ptr<VulkanStagingRing> mStagingRing;
+
     bool createInstance();
     bool createSurface();
     bool selectPhysicalDevice();
     bool createLogicalDevice();
     bool createTransferCommandPool();
-    
+    bool createUploadTimeline();
+    bool isDeviceExtensionSupported(const char* extensionName) const;
+
     // VMA
     bool createAllocator();
+    bool createStagingRing();
+    void detectUnifiedMemory();
 };
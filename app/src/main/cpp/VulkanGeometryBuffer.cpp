@@ -0,0 +1,271 @@
+#include "VulkanGeometryBuffer.h"
+#include "Log.h"
+#include "vertex_quantization.h"
+
+#include <algorithm>
+#include <numeric>
+
+VulkanGeometryBuffer::VulkanGeometryBuffer(VertexFormat vertexFormat) : mVertexFormat(vertexFormat) {
+}
+
+VulkanGeometryBuffer::Range VulkanGeometryBuffer::append(const std::vector<Vertex>& vertices,
+                                                         const std::vector<uint32_t>& indices, float positionStep) {
+    Range range;
+    if (isStreaming()) {
+        // 스트리밍: CPU 측에 모으지 않고 현재 기록 위치 뒤에 바로 업로드
+        range.firstIndex = mIndexCount;
+        range.vertexOffset = static_cast<int32_t>(mVertexCount);
+        uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+        if (mIndexType == VK_INDEX_TYPE_UINT16 && vertexCount > UINT16_MAX + 1u) {
+            LOGE("Streamed primitive has %u vertices, more than the declared 16-bit index limit", vertexCount);
+            mStreamFailed = true;
+            return range;
+        }
+        if (mVertexFormat == VertexFormat::Compact) {
+            std::vector<CompactVertex> compact;
+            range.dequant = VertexQuantization::quantize(vertices, compact, positionStep);
+            streamWrite(mVertexBuffer, mVertexUsage, sizeof(CompactVertex) * mVertexCount, compact.data(),
+                        sizeof(CompactVertex) * compact.size());
+        } else {
+            streamWrite(mVertexBuffer, mVertexUsage, sizeof(Vertex) * mVertexCount, vertices.data(),
+                        sizeof(Vertex) * vertices.size());
+        }
+        mVertexCount += vertexCount;
+        if (indices.empty()) {
+            std::vector<uint32_t> sequential(vertexCount);
+            std::iota(sequential.begin(), sequential.end(), 0u);
+            streamIndices(sequential.data(), sequential.size());
+        } else {
+            streamIndices(indices.data(), indices.size());
+        }
+        range.indexCount = mIndexCount - range.firstIndex;
+        return range;
+    }
+
+    range.firstIndex = static_cast<uint32_t>(mIndices.size());
+    if (mVertexFormat == VertexFormat::Compact) {
+        // 프리미티브 AABB 기준으로 양자화 (큰 씬에서도 프리미티브별 정밀도 유지)
+        std::vector<CompactVertex> compact;
+        range.dequant = VertexQuantization::quantize(vertices, compact, positionStep);
+        range.vertexOffset = static_cast<int32_t>(mCompactVertices.size());
+        mCompactVertices.insert(mCompactVertices.end(), compact.begin(), compact.end());
+    } else {
+        range.vertexOffset = static_cast<int32_t>(mVertices.size());
+        mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+    }
+    if (indices.empty()) {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(vertices.size()); i++) {
+            mIndices.push_back(i);
+        }
+    } else {
+        mIndices.insert(mIndices.end(), indices.begin(), indices.end());
+    }
+    if (!vertices.empty()) {
+        mMaxLocalIndex = std::max(mMaxLocalIndex, static_cast<uint32_t>(vertices.size() - 1));
+    }
+
+    range.indexCount = static_cast<uint32_t>(mIndices.size()) - range.firstIndex;
+    return range;
+}
+
+VulkanGeometryBuffer::Range VulkanGeometryBuffer::appendIndices(const Range& base, const std::vector<uint32_t>& indices) {
+    // 정점 구간과 복원 정보는 base와 같고 인덱스 구간만 새로 잡음 (로컬 인덱스 범위도 base와 동일)
+    Range range = base;
+    range.indexCount = static_cast<uint32_t>(indices.size());
+    if (isStreaming()) {
+        range.firstIndex = mIndexCount;
+        streamIndices(indices.data(), indices.size());
+        return range;
+    }
+    range.firstIndex = static_cast<uint32_t>(mIndices.size());
+    mIndices.insert(mIndices.end(), indices.begin(), indices.end());
+    return range;
+}
+
+bool VulkanGeometryBuffer::beginStreaming(VulkanUploadBatch& uploadBatch, uint32_t vertexCapacity,
+                                          uint32_t indexCapacity, uint32_t maxLocalVertexCount,
+                                          VkBufferUsageFlags extraVertexUsage) {
+    // append로 이미 모은 데이터나 업로드된 버퍼가 있으면 섞을 수 없음
+    if (vertexCapacity == 0 || indexCapacity == 0 || !mVertices.empty() || !mCompactVertices.empty() ||
+        !mIndices.empty() || isUploaded()) {
+        return false;
+    }
+
+    // 인덱스 타입은 기록 전에 정해야 하므로 실제 최댓값 대신 프리미티브 정점 수 상한으로 결정
+    size_t vertexSize = mVertexFormat == VertexFormat::Compact ? sizeof(CompactVertex) : sizeof(Vertex);
+    mIndexType = maxLocalVertexCount <= UINT16_MAX + 1u ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    size_t indexSize = mIndexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    mVertexUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | extraVertexUsage;
+    mVertexBuffer = uploadBatch.createDeviceBuffer(static_cast<VkDeviceSize>(vertexSize) * vertexCapacity,
+                                                   mVertexUsage);
+    mIndexBuffer = uploadBatch.createDeviceBuffer(static_cast<VkDeviceSize>(indexSize) * indexCapacity,
+                                                  VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+    if (!mVertexBuffer->isValid() || !mIndexBuffer->isValid()) {
+        LOGE("Failed to create streamed geometry buffers");
+        mVertexBuffer.reset();
+        mIndexBuffer.reset();
+        return false;
+    }
+
+    mStreamBatch = &uploadBatch;
+    mVertexCount = 0;
+    mIndexCount = 0;
+    mStreamFailed = false;
+    mStreamGrowCount = 0;
+    return true;
+}
+
+bool VulkanGeometryBuffer::endStreaming() {
+    if (!isStreaming()) return false;
+    VulkanUploadBatch& uploadBatch = *mStreamBatch;
+    mStreamBatch = nullptr;
+
+    if (mStreamFailed || mVertexCount == 0 || mIndexCount == 0) {
+        if (mStreamFailed) LOGE("Failed to stream shared geometry buffers");
+        // 이미 기록된 복사가 버퍼를 참조하므로 배치가 끝날 때까지 유지한 뒤 해제
+        uploadBatch.retainUntilComplete(std::move(mVertexBuffer));
+        uploadBatch.retainUntilComplete(std::move(mIndexBuffer));
+        mVertexCount = 0;
+        mIndexCount = 0;
+        return false;
+    }
+
+    bool compact = (mVertexFormat == VertexFormat::Compact);
+    size_t vertexSize = compact ? sizeof(CompactVertex) : sizeof(Vertex);
+    size_t indexSize = mIndexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    LOGI("Streamed shared geometry buffer: %u vertices (%s), %u indices (%s), %zu/%llu bytes used, %u grows",
+         mVertexCount, compact ? "compact" : "standard",
+         mIndexCount, mIndexType == VK_INDEX_TYPE_UINT16 ? "uint16" : "uint32",
+         vertexSize * mVertexCount + indexSize * mIndexCount,
+         static_cast<unsigned long long>(mVertexBuffer->getSize() + mIndexBuffer->getSize()), mStreamGrowCount);
+    return true;
+}
+
+bool VulkanGeometryBuffer::streamWrite(std::unique_ptr<VulkanBuffer>& buffer, VkBufferUsageFlags usage,
+                                       VkDeviceSize usedBytes, const void* data, VkDeviceSize size) {
+    if (mStreamFailed) return false;
+    if (usedBytes + size > buffer->getSize()) {
+        // 1.5배씩 키우고 기록된 구간은 GPU에서 새 버퍼로 복사 (CPU 사본 없음, 이전 버퍼는 복사가 끝날 때까지 배치가 유지)
+        VkDeviceSize capacity = std::max(usedBytes + size, buffer->getSize() + buffer->getSize() / 2);
+        std::unique_ptr<VulkanBuffer> grown = mStreamBatch->createDeviceBuffer(capacity, usage);
+        if (!grown->isValid()) {
+            LOGE("Failed to grow streamed geometry buffer to %llu bytes", static_cast<unsigned long long>(capacity));
+            mStreamFailed = true;
+            return false;
+        }
+        if (usedBytes > 0) {
+            mStreamBatch->transferWriteBarrier();
+            mStreamBatch->copyBuffer(buffer->getBuffer(), grown->getBuffer(), usedBytes);
+        }
+        mStreamBatch->retainUntilComplete(std::move(buffer));
+        buffer = std::move(grown);
+        mStreamGrowCount++;
+    }
+    mStreamBatch->writeBuffer(*buffer, data, size, usedBytes);
+    return true;
+}
+
+void VulkanGeometryBuffer::streamIndices(const uint32_t* indices, size_t count) {
+    if (count == 0) return;
+    if (mIndexType == VK_INDEX_TYPE_UINT16) {
+        std::vector<uint16_t> indices16(indices, indices + count);
+        streamWrite(mIndexBuffer, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, sizeof(uint16_t) * mIndexCount,
+                    indices16.data(), sizeof(uint16_t) * count);
+    } else {
+        streamWrite(mIndexBuffer, VK_BUFFER_USAGE_INDEX_BUFFER_BIT, sizeof(uint32_t) * mIndexCount, indices,
+                    sizeof(uint32_t) * count);
+    }
+    mIndexCount += static_cast<uint32_t>(count);
+}
+
+bool VulkanGeometryBuffer::upload(VulkanUploadBatch& uploadBatch, VkBufferUsageFlags extraVertexUsage) {
+    bool compact = (mVertexFormat == VertexFormat::Compact);
+    uint32_t vertexCount = static_cast<uint32_t>(compact ? mCompactVertices.size() : mVertices.size());
+    const void* vertices = compact ? static_cast<const void*>(mCompactVertices.data())
+                                   : static_cast<const void*>(mVertices.data());
+
+    // vertexOffset이 프리미티브 시작 정점을 더해주므로 로컬 인덱스가 16비트에 들어가면 UINT16 사용
+    bool uploaded;
+    if (mMaxLocalIndex <= UINT16_MAX) {
+        std::vector<uint16_t> indices16(mIndices.begin(), mIndices.end());
+        uploaded = uploadPacked(uploadBatch, vertices, vertexCount, indices16.data(),
+                                static_cast<uint32_t>(indices16.size()), VK_INDEX_TYPE_UINT16, extraVertexUsage);
+    } else {
+        uploaded = uploadPacked(uploadBatch, vertices, vertexCount, mIndices.data(),
+                                static_cast<uint32_t>(mIndices.size()), VK_INDEX_TYPE_UINT32, extraVertexUsage);
+    }
+    if (!uploaded) return false;
+
+    // 업로드가 배치에 기록되었으므로 CPU 측 사본은 더 이상 필요 없음
+    std::vector<Vertex>().swap(mVertices);
+    std::vector<CompactVertex>().swap(mCompactVertices);
+    std::vector<uint32_t>().swap(mIndices);
+    return true;
+}
+
+bool VulkanGeometryBuffer::uploadPacked(VulkanUploadBatch& uploadBatch, const void* vertices, uint32_t vertexCount,
+                                        const void* indices, uint32_t indexCount, VkIndexType indexType,
+                                        VkBufferUsageFlags extraVertexUsage) {
+    bool compact = (mVertexFormat == VertexFormat::Compact);
+    size_t vertexSize = compact ? sizeof(CompactVertex) : sizeof(Vertex);
+    size_t indexSize = indexType == VK_INDEX_TYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    mVertexCount = vertexCount;
+    mIndexCount = indexCount;
+    mIndexType = indexType;
+    if (mVertexCount == 0 || mIndexCount == 0) return false;
+
+    // 1. Vertex: 모든 프리미티브의 정점을 하나의 버퍼로
+    mVertexBuffer = uploadBatch.createDeviceBuffer(vertices, vertexSize * vertexCount,
+                                                   VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | extraVertexUsage);
+    // 2. Index: 모든 프리미티브의 인덱스를 하나의 버퍼로
+    mIndexBuffer = uploadBatch.createDeviceBuffer(indices, indexSize * indexCount, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+    if (!mVertexBuffer->isValid() || !mIndexBuffer->isValid()) {
+        LOGE("Failed to create shared geometry buffers");
+        mVertexBuffer.reset();
+        mIndexBuffer.reset();
+        return false;
+    }
+
+    LOGI("Shared geometry buffer: %u vertices (%s, %zu bytes each), %u indices (%s)",
+         mVertexCount, compact ? "compact" : "standard", vertexSize,
+         mIndexCount, mIndexType == VK_INDEX_TYPE_UINT16 ? "uint16" : "uint32");
+    return true;
+}
+
+void VulkanGeometryBuffer::getPackedData(std::vector<uint8_t>& vertices, std::vector<uint8_t>& indices,
+                                         VkIndexType& indexType) const {
+    if (mVertexFormat == VertexFormat::Compact) {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(mCompactVertices.data());
+        vertices.assign(data, data + sizeof(CompactVertex) * mCompactVertices.size());
+    } else {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(mVertices.data());
+        vertices.assign(data, data + sizeof(Vertex) * mVertices.size());
+    }
+    // upload와 같은 규칙으로 인덱스 타입 결정
+    if (mMaxLocalIndex <= UINT16_MAX) {
+        std::vector<uint16_t> indices16(mIndices.begin(), mIndices.end());
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(indices16.data());
+        indices.assign(data, data + sizeof(uint16_t) * indices16.size());
+        indexType = VK_INDEX_TYPE_UINT16;
+    } else {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(mIndices.data());
+        indices.assign(data, data + sizeof(uint32_t) * mIndices.size());
+        indexType = VK_INDEX_TYPE_UINT32;
+    }
+}
+
+void VulkanGeometryBuffer::bind(VkCommandBuffer commandBuffer, VkBuffer vertexBuffer) const {
+    VkBuffer vertexBuffers[] = { vertexBuffer != VK_NULL_HANDLE ? vertexBuffer : mVertexBuffer->getBuffer() };
+    VkDeviceSize offsets[] = { 0 };
+    vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+    vkCmdBindIndexBuffer(commandBuffer, mIndexBuffer->getBuffer(), 0, mIndexType);
+}
+
+void VulkanGeometryBuffer::draw(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout,
+                                const Range& range) const {
+    if (mVertexFormat == VertexFormat::Compact) {
+        vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT,
+                           offsetof(DrawPushConstants, dequant), sizeof(VertexDequantization), &range.dequant);
+    }
+    vkCmdDrawIndexed(commandBuffer, range.indexCount, 1, range.firstIndex, range.vertexOffset, 0);
+}
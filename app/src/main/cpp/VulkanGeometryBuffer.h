@@ -0,0 +1,97 @@
+#pragma once
+
+#include "volk.h"
+#include "VulkanBuffer.h"
+#include "VulkanUploadBatch.h"
+#include "vulkan_types.h"
+
+#include <vector>
+#include <memory>
+
+// 모델의 모든 프리미티브를 하나의 정점 버퍼와 하나의 인덱스 버퍼에 나눠 담는 공유 지오메트리 버퍼.
+// 프리미티브는 (firstIndex, vertexOffset, indexCount) 범위로만 표현되므로
+// 그리기 시 버퍼를 한 번만 바인딩하고 vkCmdDrawIndexed만 반복합니다.
+// VertexFormat::Compact면 프리미티브마다 양자화한 CompactVertex로 저장하고, 복원용 scale/offset을 draw 시 push constant로 전달합니다.
+// 인덱스는 프리미티브 로컬 값이므로, 모든 프리미티브의 정점 수가 65536 이하면 16비트 인덱스로 업로드합니다.
+// 스트리밍 모드(beginStreaming)에서는 CPU 측에 모으지 않고 append마다 GPU 버퍼에 바로 기록합니다.
+class VulkanGeometryBuffer {
+public:
+    struct Range {
+        uint32_t firstIndex = 0;
+        int32_t vertexOffset = 0;
+        uint32_t indexCount = 0;
+        VertexDequantization dequant{}; // Compact 포맷에서만 사용
+    };
+
+    explicit VulkanGeometryBuffer(VertexFormat vertexFormat = VertexFormat::Standard);
+    ~VulkanGeometryBuffer() = default;
+
+    // 복사 방지
+    VulkanGeometryBuffer(const VulkanGeometryBuffer&) = delete;
+    VulkanGeometryBuffer& operator=(const VulkanGeometryBuffer&) = delete;
+
+    // 프리미티브를 CPU 측 버퍼 뒤에 이어 붙이고 범위를 반환 (인덱스는 프리미티브 기준 로컬 값)
+    // 인덱스가 없는 프리미티브는 0..vertexCount-1 순차 인덱스로 채움
+    // positionStep: Compact 포맷에서 보존할 위치 격자 간격 (VertexQuantization::quantize 참고)
+    Range append(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, float positionStep = 0.0f);
+    // 이미 추가한 프리미티브(base)의 정점을 공유하는 인덱스 구간 추가 (LOD 등)
+    Range appendIndices(const Range& base, const std::vector<uint32_t>& indices);
+
+    // 스트리밍 업로드 시작: 예상 용량으로 GPU 버퍼 두 개를 만들고, 이후 append/appendIndices는 데이터를 바로 배치에 기록
+    // (프리미티브 단위로 CPU 사본을 해제할 수 있으므로 전체 지오메트리 크기만큼의 CPU 메모리가 필요 없음)
+    // 용량을 넘으면 더 큰 버퍼로 GPU 복사해 키움. maxLocalVertexCount: 프리미티브 하나의 정점 수 상한 (인덱스 타입 결정)
+    // uploadBatch는 endStreaming까지 유지되어야 함. 실패하면 false (일반 append/upload 경로 그대로 사용 가능)
+    bool beginStreaming(VulkanUploadBatch& uploadBatch, uint32_t vertexCapacity, uint32_t indexCapacity,
+                        uint32_t maxLocalVertexCount, VkBufferUsageFlags extraVertexUsage = 0);
+    // 스트리밍 종료. 기록에 실패했거나 추가된 프리미티브가 없으면 버퍼를 버리고 false
+    bool endStreaming();
+    bool isStreaming() const { return mStreamBatch != nullptr; }
+
+    // 모아둔 데이터로 GPU 버퍼 두 개를 만들고 (가능하면 인덱스를 UINT16으로 축소) 업로드를 배치에 기록 (CPU 측 데이터는 해제)
+    // extraVertexUsage: 정점 버퍼의 추가 용도 (예: 컴퓨트 스키닝 입력용 STORAGE_BUFFER)
+    bool upload(VulkanUploadBatch& uploadBatch, VkBufferUsageFlags extraVertexUsage = 0);
+    // 이미 GPU 형식으로 패킹된 정점/인덱스(베이크 파일의 매핑 등)를 그대로 업로드 (append로 모은 데이터는 사용하지 않음)
+    // vertices는 포맷에 맞는 정점 vertexCount개, indices는 indexType 원소 indexCount개
+    bool uploadPacked(VulkanUploadBatch& uploadBatch, const void* vertices, uint32_t vertexCount, const void* indices,
+                      uint32_t indexCount, VkIndexType indexType, VkBufferUsageFlags extraVertexUsage = 0);
+    // upload 전의 CPU 측 데이터를 upload와 같은 바이트 형식으로 복사 (오프라인 베이크용)
+    void getPackedData(std::vector<uint8_t>& vertices, std::vector<uint8_t>& indices, VkIndexType& indexType) const;
+
+    // 정점/인덱스 버퍼를 한 번만 바인딩
+    // vertexBuffer를 지정하면 같은 레이아웃의 다른 정점 버퍼(스키닝 출력 등)를 이 인덱스 버퍼와 함께 바인딩
+    void bind(VkCommandBuffer commandBuffer, VkBuffer vertexBuffer = VK_NULL_HANDLE) const;
+    // Compact 포맷이면 pipelineLayout으로 범위의 dequant를 push한 뒤 그리기
+    void draw(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, const Range& range) const;
+
+    VertexFormat getVertexFormat() const { return mVertexFormat; }
+    bool isUploaded() const { return mVertexBuffer != nullptr; }
+    uint32_t getVertexCount() const { return mVertexCount; }
+    uint32_t getIndexCount() const { return mIndexCount; }
+    VkIndexType getIndexType() const { return mIndexType; }
+    VkBuffer getVertexBuffer() const { return mVertexBuffer ? mVertexBuffer->getBuffer() : VK_NULL_HANDLE; }
+
+private:
+    VertexFormat mVertexFormat;
+    std::vector<Vertex> mVertices;
+    std::vector<CompactVertex> mCompactVertices;
+    std::vector<uint32_t> mIndices;
+
+    std::unique_ptr<VulkanBuffer> mVertexBuffer;
+    std::unique_ptr<VulkanBuffer> mIndexBuffer;
+    uint32_t mVertexCount = 0;
+    uint32_t mIndexCount = 0;
+    uint32_t mMaxLocalIndex = 0; // 모든 프리미티브의 로컬 인덱스 중 최댓값 (인덱스 타입 결정용)
+    VkIndexType mIndexType = VK_INDEX_TYPE_UINT32;
+
+    // 스트리밍 모드 상태 (mVertexCount/mIndexCount는 지금까지 기록한 양)
+    VulkanUploadBatch* mStreamBatch = nullptr;
+    VkBufferUsageFlags mVertexUsage = 0;
+    bool mStreamFailed = false;
+    uint32_t mStreamGrowCount = 0;
+
+    // 스트리밍 버퍼의 usedBytes 위치에 기록 (부족하면 용량을 키운 새 버퍼로 교체)
+    bool streamWrite(std::unique_ptr<VulkanBuffer>& buffer, VkBufferUsageFlags usage, VkDeviceSize usedBytes,
+                     const void* data, VkDeviceSize size);
+    // 로컬 인덱스를 현재 인덱스 타입으로 기록
+    void streamIndices(const uint32_t* indices, size_t count);
+};
@@ -1,6 +1,7 @@
 #include "VulkanMesh.h"
 
 void VulkanMesh::initialize(VulkanContext* context,
+                VulkanUploadBatch& uploadBatch,
                 const std::vector<Vertex>& vertices,
                 const void* indexData,
                 uint32_t indexCount,
@@ -9,43 +10,17 @@ void VulkanMesh::initialize(VulkanContext* context,
     mIndexType = indexType;
 
     // 1. Vertex
-    // Staging Buffer 생성
+    // UMA면 GPU 메모리에 직접 기록, 아니면 스테이징 링 -> Device Local Memory 복사를 배치에 기록
     VkDeviceSize vertexBufferSize = sizeof(Vertex) * vertices.size();
-    VulkanBuffer stagingBufferVertex(
-            context->getAllocator(), vertexBufferSize,
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-            VMA_MEMORY_USAGE_CPU_TO_GPU
-    );
-    stagingBufferVertex.copyTo(vertices.data(), vertexBufferSize);
-    // Device Local Memory (GPU) 버퍼 생성
-    mVertexBuffer = std::make_unique<VulkanBuffer>(
-            context->getAllocator(), vertexBufferSize,
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-            VMA_MEMORY_USAGE_GPU_ONLY
-    );
-    // GPU 내부에서 복사 실행
-    context->copyBuffer(stagingBufferVertex.getBuffer(), mVertexBuffer->getBuffer(), vertexBufferSize);
+    mVertexBuffer = uploadBatch.createDeviceBuffer(vertices.data(), vertexBufferSize,
+                                                   VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
 
 
     // 2. Index
-    // Staging Buffer 생성
     VkDeviceSize indexElementSize = (mIndexType == VK_INDEX_TYPE_UINT32) ? sizeof(uint32_t) : sizeof(uint16_t);
     VkDeviceSize indexBufferSize = indexElementSize * mIndexCount;
-    VulkanBuffer stagingBufferIndex(
-            context->getAllocator(), indexBufferSize,
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-            VMA_MEMORY_USAGE_CPU_TO_GPU
-    );
-    stagingBufferIndex.copyTo(indexData, indexBufferSize);
-    // Device Local Memory (GPU) 버퍼 생성
-    mIndexBuffer = std::make_unique<VulkanBuffer>(
-            context->getAllocator(), indexBufferSize,
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-            VMA_MEMORY_USAGE_GPU_ONLY
-    );
-
-    // GPU 내부에서 복사 실행
-    context->copyBuffer(stagingBufferIndex.getBuffer(), mIndexBuffer->getBuffer(), indexBufferSize);
+    mIndexBuffer = uploadBatch.createDeviceBuffer(indexData, indexBufferSize,
+                                                  VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
 }
 
 void VulkanMesh::draw(VkCommandBuffer commandBuffer) {
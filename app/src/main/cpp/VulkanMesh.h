@@ -3,20 +3,27 @@
 #include "volk.h"
 #include "VulkanContext.h"
 #include "VulkanBuffer.h"
+#include "VulkanUploadBatch.h"
 #include "vulkan_types.h"
 #include <vector>
 #include <memory>
+#include <type_traits>
 
 class VulkanMesh {
 public:
+    // 스테이징 -> GPU 복사는 uploadBatch에 기록만 하고, 제출은 호출자가 한 번에 수행
     template<typename T>
     VulkanMesh(VulkanContext* context,
+               VulkanUploadBatch& uploadBatch,
                const std::vector<Vertex>& vertices,
                const std::vector<T>& indices) {
+        // Vulkan 코어는 8비트 인덱스를 지원하지 않으므로 호출자가 uint16_t로 넓혀서 전달해야 함
+        static_assert(std::is_same<T, uint16_t>::value || std::is_same<T, uint32_t>::value,
+                      "VulkanMesh indices must be uint16_t or uint32_t");
         VkIndexType indexType = (sizeof(T) == sizeof(uint32_t))
                 ? VK_INDEX_TYPE_UINT32 : VK_INDEX_TYPE_UINT16;
 
-        initialize(context, vertices, indices.data(),
+        initialize(context, uploadBatch, vertices, indices.data(),
                    static_cast<uint32_t>(indices.size()), indexType);
     }
     ~VulkanMesh() = default;
@@ -29,6 +36,7 @@ public:
 
 private:
     void initialize(VulkanContext* context,
+                    VulkanUploadBatch& uploadBatch,
                     const std::vector<Vertex>& vertices,
                     const void* indexData,
                     uint32_t indexCount,
@@ -1,201 +1,1748 @@
-#define TINYGLTF_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
-// [중요] 안드로이드 에셋 로딩 활성화 매크로를 헤더 포함 전에 정의합니다.
-#ifndef TINYGLTF_ANDROID_LOAD_FROM_ASSETS
-#define TINYGLTF_ANDROID_LOAD_FROM_ASSETS
-#endif
-#include "tiny_gltf.h"
+#include "stb_image.h"
+#include "stb_image_write.h" // 헤드리스 빌드의 --screenshot이 구현을 사용
 
 #include "VulkanModel.h"
 #include "Log.h"
+#include "mesh_optimizer.h"
+#include "accessor_decoder.h"
+#include "thread_pool.h"
+#include "baked_model.h"
+#include "gltf.h"
+#include "load_memory_budget.h"
 
-VulkanModel::VulkanModel(VulkanContext* context) : mContext(context) {
+#include <algorithm>
+#include <cctype>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+// glTF 버퍼 인덱스별 바이트 범위 (GLB의 BIN 청크는 매핑된 에셋을 직접 가리킴)
+using BufferSpans = std::vector<AssetUtils::ByteSpan>;
+
+// 이보다 작은 프리미티브는 메시렛으로 나누지 않고 전체를 하나의 클러스터로 컬링 (draw 수 증가 방지)
+constexpr size_t kMinTrianglesForMeshlets = MeshletBuilder::kMaxTriangles * 2;
+
+// 메모리 예산 모드에서 프리미티브 임포트 작업(디코딩 -> 최적화 -> 메시렛 -> LOD)의 메모리 예상치
+// 합성 그리드(용접된/용접 전 정점)에서 잰 최대 힙의 1.2~1.6배가 되도록 잡은 값
+constexpr size_t kImportBytesPerVertex = 96;
+constexpr size_t kImportBytesPerIndex = 48;
+
+// glTF 노드의 TRS (matrix로 지정된 노드는 애니메이션 대상이 될 수 없으므로 항등 TRS)
+AnimationPlayer::NodePose readNodePose(const Gltf::Node& node) {
+    AnimationPlayer::NodePose pose;
+    if (node.hasMatrix) return pose;
+    pose.translation = glm::make_vec3(node.translation);
+    // glTF는 (x, y, z, w), glm::quat 생성자는 (w, x, y, z)
+    pose.rotation = glm::quat(node.rotation[3], node.rotation[0], node.rotation[1], node.rotation[2]);
+    pose.scale = glm::make_vec3(node.scale);
+    return pose;
 }
 
-glm::mat4 VulkanModel::getAnimationTransform(float time) {
-    if (mRotationAnim.times.empty()) return glm::mat4(1.0f);
+// 정수 위치 접근자(KHR_mesh_quantization)의 float 변환 후 격자 간격 (float이면 0)
+// 최적화/메시렛/LOD는 정점을 옮기지 않으므로 Compact 양자화까지 이 격자가 유지됨
+float getPositionStep(const Gltf::Accessor& accessor) {
+    if (!accessor.normalized) return accessor.componentType == AccessorDecoder::Float ? 0.0f : 1.0f;
+    switch (accessor.componentType) {
+        case AccessorDecoder::Byte: return 1.0f / 127.0f;
+        case AccessorDecoder::UnsignedByte: return 1.0f / 255.0f;
+        case AccessorDecoder::Short: return 1.0f / 32767.0f;
+        case AccessorDecoder::UnsignedShort: return 1.0f / 65535.0f;
+        default: return 0.0f;
+    }
+}
+
+// 접근자를 float 배열로 읽기 (모든 성분 타입, normalized, byteStride, sparse 지원)
+// bufferView가 없는 접근자는 0으로 채운 뒤 sparse 값만 덮어씀 (모프 타깃에서 흔한 형태)
+bool readAccessorFloats(const Gltf::Document& model, const BufferSpans& buffers, int accessorIndex,
+                        std::vector<float>& out) {
+    if (accessorIndex < 0 || static_cast<size_t>(accessorIndex) >= model.accessors.size()) return false;
+    const Gltf::Accessor& accessor = model.accessors[accessorIndex];
+    if (accessor.bufferView < 0 && !accessor.sparse.isSparse) return false;
+
+    // componentType과 bufferView 참조는 파싱 단계에서 검사됨
+    size_t components = Gltf::getComponentCount(accessor.type);
+    size_t componentSize = AccessorDecoder::getComponentSize(accessor.componentType);
+    AccessorDecoder::Layout layout;
+    layout.componentType = accessor.componentType;
+    layout.components = components;
+    layout.normalized = accessor.normalized;
+    // bufferView가 있으면 decode가 모든 원소를 덮어쓰므로 0으로 채울 필요 없음
+    if (accessor.bufferView >= 0) {
+        out.resize(accessor.count * components);
+    } else {
+        out.assign(accessor.count * components, 0.0f);
+    }
+
+    // 1. 기본 값
+    if (accessor.bufferView >= 0) {
+        const Gltf::BufferView& view = model.bufferViews[accessor.bufferView];
+        const AssetUtils::ByteSpan& buffer = buffers[view.buffer];
+        size_t stride = Gltf::getByteStride(accessor, view);
+        size_t begin = view.byteOffset + accessor.byteOffset;
+        if (accessor.count > 0 &&
+            begin + (accessor.count - 1) * stride + components * componentSize > buffer.size) {
+            return false;
+        }
+        layout.stride = stride;
+        if (!AccessorDecoder::decode(buffer.data + begin, accessor.count, layout, out.data())) return false;
+    }
 
-    // 1. 전체 애니메이션 시간을 넘어가면 반복(Loop) 처리
-    float animTime = fmod(time, mRotationAnim.times.back());
+    // 2. sparse: 인덱스 배열이 가리키는 원소만 값 배열로 교체 (둘 다 촘촘히 패킹됨)
+    if (accessor.sparse.isSparse && accessor.sparse.count > 0) {
+        const auto& sparse = accessor.sparse;
+        const Gltf::BufferView& indexView = model.bufferViews[sparse.indices.bufferView];
+        const Gltf::BufferView& valueView = model.bufferViews[sparse.values.bufferView];
+        const AssetUtils::ByteSpan& indexBuffer = buffers[indexView.buffer];
+        const AssetUtils::ByteSpan& valueBuffer = buffers[valueView.buffer];
+        size_t count = static_cast<size_t>(sparse.count);
+        size_t indexSize = AccessorDecoder::getComponentSize(sparse.indices.componentType);
+        size_t indexBegin = indexView.byteOffset + sparse.indices.byteOffset;
+        size_t valueBegin = valueView.byteOffset + sparse.values.byteOffset;
+        size_t elementSize = components * componentSize;
+        if (indexSize == 0 || indexBegin + count * indexSize > indexBuffer.size ||
+            valueBegin + count * elementSize > valueBuffer.size) {
+            return false;
+        }
 
-    // 2. 현재 시간에 해당하는 키프레임 구간 찾기
-    size_t i = 0;
-    while (i < mRotationAnim.times.size() - 1 && animTime > mRotationAnim.times[i + 1]) {
-        i++;
+        std::vector<float> values(count * components);
+        layout.stride = 0; // sparse 값은 촘촘히 패킹됨
+        if (!AccessorDecoder::decode(valueBuffer.data + valueBegin, count, layout, values.data())) return false;
+        const unsigned char* indices = indexBuffer.data + indexBegin;
+        for (size_t i = 0; i < count; i++) {
+            size_t index;
+            if (sparse.indices.componentType == AccessorDecoder::UnsignedByte) {
+                index = indices[i];
+            } else if (sparse.indices.componentType == AccessorDecoder::UnsignedShort) {
+                index = reinterpret_cast<const uint16_t*>(indices)[i];
+            } else if (sparse.indices.componentType == AccessorDecoder::UnsignedInt) {
+                index = reinterpret_cast<const uint32_t*>(indices)[i];
+            } else {
+                return false;
+            }
+            if (index >= accessor.count) return false;
+            std::copy_n(&values[i * components], components, &out[index * components]);
+        }
     }
+    return true;
+}
 
-    // 3. 두 키프레임 사이의 보간 비율(0.0 ~ 1.0) 계산
-    float t1 = mRotationAnim.times[i];
-    float t2 = mRotationAnim.times[i + 1];
-    float alpha = (animTime - t1) / (t2 - t1);
+// JOINTS_0 (UNSIGNED_BYTE/UNSIGNED_SHORT VEC4, 정규화되지 않은 인덱스)
+bool readAccessorJoints(const Gltf::Document& model, const BufferSpans& buffers, int accessorIndex,
+                        std::vector<uint16_t>& out) {
+    if (accessorIndex < 0 || static_cast<size_t>(accessorIndex) >= model.accessors.size()) return false;
+    const Gltf::Accessor& accessor = model.accessors[accessorIndex];
+    if (accessor.bufferView < 0 || accessor.type != Gltf::AccessorType::Vec4) return false;
+    const Gltf::BufferView& view = model.bufferViews[accessor.bufferView];
+    const AssetUtils::ByteSpan& buffer = buffers[view.buffer];
 
-    // 4. 회전 보간 (Spherical Linear Interpolation - SLERP)
-    glm::quat q1 = mRotationAnim.rotations[i];
-    glm::quat q2 = mRotationAnim.rotations[i + 1];
-    glm::quat blendedQuat = glm::slerp(q1, q2, alpha);
+    size_t componentSize = AccessorDecoder::getComponentSize(accessor.componentType);
+    size_t stride = Gltf::getByteStride(accessor, view);
+    size_t begin = view.byteOffset + accessor.byteOffset;
+    if (accessor.count > 0 && begin + (accessor.count - 1) * stride + 4 * componentSize > buffer.size) {
+        return false;
+    }
+
+    out.resize(accessor.count * 4);
+    const unsigned char* data = buffer.data + begin;
+    for (size_t i = 0; i < accessor.count; i++) {
+        const unsigned char* element = data + i * stride;
+        for (int c = 0; c < 4; c++) {
+            if (accessor.componentType == AccessorDecoder::UnsignedByte) {
+                out[i * 4 + c] = element[c];
+            } else if (accessor.componentType == AccessorDecoder::UnsignedShort) {
+                out[i * 4 + c] = reinterpret_cast<const uint16_t*>(element)[c];
+            } else {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// JOINTS_0/WEIGHTS_0를 SkinVertex로 변환 (가중치는 합이 1이 되도록 정규화 후 unorm16)
+bool readSkinAttributes(const Gltf::Document& model, const BufferSpans& buffers, const Gltf::Primitive& primitive,
+                        size_t vertexCount, std::vector<SkinVertex>& out, uint32_t& jointCount) {
+    std::vector<uint16_t> joints;
+    std::vector<float> weights;
+    if (!readAccessorJoints(model, buffers, primitive.attributes.joints0, joints) ||
+        !readAccessorFloats(model, buffers, primitive.attributes.weights0, weights)) {
+        return false;
+    }
+    if (joints.size() != vertexCount * 4 || weights.size() != vertexCount * 4) return false;
+
+    out.resize(vertexCount);
+    for (size_t i = 0; i < vertexCount; i++) {
+        const uint16_t* j = &joints[i * 4];
+        const float* w = &weights[i * 4];
+        float sum = w[0] + w[1] + w[2] + w[3];
+        float scale = sum > 0.0f ? 1.0f / sum : 0.0f;
+        uint32_t q[4];
+        for (int c = 0; c < 4; c++) {
+            float weight = sum > 0.0f ? w[c] * scale : (c == 0 ? 1.0f : 0.0f);
+            q[c] = static_cast<uint32_t>(std::min(std::max(weight, 0.0f), 1.0f) * 65535.0f + 0.5f);
+            jointCount = std::max(jointCount, static_cast<uint32_t>(j[c]) + 1);
+        }
+        out[i].joints[0] = j[0] | (static_cast<uint32_t>(j[1]) << 16);
+        out[i].joints[1] = j[2] | (static_cast<uint32_t>(j[3]) << 16);
+        out[i].weights[0] = q[0] | (q[1] << 16);
+        out[i].weights[1] = q[2] | (q[3] << 16);
+    }
+    return true;
+}
+
+// 프리미티브 모프 타깃의 POSITION 델타를 정점별로 모음 (sparse 접근자 지원, 델타가 0인 정점/타깃은 제외)
+// NORMAL/TANGENT 타깃은 Vertex에 해당 속성이 없으므로 무시. 읽은 타깃 수(위치 델타가 없는 타깃 포함) 반환
+uint32_t readMorphTargets(const Gltf::Document& model, const BufferSpans& buffers,
+                          const Gltf::Primitive& primitive, size_t vertexCount,
+                          std::vector<std::vector<MorphDelta>>& vertexDeltas) {
+    vertexDeltas.assign(vertexCount, {});
+    std::vector<float> deltas;
+    for (size_t target = 0; target < primitive.targetPositions.size(); target++) {
+        int32_t position = primitive.targetPositions[target];
+        if (position < 0) continue;
+        if (!readAccessorFloats(model, buffers, position, deltas) || deltas.size() != vertexCount * 3) {
+            LOGW("Invalid morph target %zu POSITION accessor, ignoring target", target);
+            continue;
+        }
+        for (size_t v = 0; v < vertexCount; v++) {
+            const float* d = &deltas[v * 3];
+            if (d[0] == 0.0f && d[1] == 0.0f && d[2] == 0.0f) continue;
+            vertexDeltas[v].push_back({ { d[0], d[1], d[2] }, static_cast<uint32_t>(target) });
+        }
+    }
+    return static_cast<uint32_t>(primitive.targetPositions.size());
+}
+
+// 대소문자 구분 없이 확장자 비교 (extension은 소문자, '.' 포함)
+bool hasExtension(const std::string& filename, const char* extension) {
+    size_t length = std::strlen(extension);
+    if (filename.size() < length) return false;
+    return std::equal(filename.end() - length, filename.end(), extension, [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    });
+}
+} // namespace
+
+VulkanModel::VulkanModel(VulkanContext* context, bool useSharedGeometry, VertexFormat vertexFormat)
+        : mContext(context), mUseSharedGeometry(useSharedGeometry), mGeometry(vertexFormat) {
+    // 프리미티브별 VulkanMesh 경로는 float 정점만 지원하므로 Compact면 공유 지오메트리로 강제
+    if (vertexFormat == VertexFormat::Compact && !mUseSharedGeometry) {
+        LOGW("Compact vertex format requires shared geometry, enabling it");
+        mUseSharedGeometry = true;
+    }
+}
 
-    // 5. 최종 회전 행렬로 변환하여 반환
-    return glm::mat4_cast(blendedQuat);
+std::vector<AnimationPlayer::NodePose> VulkanModel::readRestPose(const Gltf::Document& model) const {
+    // 씬 그래프 순서 (glTF 노드가 없는 씬 노드는 항등 TRS)
+    std::vector<AnimationPlayer::NodePose> restPose(mScene.getNodeCount());
+    for (size_t i = 0; i < mSceneNodeRemap.size(); i++) {
+        int32_t node = mSceneNodeRemap[i];
+        if (node < 0) continue;
+        restPose[node] = readNodePose(model.nodes[i]);
+        int mesh = model.nodes[i].mesh;
+        if (mesh >= 0) {
+            const auto& weights = model.meshes[mesh].weights;
+            restPose[node].weights.assign(weights.begin(), weights.end());
+        }
+    }
+    return restPose;
 }
 
-void VulkanModel::loadAnimations(const tinygltf::Model& model) {
+void VulkanModel::loadAnimations(const Gltf::Document& model, const BufferSpans& buffers, ThreadPool& pool) {
     if (model.animations.empty()) return;
 
-    // AnimatedCube는 첫 번째 애니메이션의 첫 번째 채널이 회전입니다.
-    const auto& anim = model.animations[0];
-    for (const auto& channel : anim.channels) {
-        if (channel.target_path == "rotation") {
+    // 1. 레스트 포즈
+    std::vector<AnimationPlayer::NodePose> restPose = readRestPose(model);
+
+    // 2. 모든 애니메이션의 모든 채널을 클립으로 변환 (기본 씬 밖의 노드를 구동하는 채널은 제외)
+    std::vector<Animation::Clip> clips;
+    for (const auto& anim : model.animations) {
+        Animation::Clip clip;
+        clip.name = std::string(anim.name);
+        for (const auto& channel : anim.channels) {
+            // 샘플러 인덱스는 파싱 단계에서 검사됨
+            int32_t node = getSceneNodeIndex(channel.targetNode);
+            if (node < 0) continue;
             const auto& sampler = anim.samplers[channel.sampler];
 
-            // 1. 시간 데이터 추출
-            const auto& inputAccessor = model.accessors[sampler.input];
-            const auto& inputView = model.bufferViews[inputAccessor.bufferView];
-            const auto& inputBuffer = model.buffers[inputView.buffer];
-            const float* times = reinterpret_cast<const float*>(&inputBuffer.data[inputView.byteOffset + inputAccessor.byteOffset]);
-            mRotationAnim.times.assign(times, times + inputAccessor.count);
-
-            // 2. 회전 데이터(Quaternion) 추출
-            const auto& outputAccessor = model.accessors[sampler.output];
-            const auto& outputView = model.bufferViews[outputAccessor.bufferView];
-            const auto& outputBuffer = model.buffers[outputView.buffer];
-            const float* rotations = reinterpret_cast<const float*>(&outputBuffer.data[outputView.byteOffset + outputAccessor.byteOffset]);
-
-            for (size_t i = 0; i < outputAccessor.count; ++i) {
-                mRotationAnim.rotations.push_back(glm::make_quat(&rotations[i * 4]));
+            Animation::Channel out;
+            out.targetNode = static_cast<uint32_t>(node);
+            switch (channel.targetPath) {
+                case Gltf::TargetPath::Translation: out.path = Animation::Path::Translation; break;
+                case Gltf::TargetPath::Rotation: out.path = Animation::Path::Rotation; break;
+                case Gltf::TargetPath::Scale: out.path = Animation::Path::Scale; break;
+                case Gltf::TargetPath::Weights: out.path = Animation::Path::Weights; break;
+                case Gltf::TargetPath::Unsupported:
+                    LOGW("Animation '%s': unsupported channel path, skipping channel", anim.name.c_str());
+                    continue;
             }
+
+            switch (sampler.interpolation) {
+                case Gltf::Interpolation::Step: out.interpolation = Animation::Interpolation::Step; break;
+                case Gltf::Interpolation::CubicSpline: out.interpolation = Animation::Interpolation::CubicSpline; break;
+                case Gltf::Interpolation::Linear: out.interpolation = Animation::Interpolation::Linear; break;
+            }
+
+            if (!readAccessorFloats(model, buffers, sampler.input, out.times) ||
+                !readAccessorFloats(model, buffers, sampler.output, out.values) || out.times.empty()) {
+                LOGW("Animation '%s': failed to read sampler %d", anim.name.c_str(), channel.sampler);
+                continue;
+            }
+
+            // weights는 타입이 SCALAR이므로 키당 값 개수 = 모프 타깃 수
+            size_t valuesPerKey = out.values.size() / out.times.size();
+            if (out.interpolation == Animation::Interpolation::CubicSpline) valuesPerKey /= 3;
+            out.components = static_cast<uint32_t>(valuesPerKey);
+
+            clip.duration = std::max(clip.duration, out.times.back());
+            clip.channels.push_back(std::move(out));
+        }
+        LOGI("Loaded animation '%s': %zu channels, %.2fs", clip.name.c_str(), clip.channels.size(), clip.duration);
+        clips.push_back(std::move(clip));
+    }
+
+    // 3. 허용 오차 안에서 키 양자화/제거 (원본 float 키는 해제). 채널끼리 독립이므로 채널 단위로 분산
+    if (mCompressAnimations) {
+        std::vector<Animation::Channel*> channels;
+        for (auto& clip : clips) {
+            for (auto& channel : clip.channels) channels.push_back(&channel);
+        }
+        std::vector<AnimationCompression::Stats> channelStats(channels.size());
+        pool.parallelFor(channels.size(), [&](size_t i) {
+            AnimationCompression::compressChannel(*channels[i], mAnimationCompression, channelStats[i]);
+        });
+        AnimationCompression::Stats stats;
+        for (const auto& channel : channelStats) {
+            stats.bytesBefore += channel.bytesBefore;
+            stats.bytesAfter += channel.bytesAfter;
+            stats.keysBefore += channel.keysBefore;
+            stats.keysAfter += channel.keysAfter;
+            stats.channelsCompressed += channel.channelsCompressed;
         }
+        LOGI("Animation compression: %u channels, keys %zu -> %zu, %zu -> %zu bytes",
+             stats.channelsCompressed, stats.keysBefore, stats.keysAfter, stats.bytesBefore, stats.bytesAfter);
     }
+
+    mAnimator.setup(std::move(clips), std::move(restPose));
+    // 기본으로 첫 번째 클립을 반복 재생 (추가 클립은 getAnimator().play로 동시에 재생 가능)
+    mAnimator.play(0);
 }
 
-bool VulkanModel::loadFromFile(AAssetManager* assetManager, const std::string& filename) {
-    // 1. tinygltf 전역 에셋 매니저 설정 (내부 로더가 사용)
-    tinygltf::asset_manager = assetManager;
+// 병렬 임포트 결과 슬롯 (작업마다 하나, GPU 업로드와 버퍼 추가는 호출 스레드에서 원래 순서대로)
+struct VulkanModel::ImportedImage {
+    std::vector<unsigned char> pixels; // RGBA8, 디코딩 실패 시 비어 있음
+    int width = 0;
+    int height = 0;
+};
 
-    tinygltf::Model model;
-    tinygltf::TinyGLTF loader;
-    std::string err;
-    std::string warn;
+struct VulkanModel::ImportedPrimitive {
+    uint32_t mesh = 0;
+    uint32_t primitive = 0;
+    bool skinned = false;
+    bool morphed = false;
+    bool valid = false; // false면 건너뜀 (잘못된 접근자 등)
+    size_t cost = 0;    // 작업 순서를 정하기 위한 대략적인 비용
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    float positionStep = 0.0f; // KHR_mesh_quantization 정수 위치의 격자 간격 (float 위치면 0)
 
-    // 2. LoadASCIIFromFile 사용
-    // 이 함수는 filename을 기반으로 base_dir를 자동 계산하며,
-    // TINYGLTF_ANDROID_LOAD_FROM_ASSETS 덕분에 에셋 폴더에서 .bin 파일도 자동으로 찾습니다.
-    bool ret = loader.LoadASCIIFromFile(&model, &err, &warn, filename);
+    // 변형 메시 (스킨/모프)
+    std::vector<SkinVertex> skinVertices;
+    uint32_t jointCount = 0;
+    std::vector<std::vector<MorphDelta>> vertexDeltas;
+    uint32_t targetCount = 0;
 
-    if (!warn.empty()) LOGI("glTF Warning: %s", warn.c_str());
-    if (!err.empty()) LOGE("glTF Error: %s", err.c_str());
-    if (!ret) {
+    // 정적 메시의 클러스터/LOD (공유 지오메트리 모드)
+    std::vector<MeshletBuilder::Meshlet> clusters;
+    MeshletBuilder::Meshlet bounds{};
+    std::vector<MeshSimplifier::LodLevel> lods;
+};
+
+bool VulkanModel::parseGltf(AAssetManager* assetManager, const std::string& filename, Gltf::File& file) {
+    // .gltf/.glb 모두 파일을 매핑하고 JSON을 한 번만 훑어 문서를 만듦 (DOM/문자열 사본 없음)
+    // 버퍼(GLB의 BIN 청크, 외부 .bin)와 이미지 파일도 매핑된 메모리를 그대로 참조
+    auto parseStart = std::chrono::steady_clock::now();
+    if (!file.open(assetManager, filename)) {
         LOGE("Failed to parse glTF: %s", filename.c_str());
         return false;
     }
-    LOGI("Successfully loaded glTF model: %s", filename.c_str());
+    auto parseEnd = std::chrono::steady_clock::now();
+    LOGI("Successfully loaded glTF model: %s (%s, %.1f ms, %zu KB document)", filename.c_str(),
+         file.isBinary() ? "GLB" : "glTF", std::chrono::duration<double, std::milli>(parseEnd - parseStart).count(),
+         file.getArenaBytes() / 1024);
+    return true;
+}
+
+void VulkanModel::importParallel(const Gltf::File& file, ThreadPool& pool, std::vector<ImportedImage>& images,
+                                 std::vector<ImportedPrimitive>& primitives) const {
+    // 이미지 디코딩과 프리미티브 변환(속성 디코딩, 최적화, 클러스터/LOD)을 하나의 작업 목록으로
+    // 작업 스레드에 분배. 큰 작업부터 시작해 마지막에 스레드 하나만 일하는 꼬리를 줄이고,
+    // 결과는 작업별 슬롯에 담아 이후 단계가 원래 순서대로 소비 (스레드 수와 무관하게 같은 버퍼가 만들어짐)
+    const Gltf::Document& model = file.getDocument();
+    auto importStart = std::chrono::steady_clock::now();
+    images.assign(model.images.size(), ImportedImage{});
+    primitives = collectPrimitives(model);
+    importJobs(file, pool, images, primitives, 0, images.size() + primitives.size());
+    auto importEnd = std::chrono::steady_clock::now();
+    LOGI("Imported %zu images, %zu primitives on %u threads in %.1f ms", images.size(), primitives.size(),
+         pool.getThreadCount(), std::chrono::duration<double, std::milli>(importEnd - importStart).count());
+}
+
+void VulkanModel::importJobs(const Gltf::File& file, ThreadPool& pool, std::vector<ImportedImage>& images,
+                             std::vector<ImportedPrimitive>& primitives, size_t firstJob, size_t lastJob) const {
+    const Gltf::Document& model = file.getDocument();
+    const BufferSpans& buffers = file.getBuffers();
+    std::vector<size_t> jobs(lastJob - firstJob);
+    std::vector<size_t> jobCosts(jobs.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        size_t job = firstJob + i;
+        jobs[i] = job;
+        // 이미지는 인코딩된 크기, 프리미티브는 인덱스(없으면 정점) 수 기준의 대략적인 비용
+        jobCosts[i] = job < images.size() ? file.getImageBytes(job).size : primitives[job - images.size()].cost;
+    }
+    std::stable_sort(jobs.begin(), jobs.end(), [&](size_t a, size_t b) {
+        return jobCosts[a - firstJob] > jobCosts[b - firstJob];
+    });
+    pool.parallelFor(jobs.size(), [&](size_t i) {
+        size_t job = jobs[i];
+        if (job < images.size()) {
+            decodeImage(model.images[job], file.getImageBytes(job), images[job]);
+        } else {
+            importPrimitive(model, buffers, primitives[job - images.size()]);
+        }
+    });
+}
+
+size_t VulkanModel::estimateImportBytes(const Gltf::File& file, const std::vector<ImportedPrimitive>& primitives,
+                                        size_t job) const {
+    const Gltf::Document& model = file.getDocument();
+    if (job < model.images.size()) {
+        // 헤더만 읽어 크기를 구함. 디코딩 중에는 stb_image 출력과 ImportedImage 사본이 함께 존재
+        AssetUtils::ByteSpan encoded = file.getImageBytes(job);
+        int width = 0;
+        int height = 0;
+        int components = 0;
+        if (encoded.size == 0 || encoded.size > INT32_MAX ||
+            !stbi_info_from_memory(encoded.data, static_cast<int>(encoded.size), &width, &height, &components)) {
+            return encoded.size;
+        }
+        return static_cast<size_t>(width) * height * 4 * 2;
+    }
+
+    const ImportedPrimitive& imported = primitives[job - model.images.size()];
+    const Gltf::Primitive& primitive = model.meshes[imported.mesh].primitives[imported.primitive];
+    size_t vertexCount = static_cast<size_t>(model.accessors[primitive.attributes.position].count);
+    size_t indexCount = primitive.indices >= 0 ? static_cast<size_t>(model.accessors[primitive.indices].count)
+                                               : vertexCount;
+    return vertexCount * kImportBytesPerVertex + indexCount * kImportBytesPerIndex;
+}
+
+void VulkanModel::beginGeometryStreaming(const Gltf::Document& model, const std::vector<ImportedPrimitive>& primitives,
+                                         VulkanUploadBatch& uploadBatch) {
+    // 정점 용접은 정점 수를 줄이기만 하므로 POSITION 원소 수의 합이 정점 용량의 상한
+    // 인덱스는 LOD 체인(단계마다 절반 목표)까지 원본의 2배로 잡고, 넘치면 GeometryBuffer가 GPU에서 키움
+    uint64_t vertexCount = 0;
+    uint64_t indexCount = 0;
+    uint32_t maxLocalVertexCount = 0;
+    uint64_t skinnedVertexCount = 0;
+    uint64_t skinnedIndexCount = 0;
+    uint32_t skinnedMaxLocalVertexCount = 0;
+    for (const ImportedPrimitive& imported : primitives) {
+        const Gltf::Primitive& primitive = model.meshes[imported.mesh].primitives[imported.primitive];
+        uint64_t vertices = model.accessors[primitive.attributes.position].count;
+        uint64_t indices = primitive.indices >= 0 ? model.accessors[primitive.indices].count : vertices;
+        uint32_t localVertices = static_cast<uint32_t>(std::min<uint64_t>(vertices, UINT32_MAX));
+        if (imported.skinned || imported.morphed) {
+            // 변형 메시는 용접/LOD가 없으므로 정확한 크기
+            skinnedVertexCount += vertices;
+            skinnedIndexCount += indices;
+            skinnedMaxLocalVertexCount = std::max(skinnedMaxLocalVertexCount, localVertices);
+        } else if (mUseSharedGeometry) {
+            vertexCount += vertices;
+            indexCount += indices * 2;
+            maxLocalVertexCount = std::max(maxLocalVertexCount, localVertices);
+        }
+    }
+
+    // 용량이 32비트를 넘는 모델은 스트리밍하지 않고 일반 경로로 모음 (버퍼 생성 실패도 같음)
+    if (vertexCount > 0 && vertexCount <= UINT32_MAX && indexCount <= UINT32_MAX) {
+        mGeometry.beginStreaming(uploadBatch, static_cast<uint32_t>(vertexCount), static_cast<uint32_t>(indexCount),
+                                 maxLocalVertexCount);
+    }
+    if (skinnedVertexCount > 0 && skinnedVertexCount <= UINT32_MAX && skinnedIndexCount <= UINT32_MAX) {
+        mSkinnedGeometry.beginStreaming(uploadBatch, static_cast<uint32_t>(skinnedVertexCount),
+                                        static_cast<uint32_t>(skinnedIndexCount), skinnedMaxLocalVertexCount,
+                                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    }
+}
+
+void VulkanModel::importStreaming(const Gltf::File& file, ThreadPool& pool, VulkanUploadBatch& uploadBatch) {
+    // 한도에 맞는 만큼의 연속된 작업(이미지 다음 프리미티브 순서)을 한 묶음으로 병렬 임포트한 뒤,
+    // 호출 스레드에서 원래 순서대로 업로드하고 결과를 바로 해제. 동시에 살아 있는 임포트 결과는 한 묶음뿐이고
+    // 지오메트리는 GPU 버퍼에 바로 기록되므로, 병렬 임포트와 같은 버퍼/표가 더 작은 최대 메모리로 만들어짐
+    const Gltf::Document& model = file.getDocument();
+    auto importStart = std::chrono::steady_clock::now();
+    LoadMemoryBudget budget(mLoadMemoryBudget);
+    budget.acquire(file.getArenaBytes()); // 문서는 로드가 끝날 때까지 유지
+    uploadBatch.setBoundedStaging(true);
+
+    std::vector<ImportedImage> images(model.images.size());
+    std::vector<ImportedPrimitive> primitives = collectPrimitives(model);
+    size_t jobCount = images.size() + primitives.size();
+    std::vector<size_t> estimates(jobCount);
+    for (size_t job = 0; job < jobCount; job++) estimates[job] = estimateImportBytes(file, primitives, job);
+
+    mMeshPrimitives.assign(model.meshes.size(), PrimitiveSpan{});
+    mSkinnedMeshes.assign(model.meshes.size(), SkinnedMesh{});
+    beginGeometryStreaming(model, primitives, uploadBatch);
+
+    size_t retainedBytes = 0; // 업로드 직전까지 CPU에 남는 스킨 속성/모프 델타
+    uint32_t waves = 0;
+    for (size_t first = 0; first < jobCount; waves++) {
+        // 1. 한도 안에서 묶음 구성 (첫 작업은 한도를 넘어도 포함, 더 나눌 수 없음)
+        size_t last = first;
+        size_t waveBytes = 0;
+        while (last < jobCount && (last == first || budget.fits(waveBytes + estimates[last]))) {
+            waveBytes += estimates[last++];
+        }
+        if (!budget.fits(waveBytes)) {
+            LOGW("Import job %zu needs about %zu KB, over the load memory limit (%zu KB in use)", first,
+                 waveBytes / 1024, budget.getUsed() / 1024);
+        }
+
+        // 2. 병렬 임포트 -> 원래 순서대로 업로드하며 슬롯 해제
+        budget.acquire(waveBytes);
+        importJobs(file, pool, images, primitives, first, last);
+        for (size_t job = first; job < last; job++) {
+            if (job < images.size()) {
+                loadTexture(images[job], uploadBatch);
+            } else {
+                addPrimitive(primitives[job - images.size()], &uploadBatch);
+            }
+        }
+        budget.release(waveBytes);
+
+        size_t retained = sizeof(SkinVertex) * mSkinVertices.capacity() +
+                          sizeof(MorphVertex) * mMorphVertices.capacity() +
+                          sizeof(MorphDelta) * mMorphDeltas.capacity() +
+                          sizeof(uint32_t) * mMorphDeltaCounts.capacity();
+        budget.acquire(retained);
+        budget.release(retainedBytes);
+        retainedBytes = retained;
+        first = last;
+    }
+
+    uploadGeometry(model, uploadBatch);
+    budget.release(retainedBytes);
+
+    mLoadMemoryStats.peakTrackedBytes = budget.getPeak();
+    mLoadMemoryStats.waves = waves;
+    auto importEnd = std::chrono::steady_clock::now();
+    LOGI("Streamed %zu images, %zu primitives in %u waves on %u threads in %.1f ms (peak %zu KB, limit %zu KB)",
+         images.size(), primitives.size(), waves, pool.getThreadCount(),
+         std::chrono::duration<double, std::milli>(importEnd - importStart).count(), budget.getPeak() / 1024,
+         budget.getLimit() / 1024);
+}
+
+bool VulkanModel::loadFromFile(AAssetManager* assetManager, const std::string& filename, uint32_t framesInFlight) {
+    if (hasExtension(filename, BakedModel::kFileExtension)) return loadBaked(assetManager, filename);
+
+    // 1. 파싱 (파일 매핑과 문서는 로드가 끝날 때까지 유지)
+    Gltf::File file;
+    if (!parseGltf(assetManager, filename, file)) return false;
+    const Gltf::Document& model = file.getDocument();
+    const BufferSpans& buffers = file.getBuffers();
+
+    // 2. 텍스처와 메시의 모든 업로드를 하나의 커맨드 버퍼에 기록한 뒤 한 번만 제출 (업로드는 이 스레드에서만)
+    mUploadBatch = std::make_unique<VulkanUploadBatch>(mContext);
+    if (!mUploadBatch->begin()) return false;
+
+    // 3. 임포트: 한도가 없으면 전체를 병렬 임포트한 뒤 업로드, 있으면 한도에 맞는 묶음 단위로 번갈아 수행
+    ThreadPool pool(mImportWorkerCount);
+    mLoadMemoryStats = LoadMemoryStats{};
+    mLoadMemoryStats.limitBytes = mLoadMemoryBudget;
+    if (mLoadMemoryBudget > 0) {
+        importStreaming(file, pool, *mUploadBatch);
+    } else {
+        std::vector<ImportedImage> images;
+        std::vector<ImportedPrimitive> primitives;
+        importParallel(file, pool, images, primitives);
+        loadTextures(images, *mUploadBatch);
+        processModel(model, primitives, mUploadBatch.get());
+    }
+    loadScene(model);
+    loadSkins(model, buffers, assetManager, framesInFlight);
+    loadMorphTargets(model, assetManager, framesInFlight);
+    loadAnimations(model, buffers, pool);
+    setupAnimationLod();
 
-    loadTextures(model);
-    processModel(model);
-    loadAnimations(model);
+    if (!mUploadBatch->submit()) {
+        LOGE("Failed to submit model uploads: %s", filename.c_str());
+        return false;
+    }
 
+    mLoadMemoryStats.peakResidentBytes = LoadMemoryBudget::readPeakResidentBytes();
+    LOGI("Load memory: process peak RSS %zu KB", mLoadMemoryStats.peakResidentBytes / 1024);
     return true;
 }
 
-void VulkanModel::loadTextures(const tinygltf::Model& model) {
-    for (const auto& image : model.images) {
+bool VulkanModel::bakeToFile(AAssetManager* assetManager, const std::string& filename, const std::string& outputPath) {
+    if (!mUseSharedGeometry) {
+        LOGE("Baking requires shared geometry");
+        return false;
+    }
+
+    // 1. loadFromFile과 같은 파싱/임포트 (업로드 없이 CPU 측 버퍼까지만)
+    Gltf::File file;
+    if (!parseGltf(assetManager, filename, file)) return false;
+    const Gltf::Document& model = file.getDocument();
+    const BufferSpans& buffers = file.getBuffers();
+
+    ThreadPool pool(mImportWorkerCount);
+    std::vector<ImportedImage> images;
+    std::vector<ImportedPrimitive> primitives;
+    importParallel(file, pool, images, primitives);
+
+    // 2. 변형 메시(스킨/모프)의 GPU 입력은 아직 베이크 형식에 없으므로 거부 (해당 모델은 glTF로 로드)
+    //    공유 지오메트리에 추가되는 프리미티브 순서대로 머티리얼을 기록
+    std::vector<int32_t> primitiveMaterials;
+    for (const ImportedPrimitive& imported : primitives) {
+        if (imported.skinned || imported.morphed) {
+            LOGE("Cannot bake %s: skinned and morph target meshes are not supported", filename.c_str());
+            return false;
+        }
+        if (!imported.valid) continue;
+        primitiveMaterials.push_back(model.meshes[imported.mesh].primitives[imported.primitive].material);
+    }
+
+    processModel(model, primitives, nullptr);
+    loadScene(model);
+    loadAnimations(model, buffers, pool);
+
+    // 3. 런타임 상태 -> 베이크 레코드
+    BakedModel::Contents contents;
+    contents.vertexFormat = mGeometry.getVertexFormat();
+    VkIndexType indexType = VK_INDEX_TYPE_UINT32;
+    mGeometry.getPackedData(contents.vertices, contents.indices, indexType);
+    contents.indexSize = indexType == VK_INDEX_TYPE_UINT16 ? 2 : 4;
+    size_t vertexStride = contents.vertexFormat == VertexFormat::Compact ? sizeof(CompactVertex) : sizeof(Vertex);
+    contents.vertexCount = static_cast<uint32_t>(contents.vertices.size() / vertexStride);
+
+    auto toBakedRange = [](const VulkanGeometryBuffer::Range& range) {
+        BakedModel::Range baked;
+        baked.firstIndex = range.firstIndex;
+        baked.vertexOffset = range.vertexOffset;
+        baked.indexCount = range.indexCount;
+        baked.dequant = range.dequant;
+        return baked;
+    };
+    for (size_t i = 0; i < mPrimitiveRanges.size(); i++) {
+        BakedModel::Primitive primitive;
+        primitive.lod0 = toBakedRange(mPrimitiveRanges[i]);
+        primitive.firstCluster = mPrimitiveClusters[i].firstCluster;
+        primitive.clusterCount = mPrimitiveClusters[i].clusterCount;
+        primitive.firstLod = mPrimitiveLods[i].firstLevel;
+        primitive.lodCount = mPrimitiveLods[i].levelCount;
+        primitive.material = primitiveMaterials[i];
+        primitive.bounds = mPrimitiveBounds[i];
+        contents.primitives.push_back(primitive);
+    }
+    contents.clusters = mClusters;
+    for (const LodLevel& level : mLodLevels) contents.lodLevels.push_back({ toBakedRange(level.range), level.error });
+    for (const PrimitiveSpan& span : mMeshPrimitives) {
+        contents.meshes.push_back({ span.firstPrimitive, span.primitiveCount });
+    }
+
+    std::vector<AnimationPlayer::NodePose> restPose = readRestPose(model);
+    for (uint32_t i = 0; i < mScene.getNodeCount(); i++) {
+        BakedModel::Node node;
+        node.localMatrix = mScene.getLocalMatrix(i);
+        node.parent = mScene.getParent(i);
+        node.mesh = mScene.getMesh(i);
+        const AnimationPlayer::NodePose& pose = restPose[i];
+        std::copy_n(glm::value_ptr(pose.translation), 3, node.translation);
+        const float rotation[4] = { pose.rotation.x, pose.rotation.y, pose.rotation.z, pose.rotation.w };
+        std::copy_n(rotation, 4, node.rotation);
+        std::copy_n(glm::value_ptr(pose.scale), 3, node.scale);
+        contents.nodes.push_back(node);
+    }
+    contents.nodeRemap = mSceneNodeRemap;
+
+    for (ImportedImage& image : images) {
+        BakedModel::Image baked;
+        baked.width = static_cast<uint32_t>(image.width);
+        baked.height = static_cast<uint32_t>(image.height);
+        baked.pixels = std::move(image.pixels);
+        contents.images.push_back(std::move(baked));
+    }
+    for (const Gltf::Material& material : model.materials) {
+        BakedModel::Material baked;
+        if (material.baseColorTexture >= 0) baked.baseColorTexture = model.textures[material.baseColorTexture].source;
+        std::copy_n(material.baseColorFactor, 4, baked.baseColorFactor);
+        contents.materials.push_back(baked);
+    }
+    for (uint32_t i = 0; i < mAnimator.getClipCount(); i++) contents.clips.push_back(mAnimator.getClip(i));
+
+    return BakedModel::write(contents, outputPath);
+}
+
+bool VulkanModel::loadBaked(AAssetManager* assetManager, const std::string& filename) {
+    // 베이크 파일은 공유 지오메트리 형태로만 저장됨
+    if (!mUseSharedGeometry) {
+        LOGW("Baked models require shared geometry, enabling it");
+        mUseSharedGeometry = true;
+    }
+
+    // 1. 매핑 + 검사 (레코드는 매핑된 메모리에서 바로 읽고, 파싱 단계의 사본이 없음)
+    auto loadStart = std::chrono::steady_clock::now();
+    AssetUtils::MappedAsset mappedAsset;
+    BakedModel::View view;
+    if (!mappedAsset.open(assetManager, filename) || !BakedModel::parse(mappedAsset.getBytes(), view)) {
+        LOGE("Failed to load baked model: %s", filename.c_str());
+        return false;
+    }
+    if (view.header.vertexFormat != static_cast<uint32_t>(mGeometry.getVertexFormat())) {
+        LOGE("Baked model %s uses a different vertex format, bake it again with the renderer's format",
+             filename.c_str());
+        return false;
+    }
+
+    mUploadBatch = std::make_unique<VulkanUploadBatch>(mContext);
+    if (!mUploadBatch->begin()) return false;
+
+    // 2. 텍스처: 디코딩된 RGBA8 픽셀을 매핑에서 바로 스테이징으로 복사
+    for (const BakedModel::Texture& baked : view.textures) {
+        if (baked.width == 0) continue;
         auto texture = std::make_unique<VulkanTexture>(mContext);
-        // tinygltf는 이미지를 로드하여 image.image(vector<unsigned char>)에 담아둡니다.
-        if (texture->loadFromMemory(image.image.data(), image.width, image.height, VK_FORMAT_R8G8B8A8_SRGB)) {
+        if (texture->loadFromMemory(view.pixels.data + baked.pixelOffset, baked.width, baked.height,
+                                    VK_FORMAT_R8G8B8A8_SRGB, *mUploadBatch)) {
             mTextures.push_back(std::move(texture));
-            LOGI("Loaded glTF texture: %s (%dx%d)", image.name.c_str(), image.width, image.height);
         }
     }
+
+    // 3. 지오메트리: 정점/인덱스 섹션을 그대로 업로드하고 프리미티브/클러스터/LOD 표를 복사
+    VkIndexType indexType = view.header.indexSize == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    bool geometryUploaded = mGeometry.uploadPacked(*mUploadBatch, view.vertices.data, view.header.vertexCount,
+                                                   view.indices.data, view.header.indexCount, indexType);
+    auto toRange = [](const BakedModel::Range& baked) {
+        VulkanGeometryBuffer::Range range;
+        range.firstIndex = baked.firstIndex;
+        range.vertexOffset = baked.vertexOffset;
+        range.indexCount = baked.indexCount;
+        range.dequant = baked.dequant;
+        return range;
+    };
+    mMeshPrimitives.assign(view.meshes.count, PrimitiveSpan{});
+    mSkinnedMeshes.assign(view.meshes.count, SkinnedMesh{});
+    if (geometryUploaded) {
+        for (const BakedModel::Primitive& primitive : view.primitives) {
+            mPrimitiveRanges.push_back(toRange(primitive.lod0));
+            mPrimitiveClusters.push_back({ primitive.firstCluster, primitive.clusterCount });
+            mPrimitiveBounds.push_back(primitive.bounds);
+            mPrimitiveLods.push_back({ primitive.firstLod, primitive.lodCount });
+        }
+        mClusters.assign(view.clusters.begin(), view.clusters.end());
+        for (const BakedModel::LodLevel& level : view.lodLevels) {
+            mLodLevels.push_back({ toRange(level.range), level.error });
+        }
+        for (size_t i = 0; i < view.meshes.count; i++) {
+            mMeshPrimitives[i] = { view.meshes[i].firstPrimitive, view.meshes[i].primitiveCount };
+        }
+    }
+
+    // 4. 씬 그래프: 노드가 이미 평탄화 순서이므로 부모 인덱스로 자식 목록만 복원해 그대로 빌드
+    std::vector<SceneGraph::NodeDesc> nodes(view.nodes.count);
+    std::vector<int32_t> roots;
+    std::vector<AnimationPlayer::NodePose> restPose(view.nodes.count);
+    for (size_t i = 0; i < view.nodes.count; i++) {
+        const BakedModel::Node& node = view.nodes[i];
+        nodes[i].localMatrix = node.localMatrix;
+        nodes[i].mesh = node.mesh;
+        if (node.parent >= 0) {
+            nodes[node.parent].children.push_back(static_cast<int32_t>(i));
+        } else {
+            roots.push_back(static_cast<int32_t>(i));
+        }
+        restPose[i].translation = glm::make_vec3(node.translation);
+        restPose[i].rotation = glm::quat(node.rotation[3], node.rotation[0], node.rotation[1], node.rotation[2]);
+        restPose[i].scale = glm::make_vec3(node.scale);
+    }
+    mScene.build(nodes, roots);
+    mSceneNodeRemap.assign(view.nodeRemap.begin(), view.nodeRemap.end());
+
+    // 5. 애니메이션: 베이크 시 압축까지 끝난 클립
+    if (!view.clips.empty()) {
+        mAnimator.setup(BakedModel::readClips(view), std::move(restPose));
+        mAnimator.play(0);
+    }
+    setupAnimationLod();
+
+    if (!mUploadBatch->submit()) {
+        LOGE("Failed to submit model uploads: %s", filename.c_str());
+        return false;
+    }
+    auto loadEnd = std::chrono::steady_clock::now();
+    LOGI("Loaded baked model %s: %zu primitives, %zu textures, %zu clips (%.1f ms)", filename.c_str(),
+         mPrimitiveRanges.size(), mTextures.size(), view.clips.count,
+         std::chrono::duration<double, std::milli>(loadEnd - loadStart).count());
+    return true;
+}
+
+bool VulkanModel::pollUploadCompletion() {
+    if (!mUploadBatch) return true;
+    if (!mUploadBatch->isComplete()) return false;
+
+    mUploadBatch.reset();
+    return true;
+}
+
+void VulkanModel::decodeImage(const Gltf::Image& image, AssetUtils::ByteSpan encoded, ImportedImage& out) {
+    // 인코딩된 이미지(PNG/JPEG 등)를 RGBA8로 디코딩 (작업 스레드에서 호출)
+    int width = 0;
+    int height = 0;
+    int components = 0;
+    stbi_uc* pixels = nullptr;
+    if (encoded.size > 0 && encoded.size <= INT32_MAX) {
+        pixels = stbi_load_from_memory(encoded.data, static_cast<int>(encoded.size), &width, &height, &components,
+                                       STBI_rgb_alpha);
+    }
+    if (!pixels) {
+        LOGW("Failed to decode glTF image '%s'", image.name.c_str());
+        return;
+    }
+    out.pixels.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+    out.width = width;
+    out.height = height;
+    stbi_image_free(pixels);
+}
+
+void VulkanModel::loadTextures(std::vector<ImportedImage>& images, VulkanUploadBatch& uploadBatch) {
+    for (ImportedImage& image : images) loadTexture(image, uploadBatch);
 }
 
-void VulkanModel::processModel(const tinygltf::Model& model) {
-    for (const auto& mesh : model.meshes) {
+void VulkanModel::loadTexture(ImportedImage& image, VulkanUploadBatch& uploadBatch) {
+    if (image.pixels.empty()) return;
+    auto texture = std::make_unique<VulkanTexture>(mContext);
+    if (texture->loadFromMemory(image.pixels.data(), image.width, image.height, VK_FORMAT_R8G8B8A8_SRGB,
+                                uploadBatch)) {
+        mTextures.push_back(std::move(texture));
+        LOGI("Loaded glTF texture (%dx%d)", image.width, image.height);
+    }
+    // 스테이징에 복사했으므로 디코딩된 픽셀은 바로 해제
+    std::vector<unsigned char>().swap(image.pixels);
+}
+
+std::vector<VulkanModel::ImportedPrimitive> VulkanModel::collectPrimitives(const Gltf::Document& model) const {
+    // 스킨이 지정된 노드가 참조하는 메시는 GPU 스키닝 대상
+    // (스키닝 출력은 Vertex 레이아웃이므로 Compact 정점에서는 지원하지 않고 일반 메시로 취급)
+    std::vector<bool> skinnedMesh(model.meshes.size(), false);
+    for (const auto& node : model.nodes) {
+        if (node.skin < 0 || node.mesh < 0) continue;
+        if (mGeometry.getVertexFormat() == VertexFormat::Standard) {
+            skinnedMesh[node.mesh] = true;
+        } else {
+            LOGW("Skinning requires the standard vertex format, mesh %d is drawn in bind pose", node.mesh);
+        }
+    }
+
+    std::vector<ImportedPrimitive> primitives;
+    for (size_t meshIndex = 0; meshIndex < model.meshes.size(); meshIndex++) {
+        const auto& mesh = model.meshes[meshIndex];
+
+        // POSITION 모프 타깃이 있는 메시도 프레임마다 변형되므로 같은 변형 지오메트리 경로로 보냄
+        bool morphMesh = false;
         for (const auto& primitive : mesh.primitives) {
-            if (primitive.attributes.find("POSITION") == primitive.attributes.end()) continue;
-
-            std::vector<Vertex> vertices;
-            std::vector<uint32_t> indices;
-
-            // 1. POSITION 추출
-            const tinygltf::Accessor& posAccessor = model.accessors[primitive.attributes.at("POSITION")];
-            const tinygltf::BufferView& posView = model.bufferViews[posAccessor.bufferView];
-            const tinygltf::Buffer& posBuffer = model.buffers[posView.buffer];
-            const float* positions = reinterpret_cast<const float*>(&posBuffer.data[posView.byteOffset + posAccessor.byteOffset]);
-
-            vertices.resize(posAccessor.count);
-            for (size_t i = 0; i < posAccessor.count; i++) {
-                vertices[i].pos = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
-                vertices[i].color = glm::vec3(1.0f, 1.0f, 1.0f); // 기본 색상 (white)
-                vertices[i].texCoord = glm::vec2(0.0f, 0.0f);       // UV 초기화
+            morphMesh |= std::any_of(primitive.targetPositions.begin(), primitive.targetPositions.end(),
+                                     [](int32_t position) { return position >= 0; });
+        }
+        if (morphMesh && mGeometry.getVertexFormat() != VertexFormat::Standard) {
+            LOGW("Morph targets require the standard vertex format, mesh %zu is drawn without them", meshIndex);
+            morphMesh = false;
+        }
+
+        for (size_t p = 0; p < mesh.primitives.size(); p++) {
+            const auto& primitive = mesh.primitives[p];
+            int32_t position = primitive.attributes.position;
+            if (position < 0) continue;
+            ImportedPrimitive imported;
+            imported.mesh = static_cast<uint32_t>(meshIndex);
+            imported.primitive = static_cast<uint32_t>(p);
+            imported.skinned = skinnedMesh[meshIndex];
+            imported.morphed = morphMesh;
+            int32_t costAccessor = primitive.indices >= 0 ? primitive.indices : position;
+            imported.cost = static_cast<size_t>(model.accessors[costAccessor].count);
+            primitives.push_back(std::move(imported));
+        }
+    }
+    return primitives;
+}
+
+void VulkanModel::importPrimitive(const Gltf::Document& model, const BufferSpans& buffers,
+                                  ImportedPrimitive& out) const {
+    // 작업 스레드에서 호출: model/buffers와 설정만 읽고 결과는 out에만 기록
+    const Gltf::Primitive& primitive = model.meshes[out.mesh].primitives[out.primitive];
+    const Gltf::Attributes& attributes = primitive.attributes;
+    std::vector<Vertex>& vertices = out.vertices;
+    std::vector<uint32_t>& indices = out.indices;
+
+    // 1. POSITION 추출 (byteStride/normalized/sparse와 양자화 정수 타입은 AccessorDecoder가 처리)
+    std::vector<float> positions;
+    if (!readAccessorFloats(model, buffers, attributes.position, positions) ||
+        model.accessors[attributes.position].type != Gltf::AccessorType::Vec3) {
+        LOGW("Invalid POSITION accessor, skipping primitive");
+        return;
+    }
+    out.positionStep = getPositionStep(model.accessors[attributes.position]);
+    vertices.resize(positions.size() / 3);
+    for (size_t i = 0; i < vertices.size(); i++) {
+        vertices[i].pos = glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+        vertices[i].color = glm::vec3(1.0f, 1.0f, 1.0f); // 기본 색상 (white)
+        vertices[i].texCoord = glm::vec2(0.0f, 0.0f);       // UV 초기화
+    }
+
+    // 1.1 COLOR_0 추출 (존재하는 경우에만, VEC3/VEC4 float 또는 unorm8/unorm16)
+    std::vector<float> attribute;
+    if (attributes.color0 >= 0 && readAccessorFloats(model, buffers, attributes.color0, attribute)) {
+        size_t components = Gltf::getComponentCount(model.accessors[attributes.color0].type);
+        if (components >= 3 && attribute.size() == vertices.size() * components) {
+            for (size_t i = 0; i < vertices.size(); i++) {
+                const float* rgba = &attribute[i * components];
+                vertices[i].color = glm::vec3(rgba[0], rgba[1], rgba[2]);
             }
+            LOGI("Extracted COLOR_0 data for %zu vertices", vertices.size());
+        }
+    }
 
-            // 1.1 COLOR_0 추출 (존재하는 경우에만)
-            if (primitive.attributes.find("COLOR_0") != primitive.attributes.end()) {
-                const tinygltf::Accessor& colorAccessor = model.accessors[primitive.attributes.at("COLOR_0")];
-                const tinygltf::BufferView& colorView = model.bufferViews[colorAccessor.bufferView];
-                const tinygltf::Buffer& colorBuffer = model.buffers[colorView.buffer];
-                const unsigned char* colorData = &colorBuffer.data[colorView.byteOffset + colorAccessor.byteOffset];
-                int stride = colorAccessor.ByteStride(colorView);
-                for (size_t i = 0; i < colorAccessor.count; i++) {
-                    const float* rgba = reinterpret_cast<const float*>(colorData + i * stride);
-                    // glTF는 VEC3 또는 VEC4 색상을 가질 수 있습니다.
-                    vertices[i].color = glm::vec3(rgba[0], rgba[1], rgba[2]);
-                }
-                LOGI("Extracted COLOR_0 data for %zu vertices", colorAccessor.count);
+    // 1.2 TEXCOORD_0 추출 (float 또는 unorm8/unorm16)
+    if (attributes.texcoord0 >= 0 && readAccessorFloats(model, buffers, attributes.texcoord0, attribute) &&
+        attribute.size() == vertices.size() * 2) {
+        for (size_t i = 0; i < vertices.size(); i++) {
+            vertices[i].texCoord = glm::vec2(attribute[i * 2], attribute[i * 2 + 1]);
+        }
+        LOGI("Extracted TEXCOORD_0 data for %zu vertices", vertices.size());
+    }
+
+    // 2. INDICES 추출
+    if (primitive.indices >= 0) {
+        const Gltf::Accessor& indexAccessor = model.accessors[primitive.indices];
+        if (indexAccessor.bufferView < 0) {
+            LOGW("Index accessor without bufferView, skipping primitive");
+            return;
+        }
+        const Gltf::BufferView& indexView = model.bufferViews[indexAccessor.bufferView];
+        const AssetUtils::ByteSpan& indexBuffer = buffers[indexView.buffer];
+        size_t indexBegin = indexView.byteOffset + indexAccessor.byteOffset;
+        size_t indexSize = AccessorDecoder::getComponentSize(indexAccessor.componentType);
+        if (indexBegin + indexAccessor.count * indexSize > indexBuffer.size) {
+            LOGW("Index accessor out of buffer range, skipping primitive");
+            return;
+        }
+        const unsigned char* indexData = indexBuffer.data + indexBegin;
+
+        // 소스 타입(UNSIGNED_BYTE/SHORT/INT)과 무관하게 일단 32비트로 읽고, 업로드 시 범위에 맞게 축소
+        // (UNSIGNED_BYTE는 Vulkan 코어 인덱스 타입이 아니므로 반드시 16비트 이상으로 넓혀야 함)
+        indices.resize(indexAccessor.count);
+        if (indexAccessor.componentType == AccessorDecoder::UnsignedInt) {
+            const uint32_t* buf = reinterpret_cast<const uint32_t*>(indexData);
+            for (size_t i = 0; i < indexAccessor.count; i++) indices[i] = buf[i];
+        } else if (indexAccessor.componentType == AccessorDecoder::UnsignedShort) {
+            const uint16_t* buf = reinterpret_cast<const uint16_t*>(indexData);
+            for (size_t i = 0; i < indexAccessor.count; i++) indices[i] = buf[i];
+        } else if (indexAccessor.componentType == AccessorDecoder::UnsignedByte) {
+            const uint8_t* buf = reinterpret_cast<const uint8_t*>(indexData);
+            for (size_t i = 0; i < indexAccessor.count; i++) indices[i] = buf[i];
+        } else {
+            LOGW("Unsupported index component type %d, skipping primitive", indexAccessor.componentType);
+            return;
+        }
+
+        // 정점 범위를 벗어난 인덱스는 GPU에서 잘못된 메모리를 읽으므로 프리미티브를 건너뜀
+        uint32_t maxIndex = indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end());
+        if (maxIndex >= vertices.size()) {
+            LOGW("Index %u out of range (%zu vertices), skipping primitive", maxIndex, vertices.size());
+            return;
+        }
+    }
+
+    // 2.1 스킨/모프 메시: 정점 순서가 스킨 속성/모프 델타와 같아야 하므로 삼각형 순서만 최적화
+    //     (스킨이 없는 모프 메시는 스키닝 입력 정렬을 위해 빈 스킨 속성을 채움)
+    if (out.skinned || out.morphed) {
+        if (!out.skinned) {
+            out.skinVertices.assign(vertices.size(), SkinVertex{});
+        } else if (!readSkinAttributes(model, buffers, primitive, vertices.size(), out.skinVertices, out.jointCount)) {
+            LOGW("Skinned mesh %u: missing or invalid JOINTS_0/WEIGHTS_0, skipping primitive", out.mesh);
+            return;
+        }
+        if (out.morphed) {
+            out.targetCount = readMorphTargets(model, buffers, primitive, vertices.size(), out.vertexDeltas);
+        }
+        if (!indices.empty()) {
+            MeshOptimizer::optimizeVertexCache(indices, vertices.size());
+            MeshOptimizer::optimizeOverdraw(indices, vertices);
+        }
+        out.valid = !vertices.empty();
+        return;
+    }
+
+    // 3. 메시 최적화: 중복 정점 용접 -> 정점 캐시 -> 오버드로 -> 정점 페치 순서로 재배치
+    //    (결정적이므로 같은 입력이면 항상 같은 버퍼가 만들어짐)
+    size_t sourceVertexCount = vertices.size();
+    MeshOptimizer::CacheStats before = MeshOptimizer::analyzeVertexCache(indices, vertices.size());
+    MeshOptimizer::optimize(vertices, indices);
+    MeshOptimizer::CacheStats after = MeshOptimizer::analyzeVertexCache(indices, vertices.size());
+    LOGD("Optimized primitive: vertices %zu -> %zu, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+         sourceVertexCount, vertices.size(), before.acmr, after.acmr, before.atvr, after.atvr);
+
+    // 4. 공유 지오메트리 모드에서는 클러스터와 LOD 체인까지 미리 계산
+    if (mUseSharedGeometry) {
+        // 4.1 클러스터 분할: 큰 프리미티브는 메시렛(최대 64정점/124삼각형)으로 나누고 인덱스를 재배치,
+        //     작은 프리미티브는 전체를 하나의 클러스터로 취급
+        if (indices.size() / 3 >= kMinTrianglesForMeshlets) {
+            out.clusters = MeshletBuilder::build(vertices, indices);
+            // 삼각형 순서가 바뀌었으므로 정점 페치 순서도 다시 맞춤 (인덱스 값만 바뀌고 구간은 유지)
+            MeshOptimizer::optimizeVertexFetch(vertices, indices);
+            LOGD("Split primitive into %zu meshlets", out.clusters.size());
+        } else {
+            out.clusters.push_back(MeshletBuilder::computeCluster(vertices, indices, 0,
+                                                                  static_cast<uint32_t>(indices.size())));
+        }
+        out.bounds = MeshletBuilder::computeCluster(vertices, indices, 0, static_cast<uint32_t>(indices.size()));
+
+        // 4.2 LOD 체인: 엣지 붕괴로 단순화한 인덱스 (같은 정점 구간 위에 추가됨)
+        out.lods = MeshSimplifier::buildLodChain(vertices, indices);
+    }
+    out.valid = true;
+}
+
+void VulkanModel::processModel(const Gltf::Document& model, std::vector<ImportedPrimitive>& primitives,
+                               VulkanUploadBatch* uploadBatch) {
+    mMeshPrimitives.assign(model.meshes.size(), PrimitiveSpan{});
+    mSkinnedMeshes.assign(model.meshes.size(), SkinnedMesh{});
+
+    // 작업 결과를 원래 순서(메시, 프리미티브)대로 버퍼에 추가. 추가한 프리미티브의 CPU 데이터는 바로 해제
+    for (ImportedPrimitive& slot : primitives) addPrimitive(slot, uploadBatch);
+
+    // 베이크: 업로드 없이 CPU 측 버퍼와 프리미티브 표까지만
+    if (!uploadBatch) return;
+    uploadGeometry(model, *uploadBatch);
+}
+
+void VulkanModel::addPrimitive(ImportedPrimitive& slot, VulkanUploadBatch* uploadBatch) {
+    ImportedPrimitive imported = std::move(slot);
+    if (!imported.valid) return;
+    std::vector<Vertex>& vertices = imported.vertices;
+    std::vector<uint32_t>& indices = imported.indices;
+
+    // 1. 스킨/모프 메시: 변형 지오메트리에 추가
+    if (imported.skinned || imported.morphed) {
+        SkinnedMesh& skinned = mSkinnedMeshes[imported.mesh];
+        if (skinned.primitiveCount == 0) {
+            skinned.firstPrimitive = static_cast<uint32_t>(mSkinnedRanges.size());
+            skinned.firstVertex = static_cast<uint32_t>(mSkinVertices.size());
+            skinned.boundsMin = skinned.boundsMax = vertices[0].pos;
+        }
+        for (const Vertex& vertex : vertices) {
+            skinned.boundsMin = glm::min(skinned.boundsMin, vertex.pos);
+            skinned.boundsMax = glm::max(skinned.boundsMax, vertex.pos);
+        }
+        VulkanGeometryBuffer::Range range = mSkinnedGeometry.append(vertices, indices);
+        mSkinnedRanges.push_back(range);
+        mSkinVertices.insert(mSkinVertices.end(), imported.skinVertices.begin(), imported.skinVertices.end());
+        skinned.primitiveCount++;
+        skinned.vertexCount += static_cast<uint32_t>(vertices.size());
+        skinned.jointCount = std::max(skinned.jointCount, imported.jointCount);
+
+        // 1.1 델타가 있는 정점만 MorphVertex로 패킹 (타깃 인덱스는 메시 가중치 기준, 프리미티브끼리 공유)
+        if (imported.targetCount > 0) {
+            if (skinned.morphVertexCount == 0) {
+                skinned.firstMorphVertex = static_cast<uint32_t>(mMorphVertices.size());
+            }
+            for (size_t v = 0; v < vertices.size(); v++) {
+                const std::vector<MorphDelta>& deltas = imported.vertexDeltas[v];
+                if (deltas.empty()) continue;
+                MorphVertex morph{};
+                morph.base[0] = vertices[v].pos.x;
+                morph.base[1] = vertices[v].pos.y;
+                morph.base[2] = vertices[v].pos.z;
+                morph.vertex = static_cast<uint32_t>(range.vertexOffset + static_cast<int32_t>(v));
+                mMorphVertices.push_back(morph);
+                mMorphDeltas.insert(mMorphDeltas.end(), deltas.begin(), deltas.end());
+                mMorphDeltaCounts.push_back(static_cast<uint32_t>(deltas.size()));
+                skinned.morphVertexCount++;
             }
+            skinned.targetCount = std::max(skinned.targetCount, imported.targetCount);
+        }
+        return;
+    }
+
+    // 2. 공유 지오메트리 버퍼에 범위로 추가하거나, 프리미티브 전용 VulkanMesh 생성
+    PrimitiveSpan& span = mMeshPrimitives[imported.mesh];
+    if (span.primitiveCount == 0) {
+        span.firstPrimitive = static_cast<uint32_t>(mUseSharedGeometry ? mPrimitiveRanges.size() : mMeshes.size());
+    }
+    if (mUseSharedGeometry) {
+        ClusterRange clusterRange;
+        clusterRange.firstCluster = static_cast<uint32_t>(mClusters.size());
+        clusterRange.clusterCount = static_cast<uint32_t>(imported.clusters.size());
+        mClusters.insert(mClusters.end(), imported.clusters.begin(), imported.clusters.end());
+        mPrimitiveClusters.push_back(clusterRange);
+        mPrimitiveBounds.push_back(imported.bounds);
+
+        VulkanGeometryBuffer::Range lod0 = mGeometry.append(vertices, indices, imported.positionStep);
+        mPrimitiveRanges.push_back(lod0);
+
+        LodRange lodRange;
+        lodRange.firstLevel = static_cast<uint32_t>(mLodLevels.size());
+        for (const auto& level : imported.lods) {
+            mLodLevels.push_back({ mGeometry.appendIndices(lod0, level.indices), level.error });
+            LOGD("  LOD%u: %zu triangles, error %.5f", static_cast<uint32_t>(mLodLevels.size()) -
+                 lodRange.firstLevel, level.indices.size() / 3, level.error);
+        }
+        lodRange.levelCount = static_cast<uint32_t>(mLodLevels.size()) - lodRange.firstLevel;
+        mPrimitiveLods.push_back(lodRange);
+    } else if (!indices.empty() && vertices.size() <= UINT16_MAX + 1) {
+        // 정점 수가 65536 이하면 16비트 인덱스로 축소 (인덱스 메모리/대역폭 절반)
+        std::vector<uint16_t> indices16(indices.begin(), indices.end());
+        mMeshes.push_back(std::make_unique<VulkanMesh>(mContext, *uploadBatch, vertices, indices16));
+    } else {
+        mMeshes.push_back(std::make_unique<VulkanMesh>(mContext, *uploadBatch, vertices, indices));
+    }
+    span.primitiveCount++;
+
+    // Debugging: 처음 10개의 정점 데이터 출력
+    LOGV("Mesh Primitive: Vertex Count = %zu, Index Count = %zu", vertices.size(), indices.size());
+    for (size_t i = 0; i < std::min(vertices.size(), size_t(10)); ++i) {
+        LOGV("  Vertex[%zu]: pos(%.2f, %.2f, %.2f), color(%.2f, %.2f, %.2f), uv(%.2f, %.2f)",
+             i,
+             vertices[i].pos.x, vertices[i].pos.y, vertices[i].pos.z,
+             vertices[i].color.r, vertices[i].color.g, vertices[i].color.b,
+             vertices[i].texCoord.x, vertices[i].texCoord.y);
+    }
+}
+
+void VulkanModel::uploadGeometry(const Gltf::Document& model, VulkanUploadBatch& uploadBatch) {
+    // 5. 모든 프리미티브를 모은 뒤 공유 버퍼를 한 번에 업로드 (스트리밍 중이면 이미 기록된 버퍼를 마무리)
+    if (mGeometry.isStreaming() && mPrimitiveRanges.empty()) mGeometry.endStreaming();
+    if (mUseSharedGeometry && !mPrimitiveRanges.empty()) {
+        bool uploaded = mGeometry.isStreaming() ? mGeometry.endStreaming() : mGeometry.upload(uploadBatch);
+        if (!uploaded) {
+            mPrimitiveRanges.clear();
+            mPrimitiveClusters.clear();
+            mClusters.clear();
+            mPrimitiveBounds.clear();
+            mPrimitiveLods.clear();
+            mLodLevels.clear();
+            mMeshPrimitives.assign(model.meshes.size(), PrimitiveSpan{});
+        } else {
+            LOGI("Packed %zu primitives (%zu clusters, %zu LOD levels) into shared geometry buffers",
+                 mPrimitiveRanges.size(), mClusters.size(), mLodLevels.size());
+        }
+    }
+
+    // 6. 스킨 메시: 원본 정점(컴퓨트 입력 겸 바인드 포즈 폴백)과 스킨 속성을 업로드
+    if (mSkinnedGeometry.isStreaming() && mSkinnedRanges.empty()) mSkinnedGeometry.endStreaming();
+    if (!mSkinnedRanges.empty()) {
+        bool uploaded = mSkinnedGeometry.isStreaming()
+                        ? mSkinnedGeometry.endStreaming()
+                        : mSkinnedGeometry.upload(uploadBatch, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        if (uploaded) {
+            mSkinVertexBuffer = uploadBatch.createDeviceBuffer(mSkinVertices.data(),
+                                                               sizeof(SkinVertex) * mSkinVertices.size(),
+                                                               VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        }
+        if (!mSkinnedGeometry.isUploaded() || !mSkinVertexBuffer || !mSkinVertexBuffer->isValid()) {
+            LOGE("Failed to upload skinned geometry");
+            mSkinVertexBuffer.reset();
+            mSkinnedRanges.clear();
+            mSkinnedMeshes.assign(model.meshes.size(), SkinnedMesh{});
+        }
+        std::vector<SkinVertex>().swap(mSkinVertices);
+    }
 
-            // 1.2 TEXCOORD_0 추출 (추가됨)
-            if (primitive.attributes.find("TEXCOORD_0") != primitive.attributes.end()) {
-                const tinygltf::Accessor& uvAccessor = model.accessors[primitive.attributes.at("TEXCOORD_0")];
-                const tinygltf::BufferView& uvView = model.bufferViews[uvAccessor.bufferView];
-                const tinygltf::Buffer& uvBuffer = model.buffers[uvView.buffer];
-                const unsigned char* uvData = &uvBuffer.data[uvView.byteOffset + uvAccessor.byteOffset];
-                int stride = uvAccessor.ByteStride(uvView);
-                for (size_t i = 0; i < uvAccessor.count; i++) {
-                    const float* uvs = reinterpret_cast<const float*>(uvData + i * stride);
-                    vertices[i].texCoord = glm::vec2(uvs[0], uvs[1]);
+    // 7. 모프 타깃: 델타가 있는 정점과 델타를 패킹한 버퍼 (변형 지오메트리가 업로드된 경우에만)
+    if (!mMorphVertices.empty() && mSkinnedGeometry.isUploaded()) {
+        // 7.1 델타는 메시마다 target-major로 펼침: 타깃 하나 = 모프 정점 수만큼의 연속 구간
+        //     (셰이더가 가중치 0인 타깃의 델타를 아예 읽지 않도록. 영향받는 정점만 담으므로 sparse가 아닌 glTF 타깃 접근자보다 작음)
+        std::vector<float> deltas;
+        size_t source = 0;
+        for (SkinnedMesh& skinned : mSkinnedMeshes) {
+            if (skinned.morphVertexCount == 0) continue;
+            skinned.firstMorphDelta = static_cast<uint32_t>(deltas.size() / 3);
+            deltas.resize(deltas.size() + static_cast<size_t>(skinned.targetCount) * skinned.morphVertexCount * 3,
+                          0.0f);
+            for (uint32_t i = 0; i < skinned.morphVertexCount; i++) {
+                for (uint32_t d = 0; d < mMorphDeltaCounts[skinned.firstMorphVertex + i]; d++, source++) {
+                    const MorphDelta& delta = mMorphDeltas[source];
+                    size_t dst = (skinned.firstMorphDelta + static_cast<size_t>(delta.target) *
+                                  skinned.morphVertexCount + i) * 3;
+                    std::copy_n(delta.delta, 3, &deltas[dst]);
                 }
-                LOGI("Extracted TEXCOORD_0 data for %zu vertices", uvAccessor.count);
             }
+        }
+        std::vector<MorphDelta>().swap(mMorphDeltas);
+
+        mMorphVertexBuffer = uploadBatch.createDeviceBuffer(mMorphVertices.data(),
+                                                            sizeof(MorphVertex) * mMorphVertices.size(),
+                                                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        mMorphDeltaBuffer = uploadBatch.createDeviceBuffer(deltas.data(), sizeof(float) * deltas.size(),
+                                                           VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        if (!mMorphVertexBuffer || !mMorphVertexBuffer->isValid() || !mMorphDeltaBuffer ||
+            !mMorphDeltaBuffer->isValid()) {
+            LOGE("Failed to upload morph targets");
+            mMorphVertexBuffer.reset();
+            mMorphDeltaBuffer.reset();
+        } else {
+            LOGI("Packed %zu morph vertices, %zu deltas (%zu KB)", mMorphVertices.size(), deltas.size() / 3,
+                 (sizeof(MorphVertex) * mMorphVertices.size() + sizeof(float) * deltas.size()) / 1024);
+        }
+    }
+    std::vector<MorphVertex>().swap(mMorphVertices);
+    std::vector<MorphDelta>().swap(mMorphDeltas);
+    std::vector<uint32_t>().swap(mMorphDeltaCounts);
+}
+
+void VulkanModel::loadScene(const Gltf::Document& model) {
+    // 1. glTF 노드를 빌드 입력으로 변환 (matrix가 있으면 그대로, 없으면 T * R * S)
+    std::vector<SceneGraph::NodeDesc> nodes(model.nodes.size());
+    for (size_t i = 0; i < model.nodes.size(); i++) {
+        const Gltf::Node& node = model.nodes[i];
+        SceneGraph::NodeDesc& desc = nodes[i];
+        desc.mesh = node.mesh;
+        desc.children.assign(node.children.begin(), node.children.end());
+
+        if (node.hasMatrix) {
+            desc.localMatrix = glm::make_mat4(node.matrix); // glTF도 column-major
+        } else {
+            AnimationPlayer::NodePose pose = readNodePose(node);
+            desc.localMatrix = SceneGraph::composeTransform(pose.translation, pose.rotation, pose.scale);
+        }
+    }
+
+    // 2. 루트: 기본 씬(없으면 첫 씬)의 노드. 씬이 없으면 부모가 없는 모든 노드
+    std::vector<int32_t> roots;
+    if (!model.scenes.empty()) {
+        int sceneIndex = model.defaultScene >= 0 ? model.defaultScene : 0;
+        roots.assign(model.scenes[sceneIndex].nodes.begin(), model.scenes[sceneIndex].nodes.end());
+    } else {
+        std::vector<bool> hasParent(nodes.size(), false);
+        for (const auto& desc : nodes) {
+            for (int32_t child : desc.children) hasParent[child] = true;
+        }
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (!hasParent[i]) roots.push_back(static_cast<int32_t>(i));
+        }
+    }
+
+    // 3. 노드가 하나도 없는 파일은 메시마다 항등 행렬 노드를 만들어 기존처럼 모두 그림
+    if (nodes.empty()) {
+        for (size_t i = 0; i < model.meshes.size(); i++) {
+            SceneGraph::NodeDesc desc;
+            desc.mesh = static_cast<int32_t>(i);
+            nodes.push_back(desc);
+            roots.push_back(static_cast<int32_t>(i));
+        }
+    }
 
-            // 2. INDICES 추출
-            if (primitive.indices >= 0) {
-                const tinygltf::Accessor& indexAccessor = model.accessors[primitive.indices];
-                const tinygltf::BufferView& indexView = model.bufferViews[indexAccessor.bufferView];
-                const tinygltf::Buffer& indexBuffer = model.buffers[indexView.buffer];
-                const unsigned char* indexData = &indexBuffer.data[indexView.byteOffset + indexAccessor.byteOffset];
-
-                indices.resize(indexAccessor.count);
-                if (indexAccessor.componentType == TINYGLTF_PARAMETER_TYPE_UNSIGNED_INT) {
-                    const uint32_t* buf = reinterpret_cast<const uint32_t*>(indexData);
-                    for (size_t i = 0; i < indexAccessor.count; i++) indices[i] = buf[i];
-                } else if (indexAccessor.componentType == TINYGLTF_PARAMETER_TYPE_UNSIGNED_SHORT) {
-                    const uint16_t* buf = reinterpret_cast<const uint16_t*>(indexData);
-                    for (size_t i = 0; i < indexAccessor.count; i++) indices[i] = buf[i];
-                } else if (indexAccessor.componentType == TINYGLTF_PARAMETER_TYPE_UNSIGNED_BYTE) {
-                    const uint8_t* buf = reinterpret_cast<const uint8_t*>(indexData);
-                    for (size_t i = 0; i < indexAccessor.count; i++) indices[i] = buf[i];
+    mSceneNodeRemap = mScene.build(nodes, roots);
+    if (model.nodes.empty()) mSceneNodeRemap.clear();
+    LOGI("Scene graph: %u nodes, %zu mesh instances", mScene.getNodeCount(), mScene.getMeshNodes().size());
+}
+
+int32_t VulkanModel::getSceneNodeIndex(int32_t gltfNode) const {
+    if (gltfNode < 0 || static_cast<size_t>(gltfNode) >= mSceneNodeRemap.size()) return -1;
+    return mSceneNodeRemap[gltfNode];
+}
+
+void VulkanModel::loadSkins(const Gltf::Document& model, const BufferSpans& buffers, AAssetManager* assetManager,
+                            uint32_t framesInFlight) {
+    if (mSkinnedRanges.empty()) return;
+
+    // 1. 스킨: 조인트를 씬 그래프 노드로, inverseBindMatrices를 행렬로 (없으면 항등)
+    for (const auto& skin : model.skins) {
+        Skin out;
+        out.joints.reserve(skin.joints.size());
+        for (int joint : skin.joints) out.joints.push_back(getSceneNodeIndex(joint));
+        out.inverseBindMatrices.assign(skin.joints.size(), glm::mat4(1.0f));
+        std::vector<float> matrices;
+        if (skin.inverseBindMatrices >= 0) {
+            if (readAccessorFloats(model, buffers, skin.inverseBindMatrices, matrices) &&
+                matrices.size() >= skin.joints.size() * 16) {
+                for (size_t j = 0; j < skin.joints.size(); j++) {
+                    out.inverseBindMatrices[j] = glm::make_mat4(&matrices[j * 16]);
                 }
+            } else {
+                LOGW("Skin '%s': invalid inverseBindMatrices, using identity", skin.name.c_str());
             }
+        }
+        mSkins.push_back(std::move(out));
+    }
+
+    // 2. 인스턴스: 기본 씬에 있는, 스킨과 스킨 메시를 가진 노드마다 출력 구간과 팔레트 구간을 할당
+    uint32_t outputVertexCount = 0;
+    uint32_t jointCount = 0;
+    mNodeSkinInstance.assign(mScene.getNodeCount(), -1);
+    for (size_t i = 0; i < model.nodes.size(); i++) {
+        const Gltf::Node& node = model.nodes[i];
+        int32_t sceneNode = getSceneNodeIndex(static_cast<int32_t>(i));
+        if (sceneNode < 0 || node.skin < 0 || static_cast<size_t>(node.skin) >= mSkins.size() || node.mesh < 0 ||
+            static_cast<size_t>(node.mesh) >= mSkinnedMeshes.size() || mSkinnedMeshes[node.mesh].primitiveCount == 0) {
+            continue;
+        }
+        const Skin& skin = mSkins[node.skin];
+        const SkinnedMesh& skinned = mSkinnedMeshes[node.mesh];
+        bool jointsInScene = std::all_of(skin.joints.begin(), skin.joints.end(), [](int32_t j) { return j >= 0; });
+        if (skinned.jointCount > skin.joints.size() || !jointsInScene) {
+            LOGW("Node %zu: skin %d does not match mesh %d, drawing in bind pose", i, node.skin, node.mesh);
+            continue;
+        }
+
+        SkinInstance instance;
+        instance.node = static_cast<uint32_t>(sceneNode);
+        instance.skin = static_cast<uint32_t>(node.skin);
+        instance.outputVertex = outputVertexCount;
+        instance.firstJoint = jointCount;
+        mNodeSkinInstance[sceneNode] = static_cast<int32_t>(mSkinInstances.size());
+        mSkinInstances.push_back(instance);
+        mSkinDispatches.push_back({ skinned.firstVertex, instance.outputVertex, skinned.vertexCount,
+                                    instance.firstJoint });
+        outputVertexCount += skinned.vertexCount;
+        jointCount += static_cast<uint32_t>(skin.joints.size());
+    }
+    if (mSkinInstances.empty()) return;
+
+    // 3. 컴퓨트 스키닝 자원 (실패하면 스킨 메시를 바인드 포즈로 그림)
+    mSkinning = std::make_unique<VulkanSkinning>(mContext, std::max(1u, framesInFlight));
+    if (!mSkinning->initialize(assetManager, mSkinnedGeometry.getVertexBuffer(), mSkinVertexBuffer->getBuffer(),
+                               outputVertexCount, jointCount)) {
+        LOGW("GPU skinning unavailable, skinned meshes are drawn in bind pose");
+        mSkinning.reset();
+        return;
+    }
+    LOGI("Loaded %zu skins, %zu skinned instances", mSkins.size(), mSkinInstances.size());
+}
+
+void VulkanModel::loadMorphTargets(const Gltf::Document& model, AAssetManager* assetManager,
+                                   uint32_t framesInFlight) {
+    if (!mMorphVertexBuffer || !mMorphDeltaBuffer) return;
+
+    // 1. 모프 메시마다 가중치 구간을 할당하고, 메시를 참조하는 첫 씬 노드를 가중치 출처로 사용
+    //    (기본 가중치: 노드 weights, 없으면 메시 weights, 모자라면 0)
+    uint32_t weightCount = 0;
+    for (size_t meshIndex = 0; meshIndex < mSkinnedMeshes.size(); meshIndex++) {
+        const SkinnedMesh& skinned = mSkinnedMeshes[meshIndex];
+        if (skinned.morphVertexCount == 0) continue;
+
+        MorphMesh morph;
+        morph.mesh = static_cast<uint32_t>(meshIndex);
+        morph.firstWeight = weightCount;
+        morph.targetCount = skinned.targetCount;
+        const Gltf::Span<float>* defaults = &model.meshes[meshIndex].weights;
+        for (size_t i = 0; i < model.nodes.size(); i++) {
+            int32_t sceneNode = getSceneNodeIndex(static_cast<int32_t>(i));
+            if (sceneNode < 0 || model.nodes[i].mesh != static_cast<int>(meshIndex)) continue;
+            morph.node = sceneNode;
+            if (!model.nodes[i].weights.empty()) defaults = &model.nodes[i].weights;
+            break;
+        }
+        morph.defaultWeights.assign(morph.targetCount, 0.0f);
+        for (size_t t = 0; t < std::min(defaults->size(), morph.defaultWeights.size()); t++) {
+            morph.defaultWeights[t] = (*defaults)[t];
+        }
+        weightCount += morph.targetCount;
+        mMorphMeshes.push_back(std::move(morph));
+    }
+    if (mMorphMeshes.empty()) return;
 
-            // 3. VulkanMesh 생성
-            mMeshes.push_back(std::make_unique<VulkanMesh>(mContext, vertices, indices));
-
-            // Debugging: 처음 10개의 정점 데이터 출력
-            LOGV("Mesh Primitive: Vertex Count = %zu, Index Count = %zu", vertices.size(), indices.size());
-            for (size_t i = 0; i < std::min(vertices.size(), size_t(10)); ++i) {
-                LOGV("  Vertex[%zu]: pos(%.2f, %.2f, %.2f), color(%.2f, %.2f, %.2f), uv(%.2f, %.2f)",
-                     i,
-                     vertices[i].pos.x, vertices[i].pos.y, vertices[i].pos.z,
-                     vertices[i].color.r, vertices[i].color.g, vertices[i].color.b,
-                     vertices[i].texCoord.x, vertices[i].texCoord.y);
+    // 2. 정점 버퍼에는 바인드 포즈(가중치 0)가 들어 있으므로 마지막 가중치를 0으로 두면
+    //    기본 가중치가 0이 아닌 메시는 첫 프레임에 디스패치됨
+    mMorphLastWeights.assign(weightCount, 0.0f);
+    mMorphPendingWeights.assign(weightCount, 0.0f);
+    mMorphing = std::make_unique<VulkanMorphTargets>(mContext, std::max(1u, framesInFlight));
+    if (!mMorphing->initialize(assetManager, mSkinnedGeometry.getVertexBuffer(), mMorphVertexBuffer->getBuffer(),
+                               mMorphDeltaBuffer->getBuffer(), weightCount)) {
+        LOGW("GPU morph targets unavailable, morph meshes are drawn in bind pose");
+        mMorphing.reset();
+        mMorphMeshes.clear();
+        return;
+    }
+    LOGI("Loaded %zu morph meshes, %u weights", mMorphMeshes.size(), weightCount);
+}
+
+void VulkanModel::setupAnimationLod() {
+    if (!mAnimator.getClipCount()) return;
+
+    // 1. 객체 후보 = 최상위 서브트리. 루트가 하나뿐이면(좌표계 변환용 래퍼 노드 등) 그 자식 서브트리
+    //    객체에 속하지 않은 노드(단일 루트 자신)는 항상 갱신
+    const uint32_t nodeCount = mScene.getNodeCount();
+    std::vector<uint32_t> objectRoots;
+    for (uint32_t node = 0; node < nodeCount; node += mScene.getSubtreeSize(node)) objectRoots.push_back(node);
+    if (objectRoots.size() == 1 && mScene.getSubtreeSize(0) > 1) {
+        objectRoots.clear();
+        for (uint32_t node = 1; node < nodeCount; node += mScene.getSubtreeSize(node)) objectRoots.push_back(node);
+    }
+    std::vector<int32_t> nodeObjects(nodeCount, -1);
+    for (size_t i = 0; i < objectRoots.size(); i++) {
+        uint32_t root = objectRoots[i];
+        std::fill_n(nodeObjects.begin() + root, mScene.getSubtreeSize(root), static_cast<int32_t>(i));
+    }
+
+    // 2. 스킨 메시 노드와 조인트가 다른 서브트리에 있으면 한 객체로 합침 (조인트만 갱신되고 메시는 멈추는 일 방지)
+    std::vector<int32_t> parent(objectRoots.size());
+    for (size_t i = 0; i < parent.size(); i++) parent[i] = static_cast<int32_t>(i);
+    auto find = [&](int32_t object) {
+        while (parent[object] != object) object = parent[object] = parent[parent[object]];
+        return object;
+    };
+    for (const SkinInstance& instance : mSkinInstances) {
+        int32_t meshObject = nodeObjects[instance.node];
+        for (int32_t joint : mSkins[instance.skin].joints) {
+            int32_t jointObject = nodeObjects[joint];
+            if (meshObject < 0 || jointObject < 0) continue;
+            parent[find(jointObject)] = find(meshObject);
+        }
+    }
+
+    // 3. 애니메이션 채널이 구동하는 객체만 남겨 번호를 다시 매김
+    std::vector<uint8_t> animated(objectRoots.size(), 0);
+    for (uint32_t c = 0; c < mAnimator.getClipCount(); c++) {
+        for (const auto& channel : mAnimator.getClip(c).channels) {
+            int32_t object = nodeObjects[channel.targetNode];
+            if (object >= 0) animated[find(object)] = 1;
+        }
+    }
+    std::vector<int32_t> remap(objectRoots.size(), -1);
+    uint32_t objectCount = 0;
+    for (size_t i = 0; i < objectRoots.size(); i++) {
+        if (animated[i] && find(static_cast<int32_t>(i)) == static_cast<int32_t>(i)) {
+            remap[i] = static_cast<int32_t>(objectCount++);
+        }
+    }
+    for (auto& object : nodeObjects) {
+        if (object >= 0) object = remap[find(object)];
+    }
+
+    // 4. 바운딩 구 재료: 정적 메시는 프리미티브 구를 합친 메시 구, 스킨 인스턴스는 바인드 포즈 구
+    //    바운딩 정보가 없는 메시(프리미티브별 VulkanMesh)를 가진 객체는 항상 갱신
+    std::vector<uint8_t> unbounded(objectCount, 0);
+    for (uint32_t node : mScene.getMeshNodes()) {
+        int32_t object = nodeObjects[node];
+        if (object < 0) continue;
+        int32_t mesh = mScene.getMesh(node);
+
+        LodBoundsSource source;
+        source.object = static_cast<uint32_t>(object);
+        source.node = node;
+        int32_t instance = mNodeSkinInstance.empty() ? -1 : mNodeSkinInstance[node];
+        const SkinnedMesh& skinned = mSkinnedMeshes[mesh];
+        const PrimitiveSpan& span = mMeshPrimitives[mesh];
+        if (skinned.primitiveCount > 0) {
+            source.center = (skinned.boundsMin + skinned.boundsMax) * 0.5f;
+            source.radius = glm::length(skinned.boundsMax - skinned.boundsMin) * 0.5f;
+            source.skinInstance = mSkinning ? instance : -1;
+            mLodBoundsSources.push_back(source);
+        }
+        if (span.primitiveCount == 0) continue;
+        if (!mUseSharedGeometry || mPrimitiveBounds.empty()) {
+            unbounded[object] = 1;
+            continue;
+        }
+        glm::vec3 boundsMin(FLT_MAX);
+        glm::vec3 boundsMax(-FLT_MAX);
+        for (uint32_t p = 0; p < span.primitiveCount; p++) {
+            const MeshletBuilder::Meshlet& bounds = mPrimitiveBounds[span.firstPrimitive + p];
+            boundsMin = glm::min(boundsMin, bounds.center - glm::vec3(bounds.radius));
+            boundsMax = glm::max(boundsMax, bounds.center + glm::vec3(bounds.radius));
+        }
+        source.center = (boundsMin + boundsMax) * 0.5f;
+        source.radius = glm::length(boundsMax - boundsMin) * 0.5f;
+        source.skinInstance = -1;
+        mLodBoundsSources.push_back(source);
+    }
+    // 메시가 없는 객체(카메라/조명 등)나 바운딩 정보가 없는 객체는 판정할 수 없으므로 항상 갱신
+    std::vector<uint8_t> hasBounds(objectCount, 0);
+    for (const LodBoundsSource& source : mLodBoundsSources) hasBounds[source.object] = 1;
+    for (auto& object : nodeObjects) {
+        if (object >= 0 && (unbounded[object] || !hasBounds[object])) object = -1;
+    }
+    mLodBoundsSources.erase(std::remove_if(mLodBoundsSources.begin(), mLodBoundsSources.end(),
+                                           [&](const LodBoundsSource& source) {
+                                               return unbounded[source.object] != 0;
+                                           }),
+                            mLodBoundsSources.end());
+
+    mLodBoundsMin.assign(objectCount, glm::vec3(0.0f));
+    mLodBoundsMax.assign(objectCount, glm::vec3(0.0f));
+    mAnimationLod.setup(std::move(nodeObjects), objectCount);
+    LOGI("Animation LOD: %u objects, %zu bounds sources", objectCount, mLodBoundsSources.size());
+}
+
+void VulkanModel::updateAnimationLod() {
+    // 1. 객체별 월드 AABB (이전 프레임 포즈 기준, 한 프레임 늦어도 가시성/크기 판정에는 충분)
+    const uint32_t objectCount = mAnimationLod.getObjectCount();
+    std::fill(mLodBoundsMin.begin(), mLodBoundsMin.end(), glm::vec3(FLT_MAX));
+    std::fill(mLodBoundsMax.begin(), mLodBoundsMax.end(), glm::vec3(-FLT_MAX));
+    for (const LodBoundsSource& source : mLodBoundsSources) {
+        const glm::mat4& world = mScene.getWorldMatrix(source.node);
+        float scale = std::sqrt(std::max({ glm::dot(world[0], world[0]), glm::dot(world[1], world[1]),
+                                           glm::dot(world[2], world[2]) }));
+        glm::vec3 center = glm::vec3(world * glm::vec4(source.center, 1.0f));
+        float radius = source.radius * scale;
+        glm::vec3& boundsMin = mLodBoundsMin[source.object];
+        glm::vec3& boundsMax = mLodBoundsMax[source.object];
+
+        if (source.skinInstance >= 0) {
+            // 스킨 메시는 조인트를 따라 움직이므로 조인트 위치의 AABB 중심을 쓰고,
+            // 조인트 구는 살(메시 두께)을 포함하지 않으므로 넓히되 바인드 포즈 구보다 작아지지 않게 함
+            const Skin& skin = mSkins[mSkinInstances[source.skinInstance].skin];
+            glm::vec3 jointMin(FLT_MAX);
+            glm::vec3 jointMax(-FLT_MAX);
+            for (int32_t joint : skin.joints) {
+                glm::vec3 position = glm::vec3(mScene.getWorldMatrix(static_cast<uint32_t>(joint))[3]);
+                jointMin = glm::min(jointMin, position);
+                jointMax = glm::max(jointMax, position);
             }
+            center = (jointMin + jointMax) * 0.5f;
+            radius = std::max(radius, glm::length(jointMax - jointMin) * 0.5f + radius * 0.25f);
         }
+        boundsMin = glm::min(boundsMin, center - glm::vec3(radius));
+        boundsMax = glm::max(boundsMax, center + glm::vec3(radius));
+    }
+    for (uint32_t object = 0; object < objectCount; object++) {
+        mAnimationLod.setBounds(object, (mLodBoundsMin[object] + mLodBoundsMax[object]) * 0.5f,
+                                glm::length(mLodBoundsMax[object] - mLodBoundsMin[object]) * 0.5f);
     }
+
+    // 2. 노드는 모델 공간 월드 행렬을 가지므로 setCullingView의 mvp/카메라 위치로 바로 판정
+    mAnimationLod.schedule(Culling::extractFrustum(mCullingMatrix), mCameraPositionModel, mProjectionScale);
 }
 
-void VulkanModel::draw(VkCommandBuffer commandBuffer) {
-    for (const auto& mesh : mMeshes) {
-        mesh->draw(commandBuffer);
+uint32_t VulkanModel::updateAnimation(float deltaSeconds) {
+    const uint8_t* nodeMask = nullptr;
+    if (mHasCullingView && mAnimationLod.getObjectCount() > 0 && mAnimator.isPlaying()) {
+        updateAnimationLod();
+        nodeMask = mAnimationLod.getNodeMask();
+    }
+    return mAnimator.update(deltaSeconds, mScene, nodeMask);
+}
+
+void VulkanModel::updateSkinning(uint32_t frameIndex) {
+    if (!mSkinning) return;
+
+    // 조인트 행렬 = inverse(메시 노드 월드) * 조인트 월드 * inverseBind
+    // 정점 셰이더가 메시 노드 월드 행렬을 다시 곱하므로 최종 결과는 조인트 변환만 반영 (glTF 규칙)
+    glm::mat4* palette = mSkinning->getPalette(frameIndex);
+    for (const SkinInstance& instance : mSkinInstances) {
+        const Skin& skin = mSkins[instance.skin];
+        glm::mat4 inverseNode = glm::inverse(mScene.getWorldMatrix(instance.node));
+        for (size_t j = 0; j < skin.joints.size(); j++) {
+            palette[instance.firstJoint + j] =
+                    inverseNode * mScene.getWorldMatrix(static_cast<uint32_t>(skin.joints[j])) *
+                    skin.inverseBindMatrices[j];
+        }
     }
-}
\ No newline at end of file
+    mSkinning->flushPalette(frameIndex);
+}
+
+void VulkanModel::updateMorphTargets(uint32_t frameIndex) {
+    mMorphDispatches.clear();
+    if (!mMorphing) return;
+
+    // 가중치가 지난 디스패치와 같은 메시는 정점 버퍼에 이미 결과가 있으므로 디스패치하지 않음
+    // 바뀐 메시는 가중치가 0이 아닌 타깃만 압축해 기록 (셰이더는 활성 타깃의 델타 구간만 읽음)
+    MorphTarget* targets = mMorphing->getTargets(frameIndex);
+    uint32_t targetCount = 0;
+    for (const MorphMesh& morph : mMorphMeshes) {
+        uint32_t count = 0;
+        const float* animated = morph.node >= 0 ? mAnimator.getMorphWeights(static_cast<uint32_t>(morph.node), count)
+                                                : nullptr;
+        const float* source = animated ? animated : morph.defaultWeights.data();
+        if (!animated) count = morph.targetCount;
+
+        const float* last = &mMorphLastWeights[morph.firstWeight];
+        float* pending = &mMorphPendingWeights[morph.firstWeight];
+        bool changed = false;
+        for (uint32_t t = 0; t < morph.targetCount; t++) {
+            pending[t] = t < count ? source[t] : 0.0f;
+            changed |= (pending[t] != last[t]);
+        }
+        if (!changed) continue;
+
+        const SkinnedMesh& skinned = mSkinnedMeshes[morph.mesh];
+        MorphPushConstants dispatch = { skinned.firstMorphVertex, skinned.morphVertexCount, targetCount, 0 };
+        for (uint32_t t = 0; t < morph.targetCount; t++) {
+            if (pending[t] == 0.0f) continue;
+            targets[targetCount++] = { skinned.firstMorphDelta + t * skinned.morphVertexCount, pending[t] };
+        }
+        dispatch.targetCount = targetCount - dispatch.firstTarget;
+        mMorphDispatches.push_back(dispatch);
+    }
+    if (!mMorphDispatches.empty()) mMorphing->flushTargets(frameIndex);
+}
+
+void VulkanModel::recordMorphTargets(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    if (!mMorphing || mMorphDispatches.empty()) return;
+    mMorphing->record(commandBuffer, frameIndex, mMorphDispatches);
+    // 디스패치가 기록된 뒤에만 반영된 가중치로 확정 (스왑체인 획득 실패로 기록을 건너뛰면 다음 프레임에 다시 디스패치)
+    mMorphLastWeights = mMorphPendingWeights;
+    mMorphDispatches.clear();
+}
+
+void VulkanModel::recordSkinning(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+    if (!mSkinning) return;
+    mSkinning->record(commandBuffer, frameIndex, mSkinDispatches);
+}
+
+void VulkanModel::setCullingView(const glm::mat4& mvp, const glm::vec3& cameraPositionModelSpace,
+                                 float projectionScale) {
+    mCullingMatrix = mvp;
+    mCameraPositionModel = cameraPositionModelSpace;
+    mProjectionScale = projectionScale;
+    mHasCullingView = true;
+}
+
+uint32_t VulkanModel::selectLod(size_t primitiveIndex) const {
+    const LodRange& lodRange = mPrimitiveLods[primitiveIndex];
+    if (lodRange.levelCount == 0 || !mHasCullingView || mLodErrorThreshold <= 0.0f) return 0;
+
+    // 바운딩 구의 가장 가까운 점까지 거리 기준 (보수적으로 오차를 크게 추정)
+    const MeshletBuilder::Meshlet& bounds = mPrimitiveBounds[primitiveIndex];
+    float distance = glm::length(bounds.center - mCameraPosition) - bounds.radius;
+    if (distance <= 0.0f) return 0;
+
+    for (uint32_t level = lodRange.levelCount; level > 0; level--) {
+        float pixelError = mLodLevels[lodRange.firstLevel + level - 1].error * mProjectionScale / distance;
+        if (pixelError <= mLodErrorThreshold) return level;
+    }
+    return 0;
+}
+
+bool VulkanModel::isClusterVisible(const MeshletBuilder::Meshlet& cluster) const {
+    if (!mCullingEnabled || !mHasCullingView) return true;
+    if (!Culling::isSphereVisible(mFrustum, cluster.center, cluster.radius)) return false;
+    return !Culling::isConeBackfacing(cluster.center, cluster.radius, cluster.coneAxis, cluster.coneCutoff,
+                                      mCameraPosition);
+}
+
+void VulkanModel::draw(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout) {
+    mCullingStats = CullingStats{};
+    // 업로드되지 않았으면 모든 메시의 정적 프리미티브 구간이 비어 있음
+    if (mUseSharedGeometry && mGeometry.isUploaded()) {
+        mGeometry.bind(commandBuffer);
+    }
+
+    for (uint32_t node : mScene.getMeshNodes()) {
+        const PrimitiveSpan& span = mMeshPrimitives[mScene.getMesh(node)];
+        if (span.primitiveCount == 0) continue;
+
+        // 노드 월드 행렬은 push constant로 전달 (Compact의 dequant는 뒤쪽 오프셋에 프리미티브마다 push)
+        const glm::mat4& world = mScene.getWorldMatrix(node);
+        vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(glm::mat4), &world);
+
+        if (!mUseSharedGeometry) {
+            for (uint32_t p = 0; p < span.primitiveCount; p++) {
+                mMeshes[span.firstPrimitive + p]->draw(commandBuffer);
+            }
+            continue;
+        }
+
+        // 클러스터/LOD 데이터는 메시 로컬 공간 기준이므로 뷰를 노드 로컬 공간으로 옮김
+        // (균일 스케일이면 화면 공간 오차 비율도 그대로 유지됨)
+        if (mHasCullingView) {
+            mFrustum = Culling::extractFrustum(mCullingMatrix * world);
+            mCameraPosition = glm::vec3(glm::inverse(world) * glm::vec4(mCameraPositionModel, 1.0f));
+        }
+        for (uint32_t p = 0; p < span.primitiveCount; p++) {
+            drawPrimitive(commandBuffer, pipelineLayout, span.firstPrimitive + p);
+        }
+    }
+
+    drawSkinned(commandBuffer, pipelineLayout);
+}
+
+void VulkanModel::drawSkinned(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout) {
+    if (!mSkinnedGeometry.isUploaded()) return;
+
+    // 스킨 인스턴스는 컴퓨트 출력 구간을, 그 외(스키닝 불가/스킨 없는 노드)는 원본 정점을 그림
+    // (원본 정점은 모프 타깃이 적용된 위치, 모프가 없으면 바인드 포즈)
+    // 정점이 프레임마다 변형되므로 클러스터/LOD 컬링 없이 프리미티브 전체를 그림
+    VkBuffer boundBuffer = VK_NULL_HANDLE;
+    for (uint32_t node : mScene.getMeshNodes()) {
+        const SkinnedMesh& skinned = mSkinnedMeshes[mScene.getMesh(node)];
+        if (skinned.primitiveCount == 0) continue;
+
+        VkBuffer vertexBuffer = mSkinnedGeometry.getVertexBuffer();
+        int32_t vertexBase = 0; // 원본 정점 위치 -> 출력 정점 위치
+        int32_t instance = mNodeSkinInstance.empty() ? -1 : mNodeSkinInstance[node];
+        if (mSkinning && instance >= 0) {
+            vertexBuffer = mSkinning->getOutputBuffer();
+            vertexBase = static_cast<int32_t>(mSkinInstances[instance].outputVertex) -
+                         static_cast<int32_t>(skinned.firstVertex);
+        }
+        if (vertexBuffer != boundBuffer) {
+            mSkinnedGeometry.bind(commandBuffer, vertexBuffer);
+            boundBuffer = vertexBuffer;
+        }
+
+        const glm::mat4& world = mScene.getWorldMatrix(node);
+        vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(glm::mat4), &world);
+        for (uint32_t p = 0; p < skinned.primitiveCount; p++) {
+            VulkanGeometryBuffer::Range range = mSkinnedRanges[skinned.firstPrimitive + p];
+            range.vertexOffset += vertexBase;
+            mSkinnedGeometry.draw(commandBuffer, pipelineLayout, range);
+            mCullingStats.trianglesTotal += range.indexCount / 3;
+            mCullingStats.trianglesVisible += range.indexCount / 3;
+            mCullingStats.drawCalls++;
+        }
+    }
+}
+
+void VulkanModel::drawPrimitive(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout,
+                                size_t primitiveIndex) {
+    const VulkanGeometryBuffer::Range& range = mPrimitiveRanges[primitiveIndex];
+    const ClusterRange& clusterRange = mPrimitiveClusters[primitiveIndex];
+
+    // LOD1 이상: 클러스터는 LOD0 기준이므로 프리미티브 전체 구로만 컬링하고 통째로 그림
+    uint32_t lod = selectLod(primitiveIndex);
+    if (lod > 0) {
+        const LodLevel& level = mLodLevels[mPrimitiveLods[primitiveIndex].firstLevel + lod - 1];
+        mCullingStats.clustersTotal++;
+        mCullingStats.trianglesTotal += level.range.indexCount / 3;
+        if (!isClusterVisible(mPrimitiveBounds[primitiveIndex])) return;
+        mCullingStats.clustersVisible++;
+        mCullingStats.trianglesVisible += level.range.indexCount / 3;
+        mCullingStats.primitivesAtCoarseLod++;
+        mCullingStats.drawCalls++;
+        mGeometry.draw(commandBuffer, pipelineLayout, level.range);
+        return;
+    }
+
+    // 보이는 클러스터가 연속이면 인덱스 구간도 연속이므로 하나의 draw로 합침
+    VulkanGeometryBuffer::Range batch = range;
+    batch.indexCount = 0;
+    auto flush = [&]() {
+        if (batch.indexCount == 0) return;
+        mGeometry.draw(commandBuffer, pipelineLayout, batch);
+        mCullingStats.drawCalls++;
+        batch.indexCount = 0;
+    };
+
+    for (uint32_t c = 0; c < clusterRange.clusterCount; c++) {
+        const MeshletBuilder::Meshlet& cluster = mClusters[clusterRange.firstCluster + c];
+        mCullingStats.clustersTotal++;
+        mCullingStats.trianglesTotal += cluster.indexCount / 3;
+        if (!isClusterVisible(cluster)) {
+            flush();
+            continue;
+        }
+        mCullingStats.clustersVisible++;
+        mCullingStats.trianglesVisible += cluster.indexCount / 3;
+        if (batch.indexCount == 0) batch.firstIndex = range.firstIndex + cluster.firstIndex;
+        batch.indexCount += cluster.indexCount;
+    }
+    flush();
+}
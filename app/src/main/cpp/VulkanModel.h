@@ -1,49 +1,311 @@
 #pragma once
 
 #include "VulkanMesh.h"
+#include "VulkanGeometryBuffer.h"
 #include "VulkanContext.h"
 #include "VulkanTexture.h"
+#include "VulkanUploadBatch.h"
+#include "VulkanSkinning.h"
+#include "VulkanMorphTargets.h"
+#include "culling.h"
+#include "meshlet_builder.h"
+#include "mesh_simplifier.h"
+#include "scene_graph.h"
+#include "animation_player.h"
+#include "animation_compression.h"
+#include "animation_lod.h"
+#include "thread_pool.h"
 
 #include <string>
 #include <vector>
 #include <memory>
 
-#include <android/asset_manager.h>
+#include "asset_utils.h"
 #include <glm/gtc/type_ptr.hpp>
 
-namespace tinygltf {
-    class Model;
+namespace Gltf {
+    struct Document;
+    struct Image;
+    class File;
 }
 
-struct AnimationData {
-    std::vector<float> times;          // 키프레임 시간 (초)
-    std::vector<glm::quat> rotations; // 각 시간의 회전값 (Quaternion)
+// 한 프레임의 클러스터 컬링 결과 (draw 호출 시 갱신)
+struct CullingStats {
+    uint32_t clustersTotal = 0;
+    uint32_t clustersVisible = 0;
+    uint32_t trianglesTotal = 0;
+    uint32_t trianglesVisible = 0;
+    uint32_t drawCalls = 0;
+    uint32_t primitivesAtCoarseLod = 0; // LOD1 이상으로 그린 프리미티브 수
+};
+
+// 마지막 loadFromFile의 메모리 사용량
+struct LoadMemoryStats {
+    size_t limitBytes = 0;        // setLoadMemoryBudget 값 (0이면 병렬 임포트, 추적하지 않음)
+    size_t peakTrackedBytes = 0;  // 예산 모드에서 추적한 CPU 측 임시 메모리의 최댓값 (예상치 기반)
+    size_t peakResidentBytes = 0; // 로드 직후의 프로세스 최대 상주 메모리 (읽을 수 없으면 0)
+    uint32_t waves = 0;           // 예산 모드에서 임포트 -> 업로드를 반복한 묶음 수
 };
 
 class VulkanModel {
 public:
-    VulkanModel(VulkanContext* context);
+    // useSharedGeometry: 모든 프리미티브를 하나의 정점/인덱스 버퍼에 담고 한 번만 바인딩 (기본값)
+    //                    false면 프리미티브마다 별도의 VulkanMesh(버퍼 두 개씩)를 생성
+    // vertexFormat: Compact면 16바이트 양자화 정점 사용 (공유 지오메트리 모드에서만 지원)
+    explicit VulkanModel(VulkanContext* context, bool useSharedGeometry = true,
+                         VertexFormat vertexFormat = VertexFormat::Standard);
     ~VulkanModel() = default;
 
-    // glTF 파일을 로드하고 VulkanMesh들을 생성
-    bool loadFromFile(AAssetManager* assetManager, const std::string& filename);
+    // glTF 파일(.gltf 또는 .glb)을 로드하고 VulkanMesh들을 생성
+    // 파일과 외부 버퍼는 매핑해 접근자를 매핑된 메모리에서 바로 디코딩 (JSON은 Gltf 풀 파서로 한 번만 훑음)
+    // 베이크 파일(.vkmodel)은 glTF 파싱/임포트 단계 없이 매핑한 섹션을 그대로 업로드 (공유 지오메트리 모드)
+    // 모든 업로드는 하나의 배치로 제출되며, 반환 시점에 GPU 복사는 아직 진행 중일 수 있음
+    // framesInFlight: 스키닝 조인트 팔레트 버퍼 수 (렌더러의 프레임 인 플라이트 수와 같아야 함)
+    bool loadFromFile(AAssetManager* assetManager, const std::string& filename, uint32_t framesInFlight = 1);
+
+    // glTF를 loadFromFile과 같은 CPU 단계(디코딩, 최적화, 클러스터/LOD, 정점 패킹, 애니메이션 압축)로 변환해
+    // 베이크 파일로 저장 (GPU를 사용하지 않으므로 context는 nullptr 가능, tools/model_baker에서 사용)
+    // 공유 지오메트리 모드만 지원하고, 스킨/모프 타깃 메시가 있는 모델은 실패 (해당 모델은 glTF로 로드)
+    bool bakeToFile(AAssetManager* assetManager, const std::string& filename, const std::string& outputPath);
+
+    // 임포트 작업 스레드 수 (loadFromFile 전에 설정, 호출 스레드 제외, 기본값 하드웨어 스레드 수 - 1, 0이면 직렬)
+    // 이미지 디코딩, 프리미티브별 속성 디코딩/최적화, 애니메이션 압축을 나눠 처리하고 GPU 업로드는 호출 스레드에서만 기록
+    void setImportWorkerCount(uint32_t workerCount) { mImportWorkerCount = workerCount; }
+
+    // glTF 로드 중 CPU 측 임시 메모리 한도 (바이트, loadFromFile 전에 설정, 기본값 0 = 한도 없는 병렬 임포트)
+    // 설정하면 이미지/프리미티브를 한도에 맞는 묶음으로 나눠 임포트 -> 바로 업로드 -> 해제를 반복하고,
+    // 공유/변형 지오메트리는 CPU에 모으지 않고 GPU 버퍼에 바로 기록하며 스테이징도 링 크기로 제한
+    // (묶음이 작을수록 병렬성이 줄어 로드 시간이 늘어남. 작업 하나가 한도보다 크면 그 작업만 단독으로 진행)
+    void setLoadMemoryBudget(size_t bytes) { mLoadMemoryBudget = bytes; }
+    const LoadMemoryStats& getLoadMemoryStats() const { return mLoadMemoryStats; }
 
-    // 모든 메시를 순회하며 그리기
-    void draw(VkCommandBuffer commandBuffer);
+    // 업로드 완료 여부를 블로킹 없이 확인하고, 완료되었으면 스테이징 자원을 해제
+    bool pollUploadCompletion();
+
+    // 씬 그래프에서 메시를 가진 노드마다 월드 행렬을 push하고 메시의 프리미티브를 그리기
+    // (공유 지오메트리 모드에서는 바인딩 1회 + 프리미티브별 draw, 스킨 메시는 마지막에 스키닝 출력 버퍼로 그림)
+    // pipelineLayout: 노드 행렬과 Compact 정점의 복원 정보(push constant)를 전달할 레이아웃
+    void draw(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout);
+
+    // 바뀐 노드의 서브트리만 월드 행렬 갱신 (draw 전에 프레임마다 호출). 다시 계산한 노드 수 반환
+    uint32_t updateTransforms() { return mScene.update(); }
+    // 노드 로컬 변환 변경용 (인덱스는 평탄화된 노드 인덱스, getSceneNodeIndex로 변환)
+    SceneGraph& getScene() { return mScene; }
+    const SceneGraph& getScene() const { return mScene; }
+    // glTF 노드 인덱스 -> 씬 그래프 노드 인덱스 (기본 씬에 없으면 -1)
+    int32_t getSceneNodeIndex(int32_t gltfNode) const;
+
+    // 클러스터 컬링/LOD 선택에 사용할 이번 프레임의 뷰 (노드별 공간으로의 변환은 draw에서 수행)
+    // mvp와 모델 공간 카메라 위치, projectionScale = 화면 높이(px) / (2 * tan(fovY / 2))
+    // 공유 지오메트리 모드에서 프리미티브마다 화면 공간 오차로 LOD를 고르고,
+    // LOD0이면 클러스터별 프러스텀/백페이스 콘 컬링 후 보이는 구간만 그림
+    void setCullingView(const glm::mat4& mvp, const glm::vec3& cameraPositionModelSpace, float projectionScale);
+    void setCullingEnabled(bool enabled) { mCullingEnabled = enabled; }
+    // 허용할 화면 공간 오차 (픽셀), 0이면 항상 LOD0
+    void setLodErrorThreshold(float pixels) { mLodErrorThreshold = pixels; }
+    const CullingStats& getCullingStats() const { return mCullingStats; }
 
     // 텍스처에 접근하기 위한 인터페이스
     const std::vector<std::unique_ptr<VulkanTexture>>& getTextures() const { return mTextures; }
 
-    // 현재 시간에 맞는 회전 행렬 계산
-    glm::mat4 getAnimationTransform(float time);
+    // 재생 중인 애니메이션 클립을 진행시켜 노드 로컬 변환에 반영 (updateTransforms 전에 호출)
+    // setCullingView가 설정되어 있으면 애니메이션 LOD로 화면 밖/작은 객체의 갱신 주기를 늘림
+    uint32_t updateAnimation(float deltaSeconds);
+    // 클립 재생/정지/가중치 제어 (로드 시 첫 번째 클립이 반복 재생됨)
+    AnimationPlayer& getAnimator() { return mAnimator; }
+    // 애니메이션 LOD 설정/통계 (객체 = 최상위 서브트리, 스킨으로 연결된 서브트리는 하나로 묶음)
+    AnimationLod& getAnimationLod() { return mAnimationLod; }
+    // 로드 시 애니메이션 클립 압축 (loadFromFile 전에 설정, 기본 활성화)
+    void setAnimationCompression(bool enabled, const AnimationCompression::Settings& settings = {}) {
+        mCompressAnimations = enabled;
+        mAnimationCompression = settings;
+    }
+
+    // 모프 메시의 가중치(애니메이션 weights 채널, 없으면 노드/메시 기본값)가 바뀐 메시만 디스패치 목록에 추가하고
+    // 그 메시의 활성 타깃(가중치 0이 아닌 타깃)을 frameIndex 버퍼에 기록 (updateAnimation 후, updateSkinning 전에 호출)
+    void updateMorphTargets(uint32_t frameIndex);
+    // 모프 타깃 컴퓨트 디스패치를 기록하고 가중치를 반영 완료로 확정 (렌더패스 시작 전, recordSkinning보다 먼저)
+    void recordMorphTargets(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+
+    // 스킨 인스턴스의 조인트 팔레트를 frameIndex 버퍼에 기록 (updateTransforms 후 호출, 조인트 수에만 비례)
+    void updateSkinning(uint32_t frameIndex);
+    // 스키닝 컴퓨트 디스패치를 기록 (렌더패스 시작 전, 같은 프레임의 정점 입력보다 먼저)
+    void recordSkinning(VkCommandBuffer commandBuffer, uint32_t frameIndex);
 
 private:
     VulkanContext* mContext;
     std::vector<std::unique_ptr<VulkanMesh>> mMeshes;
+    bool mUseSharedGeometry;
+    VulkanGeometryBuffer mGeometry;
+    std::vector<VulkanGeometryBuffer::Range> mPrimitiveRanges;
+
+    // 프리미티브별 클러스터 구간 (mPrimitiveRanges와 같은 순서)
+    struct ClusterRange {
+        uint32_t firstCluster = 0;
+        uint32_t clusterCount = 0;
+    };
+    std::vector<MeshletBuilder::Meshlet> mClusters; // firstIndex는 프리미티브 기준 상대 위치
+    std::vector<ClusterRange> mPrimitiveClusters;
+    bool mCullingEnabled = true;
+    bool mHasCullingView = false;
+    glm::mat4 mCullingMatrix{1.0f};        // setCullingView의 mvp (모델 공간)
+    glm::vec3 mCameraPositionModel{};      // 모델 공간 카메라 위치
+    Culling::Frustum mFrustum{};           // 현재 그리는 노드의 로컬 공간 기준
+    glm::vec3 mCameraPosition{};           // 현재 그리는 노드의 로컬 공간 기준
+    CullingStats mCullingStats;
+
+    // 프리미티브별 LOD 체인 (LOD1부터, 같은 정점 구간을 공유하는 인덱스 구간)
+    struct LodLevel {
+        VulkanGeometryBuffer::Range range;
+        float error = 0.0f; // 모델 공간 기하 오차
+    };
+    struct LodRange {
+        uint32_t firstLevel = 0;
+        uint32_t levelCount = 0;
+    };
+    std::vector<LodLevel> mLodLevels;
+    std::vector<LodRange> mPrimitiveLods;
+    std::vector<MeshletBuilder::Meshlet> mPrimitiveBounds; // 프리미티브 전체 바운딩 구
+    float mProjectionScale = 0.0f;
+    float mLodErrorThreshold = 1.0f;
+
+    // 씬 그래프 (노드가 메시를 참조, 같은 메시를 여러 노드가 인스턴싱 가능)
+    // glTF 메시별 프리미티브 구간 (mPrimitiveRanges 또는 mMeshes 기준)
+    struct PrimitiveSpan {
+        uint32_t firstPrimitive = 0;
+        uint32_t primitiveCount = 0;
+    };
+    SceneGraph mScene;
+    std::vector<int32_t> mSceneNodeRemap; // glTF 노드 -> 씬 그래프 노드
+    std::vector<PrimitiveSpan> mMeshPrimitives;
+
+    // 변형 메시 (JOINTS_0/WEIGHTS_0 스킨 또는 POSITION 모프 타깃): 정점 순서가 스킨 속성/모프 델타와 같아야 하고
+    // 프레임마다 변형되므로 정점 용접/재배치, 클러스터, LOD 없이 별도의 Standard 지오메트리에 담아
+    // 컴퓨트로 모프 타깃(정점 버퍼에 직접 기록) -> 스키닝(출력 버퍼) 순서로 변형
+    struct SkinnedMesh {
+        uint32_t firstPrimitive = 0; // mSkinnedRanges 기준
+        uint32_t primitiveCount = 0;
+        uint32_t firstVertex = 0;    // 메시의 프리미티브 정점은 mSkinnedGeometry 안에서 연속
+        uint32_t vertexCount = 0;
+        uint32_t jointCount = 0;     // JOINTS_0 최댓값 + 1
+        uint32_t firstMorphVertex = 0; // 모프 정점 구간 (morphVertexCount 0이면 모프 없음)
+        uint32_t morphVertexCount = 0;
+        uint32_t targetCount = 0;      // 프리미티브 중 가장 많은 모프 타깃 수
+        uint32_t firstMorphDelta = 0;  // 델타 버퍼 구간 (타깃마다 morphVertexCount개, xyz 단위)
+        glm::vec3 boundsMin{0.0f};   // 바인드 포즈 AABB (메시 공간)
+        glm::vec3 boundsMax{0.0f};
+    };
+    struct Skin {
+        std::vector<int32_t> joints; // 씬 그래프 노드
+        std::vector<glm::mat4> inverseBindMatrices;
+    };
+    // 스킨이 지정된 메시 노드 하나 (같은 메시라도 노드마다 출력 구간과 팔레트가 따로)
+    struct SkinInstance {
+        uint32_t node = 0;
+        uint32_t skin = 0;
+        uint32_t outputVertex = 0; // 스키닝 출력 버퍼에서의 시작 정점
+        uint32_t firstJoint = 0;   // 조인트 팔레트에서의 시작 위치
+    };
+    VulkanGeometryBuffer mSkinnedGeometry{VertexFormat::Standard};
+    std::vector<VulkanGeometryBuffer::Range> mSkinnedRanges;
+    std::vector<SkinnedMesh> mSkinnedMeshes; // glTF 메시별 (스킨 메시가 아니면 primitiveCount 0)
+    std::vector<SkinVertex> mSkinVertices;   // 업로드 전 CPU 사본 (mSkinnedGeometry 정점과 같은 순서)
+    std::unique_ptr<VulkanBuffer> mSkinVertexBuffer;
+    std::vector<Skin> mSkins;
+    std::vector<SkinInstance> mSkinInstances;
+    std::vector<int32_t> mNodeSkinInstance; // 씬 그래프 노드 -> mSkinInstances (-1이면 없음)
+    std::vector<SkinPushConstants> mSkinDispatches;
+    std::unique_ptr<VulkanSkinning> mSkinning; // 없으면 스킨 메시를 바인드 포즈로 그림
+
+    // 모프 타깃 (가중치는 메시 단위, 메시를 참조하는 첫 씬 노드의 애니메이션/기본 가중치를 사용)
+    struct MorphMesh {
+        uint32_t mesh = 0;
+        int32_t node = -1;        // 가중치 출처 씬 그래프 노드 (-1이면 기본 가중치만)
+        uint32_t firstWeight = 0; // mMorphLastWeights 구간
+        uint32_t targetCount = 0;
+        std::vector<float> defaultWeights;
+    };
+    std::vector<MorphVertex> mMorphVertices; // 업로드 전 CPU 사본
+    std::vector<MorphDelta> mMorphDeltas;    // 모프 정점 순서대로 0이 아닌 타깃 델타
+    std::vector<uint32_t> mMorphDeltaCounts; // 모프 정점마다 mMorphDeltas 개수
+    std::unique_ptr<VulkanBuffer> mMorphVertexBuffer;
+    std::unique_ptr<VulkanBuffer> mMorphDeltaBuffer;
+    std::vector<MorphMesh> mMorphMeshes;
+    std::vector<float> mMorphLastWeights;    // 정점 버퍼에 반영된 가중치 (바뀐 메시만 디스패치)
+    std::vector<float> mMorphPendingWeights; // 이번 프레임 가중치 (디스패치를 기록한 뒤에야 last로 확정)
+    std::vector<MorphPushConstants> mMorphDispatches;
+    std::unique_ptr<VulkanMorphTargets> mMorphing; // 없으면 모프 메시를 바인드 포즈로 그림
+
+    bool isClusterVisible(const MeshletBuilder::Meshlet& cluster) const;
+    // 화면 공간 오차가 임계값 이하인 가장 거친 LOD 선택 (0 = 원본)
+    uint32_t selectLod(size_t primitiveIndex) const;
+    // 공유 지오메트리의 프리미티브 하나를 LOD 선택 + 클러스터 컬링 후 그리기
+    void drawPrimitive(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout, size_t primitiveIndex);
+    void drawSkinned(VkCommandBuffer commandBuffer, VkPipelineLayout pipelineLayout);
     std::vector<std::unique_ptr<VulkanTexture>> mTextures;
-    AnimationData mRotationAnim;
+    AnimationPlayer mAnimator;
+    bool mCompressAnimations = true;
+    AnimationCompression::Settings mAnimationCompression;
+
+    // 애니메이션 LOD 객체의 바운딩 구 재료 (프레임마다 월드 행렬로 변환해 객체별로 합침)
+    struct LodBoundsSource {
+        uint32_t object = 0;
+        uint32_t node = 0;        // 메시 노드
+        glm::vec3 center{0.0f};   // 메시 공간 바운딩 구 (스킨 인스턴스는 바인드 포즈)
+        float radius = 0.0f;
+        int32_t skinInstance = -1; // 0 이상이면 조인트 위치로 구를 계산
+    };
+    AnimationLod mAnimationLod;
+    std::vector<LodBoundsSource> mLodBoundsSources;
+    std::vector<glm::vec3> mLodBoundsMin; // 객체별 월드 AABB (프레임마다 재사용)
+    std::vector<glm::vec3> mLodBoundsMax;
+    std::unique_ptr<VulkanUploadBatch> mUploadBatch;
+
+    // 병렬 임포트: 작업 스레드에서 이미지/프리미티브를 변환한 뒤 호출 스레드에서 순서대로 업로드
+    struct ImportedImage;
+    struct ImportedPrimitive;
+    uint32_t mImportWorkerCount = ThreadPool::getDefaultWorkerCount();
+    size_t mLoadMemoryBudget = 0;
+    LoadMemoryStats mLoadMemoryStats;
+    // glTF 파일 열기 + 파싱 (문서와 버퍼 바이트 범위는 file이 열려 있는 동안만 유효)
+    bool parseGltf(AAssetManager* assetManager, const std::string& filename, Gltf::File& file);
+    // 이미지 디코딩과 프리미티브 변환을 작업 스레드에 분배해 슬롯별 결과를 채움
+    void importParallel(const Gltf::File& file, ThreadPool& pool, std::vector<ImportedImage>& images,
+                        std::vector<ImportedPrimitive>& primitives) const;
+    // [firstJob, lastJob) 작업만 분배 (작업 인덱스는 이미지 다음에 프리미티브 순서)
+    void importJobs(const Gltf::File& file, ThreadPool& pool, std::vector<ImportedImage>& images,
+                    std::vector<ImportedPrimitive>& primitives, size_t firstJob, size_t lastJob) const;
+    // 메모리 예산 모드: 한도에 맞는 묶음 단위로 임포트와 업로드를 번갈아 수행
+    void importStreaming(const Gltf::File& file, ThreadPool& pool, VulkanUploadBatch& uploadBatch);
+    // 작업 하나가 임포트 중 사용하는 CPU 메모리의 대략적인 상한
+    size_t estimateImportBytes(const Gltf::File& file, const std::vector<ImportedPrimitive>& primitives,
+                               size_t job) const;
+    // 공유/변형 지오메트리를 접근자 원소 수로 잡은 용량의 GPU 버퍼로 스트리밍 시작
+    void beginGeometryStreaming(const Gltf::Document& model, const std::vector<ImportedPrimitive>& primitives,
+                                VulkanUploadBatch& uploadBatch);
+    static void decodeImage(const Gltf::Image& image, AssetUtils::ByteSpan encoded, ImportedImage& out);
+    std::vector<ImportedPrimitive> collectPrimitives(const Gltf::Document& model) const;
+    void importPrimitive(const Gltf::Document& model, const std::vector<AssetUtils::ByteSpan>& buffers,
+                         ImportedPrimitive& out) const;
 
-    void processModel(const tinygltf::Model& model); // tinygltf 모델 -> VulkanMesh 변환
-    void loadTextures(const tinygltf::Model& model);
-    void loadAnimations(const tinygltf::Model& model);
+    // glTF 문서 -> VulkanMesh 변환 (importPrimitive 결과를 버퍼에 추가하고 업로드)
+    // uploadBatch가 nullptr이면(베이크) 공유 지오메트리의 CPU 측 버퍼와 프리미티브 표까지만 만듦
+    void processModel(const Gltf::Document& model, std::vector<ImportedPrimitive>& primitives,
+                      VulkanUploadBatch* uploadBatch);
+    // 임포트 결과 하나를 버퍼/표에 추가하고 슬롯의 CPU 데이터 해제
+    void addPrimitive(ImportedPrimitive& slot, VulkanUploadBatch* uploadBatch);
+    // 추가가 끝난 공유/변형 지오메트리, 스킨 속성, 모프 타깃 업로드 (스트리밍 중이면 마무리만)
+    void uploadGeometry(const Gltf::Document& model, VulkanUploadBatch& uploadBatch);
+    void loadTextures(std::vector<ImportedImage>& images, VulkanUploadBatch& uploadBatch);
+    void loadTexture(ImportedImage& image, VulkanUploadBatch& uploadBatch);
+    std::vector<AnimationPlayer::NodePose> readRestPose(const Gltf::Document& model) const;
+    void loadAnimations(const Gltf::Document& model, const std::vector<AssetUtils::ByteSpan>& buffers,
+                        ThreadPool& pool);
+    void loadScene(const Gltf::Document& model);
+    void loadSkins(const Gltf::Document& model, const std::vector<AssetUtils::ByteSpan>& buffers,
+                   AAssetManager* assetManager, uint32_t framesInFlight);
+    void loadMorphTargets(const Gltf::Document& model, AAssetManager* assetManager, uint32_t framesInFlight);
+    bool loadBaked(AAssetManager* assetManager, const std::string& filename);
+    void setupAnimationLod();
+    void updateAnimationLod();
 };
@@ -0,0 +1,222 @@
+#include "VulkanMorphTargets.h"
+#include "Log.h"
+
+#include <array>
+
+namespace {
+// morph.comp의 local_size_x
+constexpr uint32_t kWorkgroupSize = 64;
+
+// 셰이더는 정점을 float 8개(pos, color, uv)로 읽으므로 Vertex 레이아웃에 패딩이 없어야 함
+static_assert(sizeof(Vertex) == 8 * sizeof(float), "morph.comp assumes a tightly packed Vertex");
+
+VkShaderModule createShaderModule(VkDevice device, const std::vector<uint32_t>& code) {
+    VkShaderModuleCreateInfo createInfo = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+    createInfo.codeSize = code.size() * sizeof(uint32_t);
+    createInfo.pCode = code.data();
+
+    VkShaderModule shaderModule;
+    if (vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS) {
+        LOGE("Failed to create shader module");
+        return VK_NULL_HANDLE;
+    }
+    return shaderModule;
+}
+} // namespace
+
+VulkanMorphTargets::VulkanMorphTargets(VulkanContext* context, uint32_t framesInFlight)
+        : mContext(context), mFramesInFlight(framesInFlight) {
+}
+
+VulkanMorphTargets::~VulkanMorphTargets() {
+    VkDevice device = mContext->getDevice();
+    if (mPipeline != VK_NULL_HANDLE) {
+        vkDestroyPipeline(device, mPipeline, nullptr);
+    }
+    if (mPipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(device, mPipelineLayout, nullptr);
+    }
+    if (mDescriptorPool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(device, mDescriptorPool, nullptr);
+    }
+    if (mDescriptorSetLayout != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(device, mDescriptorSetLayout, nullptr);
+    }
+}
+
+bool VulkanMorphTargets::initialize(AAssetManager* assetManager, VkBuffer vertices, VkBuffer morphVertices,
+                                    VkBuffer morphDeltas, uint32_t targetCount) {
+    if (targetCount == 0) return false;
+    mVertexBuffer = vertices;
+    if (!createBuffers(targetCount)) return false;
+    if (!createDescriptors(morphVertices, morphDeltas)) return false;
+    if (!createPipeline(assetManager)) return false;
+    LOGI("GPU morph targets: up to %u active targets per frame", targetCount);
+    return true;
+}
+
+bool VulkanMorphTargets::createBuffers(uint32_t targetCount) {
+    // 활성 타깃: 프레임마다 CPU가 기록 (UMA면 DEVICE_LOCAL 메모리에 직접 기록)
+    VkMemoryPropertyFlags requiredFlags = mContext->isUnifiedMemory()
+            ? (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) : 0;
+    mTargetBuffers.resize(mFramesInFlight);
+    for (uint32_t i = 0; i < mFramesInFlight; i++) {
+        mTargetBuffers[i] = std::make_unique<VulkanBuffer>(
+                mContext->getAllocator(), sizeof(MorphTarget) * static_cast<VkDeviceSize>(targetCount),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU, requiredFlags);
+        if (!mTargetBuffers[i]->isValid() || mTargetBuffers[i]->map() == nullptr) {
+            LOGE("Failed to create morph target buffer");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool VulkanMorphTargets::createDescriptors(VkBuffer morphVertices, VkBuffer morphDeltas) {
+    VkDevice device = mContext->getDevice();
+
+    // 1. Layout: 정점 / 모프 정점 / 델타 / 활성 타깃 (모두 storage buffer)
+    std::array<VkDescriptorSetLayoutBinding, 4> bindings{};
+    for (uint32_t i = 0; i < bindings.size(); i++) {
+        bindings[i].binding = i;
+        bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount = 1;
+        bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    VkDescriptorSetLayoutCreateInfo layoutInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    layoutInfo.pBindings = bindings.data();
+    if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &mDescriptorSetLayout) != VK_SUCCESS) {
+        LOGE("Failed to create morph descriptor set layout");
+        return false;
+    }
+
+    // 2. Pool + 프레임마다 하나의 세트 (활성 타깃 버퍼만 다름)
+    VkDescriptorPoolSize poolSize{};
+    poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    poolSize.descriptorCount = static_cast<uint32_t>(bindings.size()) * mFramesInFlight;
+    VkDescriptorPoolCreateInfo poolInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+    poolInfo.poolSizeCount = 1;
+    poolInfo.pPoolSizes = &poolSize;
+    poolInfo.maxSets = mFramesInFlight;
+    if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &mDescriptorPool) != VK_SUCCESS) {
+        LOGE("Failed to create morph descriptor pool");
+        return false;
+    }
+
+    std::vector<VkDescriptorSetLayout> layouts(mFramesInFlight, mDescriptorSetLayout);
+    VkDescriptorSetAllocateInfo allocInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+    allocInfo.descriptorPool = mDescriptorPool;
+    allocInfo.descriptorSetCount = mFramesInFlight;
+    allocInfo.pSetLayouts = layouts.data();
+    mDescriptorSets.resize(mFramesInFlight);
+    if (vkAllocateDescriptorSets(device, &allocInfo, mDescriptorSets.data()) != VK_SUCCESS) {
+        LOGE("Failed to allocate morph descriptor sets");
+        return false;
+    }
+
+    // 3. 세트 갱신
+    for (uint32_t frame = 0; frame < mFramesInFlight; frame++) {
+        std::array<VkDescriptorBufferInfo, 4> bufferInfos{};
+        bufferInfos[0] = { mVertexBuffer, 0, VK_WHOLE_SIZE };
+        bufferInfos[1] = { morphVertices, 0, VK_WHOLE_SIZE };
+        bufferInfos[2] = { morphDeltas, 0, VK_WHOLE_SIZE };
+        bufferInfos[3] = { mTargetBuffers[frame]->getBuffer(), 0, VK_WHOLE_SIZE };
+
+        std::array<VkWriteDescriptorSet, 4> writes{};
+        for (uint32_t i = 0; i < writes.size(); i++) {
+            writes[i] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+            writes[i].dstSet = mDescriptorSets[frame];
+            writes[i].dstBinding = i;
+            writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            writes[i].descriptorCount = 1;
+            writes[i].pBufferInfo = &bufferInfos[i];
+        }
+        vkUpdateDescriptorSets(device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    }
+    return true;
+}
+
+bool VulkanMorphTargets::createPipeline(AAssetManager* assetManager) {
+    VkDevice device = mContext->getDevice();
+
+    auto code = AssetUtils::loadSpirvFromAssets(assetManager, "shaders/morph.spv");
+    if (code.empty()) {
+        LOGE("Failed to load morph target compute shader");
+        return false;
+    }
+    VkShaderModule shader = createShaderModule(device, code);
+    if (shader == VK_NULL_HANDLE) return false;
+
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = sizeof(MorphPushConstants);
+
+    VkPipelineLayoutCreateInfo layoutInfo = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+    layoutInfo.setLayoutCount = 1;
+    layoutInfo.pSetLayouts = &mDescriptorSetLayout;
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushConstantRange;
+    if (vkCreatePipelineLayout(device, &layoutInfo, nullptr, &mPipelineLayout) != VK_SUCCESS) {
+        vkDestroyShaderModule(device, shader, nullptr);
+        LOGE("Failed to create morph pipeline layout");
+        return false;
+    }
+
+    VkComputePipelineCreateInfo pipelineInfo = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+    pipelineInfo.stage = { VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO };
+    pipelineInfo.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipelineInfo.stage.module = shader;
+    pipelineInfo.stage.pName = "main";
+    pipelineInfo.layout = mPipelineLayout;
+    VkResult result = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &mPipeline);
+
+    vkDestroyShaderModule(device, shader, nullptr);
+    if (result != VK_SUCCESS) {
+        LOGE("Failed to create morph compute pipeline");
+        return false;
+    }
+    return true;
+}
+
+MorphTarget* VulkanMorphTargets::getTargets(uint32_t frameIndex) const {
+    // 버퍼는 생성 시 매핑해 두었으므로 map()은 같은 주소를 돌려줌
+    return static_cast<MorphTarget*>(mTargetBuffers[frameIndex]->map());
+}
+
+void VulkanMorphTargets::flushTargets(uint32_t frameIndex) {
+    mTargetBuffers[frameIndex]->flush();
+}
+
+void VulkanMorphTargets::record(VkCommandBuffer commandBuffer, uint32_t frameIndex,
+                                const std::vector<MorphPushConstants>& dispatches) {
+    if (dispatches.empty()) return;
+
+    // 1. WAR: 이전 프레임의 정점 입력과 스키닝이 정점 버퍼를 다 읽은 뒤에 덮어씀 (실행 의존성만 필요)
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+
+    // 2. 가중치가 바뀐 모프 메시마다 하나의 디스패치 (영향받는 정점 64개당 워크그룹 1개, 스레드마다 활성 타깃 수만큼 반복)
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPipeline);
+    VkDescriptorSet set = mDescriptorSets[frameIndex];
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, mPipelineLayout, 0, 1, &set, 0, nullptr);
+    for (const auto& dispatch : dispatches) {
+        vkCmdPushConstants(commandBuffer, mPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                           sizeof(MorphPushConstants), &dispatch);
+        vkCmdDispatch(commandBuffer, (dispatch.morphVertexCount + kWorkgroupSize - 1) / kWorkgroupSize, 1, 1);
+    }
+
+    // 3. RAW: 컴퓨트 쓰기 -> 스키닝(컴퓨트) 읽기와 모프 전용 메시의 정점 입력 읽기
+    VkBufferMemoryBarrier barrier = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = mVertexBuffer;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                         0, 0, nullptr, 1, &barrier, 0, nullptr);
+}
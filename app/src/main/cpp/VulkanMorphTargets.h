@@ -0,0 +1,55 @@
+#pragma once
+
+#include "volk.h"
+#include "VulkanContext.h"
+#include "VulkanBuffer.h"
+#include "vulkan_types.h"
+#include "asset_utils.h"
+
+#include <memory>
+#include <vector>
+
+// 컴퓨트 셰이더 모프 타깃 (블렌드 셰이프)
+// 메시마다 델타가 있는 정점(MorphVertex)과 타깃별로 펼친 델타 버퍼를 두고,
+// 이번 프레임에 가중치가 0이 아닌 타깃(MorphTarget)만 블렌딩한 위치를 변형 지오메트리 정점 버퍼에 직접 기록합니다.
+// 스키닝은 같은 정점 버퍼를 원본으로 읽으므로 모프 결과가 스키닝 입력이 되고(glTF 규칙: 모프 -> 스킨),
+// 스킨이 없는 모프 메시는 이 정점 버퍼를 그대로 그립니다.
+// 활성 타깃 목록은 프레임 인 플라이트마다 하나의 버퍼에 기록합니다.
+class VulkanMorphTargets {
+public:
+    VulkanMorphTargets(VulkanContext* context, uint32_t framesInFlight);
+    ~VulkanMorphTargets();
+
+    // 복사 방지
+    VulkanMorphTargets(const VulkanMorphTargets&) = delete;
+    VulkanMorphTargets& operator=(const VulkanMorphTargets&) = delete;
+
+    // vertices: 변형 지오메트리 정점 버퍼 (STORAGE 용도 필요), morphVertices/morphDeltas: 패킹된 모프 데이터
+    // targetCount: 모든 모프 메시의 타깃 수 합 (프레임당 활성 타깃 수의 상한)
+    bool initialize(AAssetManager* assetManager, VkBuffer vertices, VkBuffer morphVertices, VkBuffer morphDeltas,
+                    uint32_t targetCount);
+
+    // 이번 프레임의 활성 타깃 (영구 매핑, 기록 후 flushTargets 호출)
+    MorphTarget* getTargets(uint32_t frameIndex) const;
+    void flushTargets(uint32_t frameIndex);
+
+    // 디스패치 기록 + 정점 버퍼를 스키닝 입력/정점 입력으로 읽기 위한 배리어 (렌더패스 밖, 스키닝 전에 호출)
+    void record(VkCommandBuffer commandBuffer, uint32_t frameIndex, const std::vector<MorphPushConstants>& dispatches);
+
+private:
+    VulkanContext* mContext;
+    uint32_t mFramesInFlight;
+    VkBuffer mVertexBuffer = VK_NULL_HANDLE;
+
+    std::vector<std::unique_ptr<VulkanBuffer>> mTargetBuffers; // 프레임 인 플라이트마다 하나
+
+    VkDescriptorSetLayout mDescriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool mDescriptorPool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> mDescriptorSets;
+    VkPipelineLayout mPipelineLayout = VK_NULL_HANDLE;
+    VkPipeline mPipeline = VK_NULL_HANDLE;
+
+    bool createBuffers(uint32_t targetCount);
+    bool createDescriptors(VkBuffer morphVertices, VkBuffer morphDeltas);
+    bool createPipeline(AAssetManager* assetManager);
+};
@@ -0,0 +1,176 @@
+#include "VulkanOffscreenTarget.h"
+#include "VulkanBuffer.h"
+#include "Log.h"
+#include <cstring>
+
+VulkanOffscreenTarget::VulkanOffscreenTarget(VulkanContext* context, uint32_t width, uint32_t height,
+                                             uint32_t imageCount)
+        : mContext(context), mExtent{width, height}, mImageCount(imageCount) {
+}
+
+VulkanOffscreenTarget::~VulkanOffscreenTarget() {
+    cleanup();
+}
+
+bool VulkanOffscreenTarget::createImagesAndViews() {
+    if (!createColorResources()) return false;
+    if (!createDepthResources()) return false;
+    return true;
+}
+
+void VulkanOffscreenTarget::cleanup() {
+    VkDevice device = mContext->getDevice();
+    VmaAllocator allocator = mContext->getAllocator();
+
+    if (mDepthImageView != VK_NULL_HANDLE) {
+        vkDestroyImageView(device, mDepthImageView, nullptr);
+        mDepthImageView = VK_NULL_HANDLE;
+    }
+    if (mDepthImage != VK_NULL_HANDLE) {
+        vmaDestroyImage(allocator, mDepthImage, mDepthImageAllocation);
+        mDepthImage = VK_NULL_HANDLE;
+        mDepthImageAllocation = VK_NULL_HANDLE;
+    }
+
+    for (auto framebuffer : mFramebuffers) {
+        vkDestroyFramebuffer(device, framebuffer, nullptr);
+    }
+    mFramebuffers.clear();
+
+    for (auto imageView : mColorImageViews) {
+        vkDestroyImageView(device, imageView, nullptr);
+    }
+    mColorImageViews.clear();
+
+    for (size_t i = 0; i < mColorImages.size(); i++) {
+        vmaDestroyImage(allocator, mColorImages[i], mColorAllocations[i]);
+    }
+    mColorImages.clear();
+    mColorAllocations.clear();
+}
+
+bool VulkanOffscreenTarget::createColorResources() {
+    mColorImages.resize(mImageCount, VK_NULL_HANDLE);
+    mColorAllocations.resize(mImageCount, VK_NULL_HANDLE);
+    mColorImageViews.resize(mImageCount, VK_NULL_HANDLE);
+
+    for (uint32_t i = 0; i < mImageCount; i++) {
+        mContext->createImage(mExtent.width, mExtent.height, mImageFormat, VK_IMAGE_TILING_OPTIMAL,
+                              VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                              VMA_MEMORY_USAGE_GPU_ONLY,
+                              mColorImages[i], mColorAllocations[i]);
+        if (mColorImages[i] == VK_NULL_HANDLE) {
+            LOGE("Failed to create offscreen color image %u", i);
+            return false;
+        }
+
+        VkImageViewCreateInfo viewInfo = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+        viewInfo.image = mColorImages[i];
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = mImageFormat;
+        viewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        if (vkCreateImageView(mContext->getDevice(), &viewInfo, nullptr, &mColorImageViews[i]) != VK_SUCCESS) {
+            LOGE("Failed to create offscreen color image view %u", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool VulkanOffscreenTarget::createDepthResources() {
+    mDepthFormat = mContext->findDepthFormat();
+
+    mContext->createImage(mExtent.width, mExtent.height, mDepthFormat, VK_IMAGE_TILING_OPTIMAL,
+                          VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                          VMA_MEMORY_USAGE_GPU_ONLY,
+                          mDepthImage, mDepthImageAllocation);
+    if (mDepthImage == VK_NULL_HANDLE) {
+        LOGE("Failed to create depth image");
+        return false;
+    }
+
+    VkImageViewCreateInfo viewInfo = { VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+    viewInfo.image = mDepthImage;
+    viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    viewInfo.format = mDepthFormat;
+    viewInfo.subresourceRange = { VK_IMAGE_ASPECT_DEPTH_BIT, 0, 1, 0, 1 };
+
+    if (vkCreateImageView(mContext->getDevice(), &viewInfo, nullptr, &mDepthImageView) != VK_SUCCESS) {
+        LOGE("Failed to create depth image view");
+        return false;
+    }
+    return true;
+}
+
+bool VulkanOffscreenTarget::createFramebuffers(VkRenderPass renderPass) {
+    mFramebuffers.resize(mColorImageViews.size());
+    for (size_t i = 0; i < mColorImageViews.size(); i++) {
+        VkImageView attachments[] = {
+                mColorImageViews[i],
+                mDepthImageView
+        };
+
+        VkFramebufferCreateInfo fbInfo = { VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO };
+        fbInfo.renderPass = renderPass;
+        fbInfo.attachmentCount = 2;
+        fbInfo.pAttachments = attachments;
+        fbInfo.width = mExtent.width;
+        fbInfo.height = mExtent.height;
+        fbInfo.layers = 1;
+
+        if (vkCreateFramebuffer(mContext->getDevice(), &fbInfo, nullptr, &mFramebuffers[i]) != VK_SUCCESS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool VulkanOffscreenTarget::readPixels(uint32_t imageIndex, std::vector<uint8_t>& outPixels) {
+    if (imageIndex >= mColorImages.size()) return false;
+
+    VkDeviceSize imageSize = static_cast<VkDeviceSize>(mExtent.width) * mExtent.height * 4; // RGBA8
+    VulkanBuffer readbackBuffer(
+            mContext->getAllocator(), imageSize,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VMA_MEMORY_USAGE_GPU_TO_CPU
+    );
+
+    VkCommandBuffer commandBuffer = mContext->beginSingleTimeCommands();
+
+    // 렌더패스의 컬러 쓰기가 끝난 뒤에 복사하도록 배리어 설정 (레이아웃은 TRANSFER_SRC 유지)
+    VkImageMemoryBarrier barrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    barrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = mColorImages[imageIndex];
+    barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    VkBufferImageCopy region = {};
+    region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+    region.imageExtent = { mExtent.width, mExtent.height, 1 };
+    vkCmdCopyImageToBuffer(commandBuffer, mColorImages[imageIndex], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           readbackBuffer.getBuffer(), 1, &region);
+
+    // 호스트에서 읽기 전에 전송 쓰기를 가시화
+    VkMemoryBarrier hostBarrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+    hostBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    hostBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                         0, 1, &hostBarrier, 0, nullptr, 0, nullptr);
+
+    mContext->endSingleTimeCommands(commandBuffer);
+
+    const void* mapped = readbackBuffer.map();
+    if (mapped == nullptr) return false;
+    readbackBuffer.invalidate();
+    outPixels.resize(static_cast<size_t>(imageSize));
+    memcpy(outPixels.data(), mapped, outPixels.size());
+    readbackBuffer.unmap();
+    return true;
+}
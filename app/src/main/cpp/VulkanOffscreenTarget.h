@@ -0,0 +1,57 @@
+#pragma once
+
+#include "volk.h"
+#include "VulkanContext.h"
+#include <vector>
+#include <cstdint>
+
+// 헤드리스 모드용 렌더 타깃: 스왑체인 대신 오프스크린 컬러 이미지에 렌더링
+// (프레임 인 플라이트마다 컬러 이미지 1장, 깊이 버퍼는 스왑체인과 동일하게 공유)
+class VulkanOffscreenTarget {
+public:
+    VulkanOffscreenTarget(VulkanContext* context, uint32_t width, uint32_t height, uint32_t imageCount);
+    ~VulkanOffscreenTarget();
+
+    // Disable copying
+    VulkanOffscreenTarget(const VulkanOffscreenTarget&) = delete;
+    VulkanOffscreenTarget& operator=(const VulkanOffscreenTarget&) = delete;
+
+    // 1단계: 컬러 이미지, 이미지뷰 및 깊이 버퍼 생성
+    bool createImagesAndViews();
+    // 2단계: 파이프라인의 렌더패스를 받아 프레임버퍼 생성
+    bool createFramebuffers(VkRenderPass renderPass);
+
+    void cleanup();
+
+    // 렌더패스 종료 후 TRANSFER_SRC 레이아웃인 컬러 이미지를 RGBA8로 읽어옴 (검증/디버깅용)
+    bool readPixels(uint32_t imageIndex, std::vector<uint8_t>& outPixels);
+
+    VkExtent2D getExtent() const { return mExtent; }
+    VkFormat getImageFormat() const { return mImageFormat; }
+    VkFormat getDepthFormat() const { return mDepthFormat; }
+    // 렌더패스의 컬러 최종 레이아웃 (readPixels를 위해 TRANSFER_SRC로 유지)
+    VkImageLayout getFinalLayout() const { return VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL; }
+    const std::vector<VkFramebuffer>& getFramebuffers() const { return mFramebuffers; }
+    uint32_t getImageCount() const { return mImageCount; }
+
+private:
+    VulkanContext* mContext;
+
+    VkExtent2D mExtent;
+    uint32_t mImageCount;
+    VkFormat mImageFormat = VK_FORMAT_R8G8B8A8_UNORM;
+
+    std::vector<VkImage> mColorImages;
+    std::vector<VmaAllocation> mColorAllocations;
+    std::vector<VkImageView> mColorImageViews;
+    std::vector<VkFramebuffer> mFramebuffers;
+
+    // 깊이 버퍼 관련 변수
+    VkImage mDepthImage = VK_NULL_HANDLE;
+    VmaAllocation mDepthImageAllocation = VK_NULL_HANDLE;
+    VkImageView mDepthImageView = VK_NULL_HANDLE;
+    VkFormat mDepthFormat;
+
+    bool createColorResources();
+    bool createDepthResources();
+};
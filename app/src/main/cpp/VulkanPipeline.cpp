@@ -20,7 +20,8 @@ VkShaderModule createShaderModule(VkDevice device, const std::vector<uint32_t>&
 } // namespace
 
 
-VulkanPipeline::VulkanPipeline(VkDevice device) : mDevice(device) {
+VulkanPipeline::VulkanPipeline(VkDevice device, VertexFormat vertexFormat)
+        : mDevice(device), mVertexFormat(vertexFormat) {
 }
 
 VulkanPipeline::~VulkanPipeline() {
@@ -38,14 +39,15 @@ VulkanPipeline::~VulkanPipeline() {
     }
 }
 
-bool VulkanPipeline::initialize(VkFormat swapchainImageFormat, VkFormat depthFormat, AAssetManager* assetManager) {
-    if (!createRenderPass(swapchainImageFormat, depthFormat)) return false;
+bool VulkanPipeline::initialize(VkFormat swapchainImageFormat, VkFormat depthFormat, AAssetManager* assetManager,
+                                VkImageLayout colorFinalLayout) {
+    if (!createRenderPass(swapchainImageFormat, depthFormat, colorFinalLayout)) return false;
     if (!createDescriptorSetLayout()) return false;
     if (!createGraphicsPipeline(assetManager)) return false;
     return true;
 }
 
-bool VulkanPipeline::createRenderPass(VkFormat imageFormat, VkFormat depthFormat) {
+bool VulkanPipeline::createRenderPass(VkFormat imageFormat, VkFormat depthFormat, VkImageLayout colorFinalLayout) {
     // 1. Color Attachment
     VkAttachmentDescription colorAttachment = {};
     colorAttachment.format = imageFormat;
@@ -55,7 +57,7 @@ bool VulkanPipeline::createRenderPass(VkFormat imageFormat, VkFormat depthFormat
     colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
     colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-    colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    colorAttachment.finalLayout = colorFinalLayout;
 
     VkAttachmentReference colorAttachmentRef = { 0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL };
 
@@ -130,7 +132,9 @@ bool VulkanPipeline::createDescriptorSetLayout() {
 
 bool VulkanPipeline::createGraphicsPipeline(AAssetManager* assetManager) {
     // 1. Shader Modules
-    auto vertCode = AssetUtils::loadSpirvFromAssets(assetManager, "shaders/vert.spv");
+    bool compact = (mVertexFormat == VertexFormat::Compact);
+    auto vertCode = AssetUtils::loadSpirvFromAssets(assetManager,
+                                                    compact ? "shaders/vert_compact.spv" : "shaders/vert.spv");
     auto fragCode = AssetUtils::loadSpirvFromAssets(assetManager, "shaders/frag.spv");
 
     VkShaderModule vertShader = createShaderModule(mDevice, vertCode);
@@ -149,8 +153,9 @@ bool VulkanPipeline::createGraphicsPipeline(AAssetManager* assetManager) {
     VkPipelineShaderStageCreateInfo shaderStages[] = { vertStage, fragStage };
 
     // 2. Vertex Input
-    auto bindingDescription = Vertex::getBindingDescription();
-    auto attributeDescriptions = Vertex::getAttributeDescriptions();
+    auto bindingDescription = compact ? CompactVertex::getBindingDescription() : Vertex::getBindingDescription();
+    auto attributeDescriptions = compact ? CompactVertex::getAttributeDescriptions()
+                                         : Vertex::getAttributeDescriptions();
     VkPipelineVertexInputStateCreateInfo vertexInput = { VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO };
     vertexInput.vertexBindingDescriptionCount = 1;
     vertexInput.pVertexBindingDescriptions = &bindingDescription;
@@ -200,6 +205,14 @@ bool VulkanPipeline::createGraphicsPipeline(AAssetManager* assetManager) {
     layoutInfo.setLayoutCount = 1;
     layoutInfo.pSetLayouts = &mDescriptorSetLayout;
 
+    // draw마다 push: 노드 월드 행렬 + (Compact 정점이면) 위치 복원용 scale/offset
+    VkPushConstantRange pushConstantRange{};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = compact ? sizeof(DrawPushConstants) : offsetof(DrawPushConstants, dequant);
+    layoutInfo.pushConstantRangeCount = 1;
+    layoutInfo.pPushConstantRanges = &pushConstantRange;
+
     if (vkCreatePipelineLayout(mDevice, &layoutInfo, nullptr, &mPipelineLayout) != VK_SUCCESS) return false;
 
     // 5. Final Creation
@@ -9,14 +9,17 @@
 
 class VulkanPipeline {
 public:
-    explicit VulkanPipeline(VkDevice device);
+    // vertexFormat에 따라 정점 입력 레이아웃과 정점 셰이더(vert.spv / vert_compact.spv)를 선택
+    explicit VulkanPipeline(VkDevice device, VertexFormat vertexFormat = VertexFormat::Standard);
     ~VulkanPipeline();
 
     // Disable copying
     VulkanPipeline(const VulkanPipeline&) = delete;
     VulkanPipeline& operator=(const VulkanPipeline&) = delete;
 
-    bool initialize(VkFormat swapchainImageFormat, VkFormat depthFormat, AAssetManager* assetManager);
+    // colorFinalLayout: 스왑체인은 PRESENT_SRC, 오프스크린(헤드리스)은 TRANSFER_SRC 등 렌더 타깃에 맞게 지정
+    bool initialize(VkFormat swapchainImageFormat, VkFormat depthFormat, AAssetManager* assetManager,
+                    VkImageLayout colorFinalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
 
     VkRenderPass getRenderPass() const { return mRenderPass; }
     VkPipelineLayout getPipelineLayout() const { return mPipelineLayout; }
@@ -25,13 +28,14 @@ public:
 
 private:
     VkDevice mDevice;
+    VertexFormat mVertexFormat;
 
     VkRenderPass mRenderPass = VK_NULL_HANDLE;
     VkDescriptorSetLayout mDescriptorSetLayout = VK_NULL_HANDLE;
     VkPipelineLayout mPipelineLayout = VK_NULL_HANDLE;
     VkPipeline mGraphicsPipeline = VK_NULL_HANDLE;
 
-    bool createRenderPass(VkFormat imageFormat, VkFormat depthFormat);
+    bool createRenderPass(VkFormat imageFormat, VkFormat depthFormat, VkImageLayout colorFinalLayout);
     bool createDescriptorSetLayout();
     bool createGraphicsPipeline(AAssetManager* assetManager);
 };
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "volk.h"
+#include "VulkanContext.h"
+#include "VulkanBuffer.h"
+#include "vulkan_types.h"
+#include "asset_utils.h"
+
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+// 컴퓨트 셰이더 GPU 스키닝
+// 스킨 메시의 원본 정점(Vertex)과 스킨 속성(SkinVertex)을 조인트 팔레트로 변형해 출력 정점 버퍼에 기록합니다.
+// 출력은 일반 정점 버퍼이므로 메인 패스뿐 아니라 그림자/깊이 패스도 같은 결과를 그대로 바인딩할 수 있습니다.
+// 조인트 팔레트는 프레임 인 플라이트마다 하나씩 두어 GPU가 읽는 동안 CPU가 다음 프레임을 기록합니다.
+class VulkanSkinning {
+public:
+    VulkanSkinning(VulkanContext* context, uint32_t framesInFlight);
+    ~VulkanSkinning();
+
+    // 복사 방지
+    VulkanSkinning(const VulkanSkinning&) = delete;
+    VulkanSkinning& operator=(const VulkanSkinning&) = delete;
+
+    // sourceVertices: Vertex 배열 (STORAGE 용도 필요), skinVertices: 같은 순서의 SkinVertex 배열
+    // outputVertexCount: 모든 스킨 인스턴스의 출력 정점 수 합, jointCount: 모든 인스턴스의 팔레트 크기 합
+    bool initialize(AAssetManager* assetManager, VkBuffer sourceVertices, VkBuffer skinVertices,
+                    uint32_t outputVertexCount, uint32_t jointCount);
+
+    // 이번 프레임의 조인트 팔레트 (영구 매핑, 기록 후 flushPalette 호출)
+    glm::mat4* getPalette(uint32_t frameIndex) const;
+    void flushPalette(uint32_t frameIndex);
+
+    // 디스패치 기록 + 출력 버퍼를 정점 입력으로 읽기 위한 배리어 (렌더패스 밖에서 호출)
+    void record(VkCommandBuffer commandBuffer, uint32_t frameIndex, const std::vector<SkinPushConstants>& dispatches);
+
+    VkBuffer getOutputBuffer() const { return mOutputBuffer ? mOutputBuffer->getBuffer() : VK_NULL_HANDLE; }
+
+private:
+    VulkanContext* mContext;
+    uint32_t mFramesInFlight;
+
+    std::unique_ptr<VulkanBuffer> mOutputBuffer;
+    std::vector<std::unique_ptr<VulkanBuffer>> mPaletteBuffers; // 프레임 인 플라이트마다 하나
+
+    VkDescriptorSetLayout mDescriptorSetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool mDescriptorPool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> mDescriptorSets;
+    VkPipelineLayout mPipelineLayout = VK_NULL_HANDLE;
+    VkPipeline mPipeline = VK_NULL_HANDLE;
+
+    bool createBuffers(uint32_t outputVertexCount, uint32_t jointCount);
+    bool createDescriptors(VkBuffer sourceVertices, VkBuffer skinVertices);
+    bool createPipeline(AAssetManager* assetManager);
+};
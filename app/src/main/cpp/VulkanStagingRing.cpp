@@ -0,0 +1,71 @@
+#include "VulkanStagingRing.h"
+#include "Log.h"
+
+VulkanStagingRing::VulkanStagingRing(VmaAllocator allocator, VkDeviceSize capacity)
+        : mAllocator(allocator), mCapacity(capacity) {
+}
+
+bool VulkanStagingRing::initialize() {
+    mBuffer = std::make_unique<VulkanBuffer>(
+            mAllocator, mCapacity,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VMA_MEMORY_USAGE_CPU_TO_GPU
+    );
+    if (mBuffer->getBuffer() == VK_NULL_HANDLE) return false;
+
+    // 수명 동안 계속 매핑해 둠 (업로드마다 map/unmap 하지 않음)
+    mMappedData = static_cast<uint8_t*>(mBuffer->map());
+    if (mMappedData == nullptr) {
+        LOGE("Failed to map staging ring");
+        return false;
+    }
+    LOGI("Staging ring created: %llu bytes", static_cast<unsigned long long>(mCapacity));
+    return true;
+}
+
+bool VulkanStagingRing::allocate(VkDeviceSize size, VkDeviceSize alignment, Allocation& outAllocation) {
+    if (size == 0 || size > mCapacity || mMappedData == nullptr) return false;
+
+    // 비어 있으면 다음 랩의 시작(오프셋 0)으로 이동 (꼬리 단편화로 큰 할당이 실패하지 않도록)
+    // 카운터는 단조 증가를 유지해야 이전 마커의 release()가 무시됨
+    if (mHead == mTail) {
+        mHead = (mHead + mCapacity - 1) / mCapacity * mCapacity;
+        mTail = mHead;
+    }
+
+    // 1. 정렬된 오프셋 계산 (용량은 정렬 단위의 배수라고 가정)
+    uint64_t offset = mHead % mCapacity;
+    uint64_t alignedOffset = (offset + alignment - 1) / alignment * alignment;
+    uint64_t head;
+
+    // 2. 끝까지 연속 공간이 없으면 남은 꼬리를 건너뛰고 0부터 시작
+    if (alignedOffset + size > mCapacity) {
+        head = mHead + (mCapacity - offset);
+        offset = 0;
+    } else {
+        head = mHead + (alignedOffset - offset);
+        offset = alignedOffset;
+    }
+
+    // 3. 아직 GPU가 소비하지 않은 구간을 덮어쓰지 않는지 확인
+    if (head + size - mTail > mCapacity) return false;
+
+    mHead = head + size;
+    outAllocation.buffer = mBuffer->getBuffer();
+    outAllocation.offset = static_cast<VkDeviceSize>(offset);
+    outAllocation.data = mMappedData + offset;
+    return true;
+}
+
+void VulkanStagingRing::release(uint64_t marker) {
+    // 같은 큐의 제출은 순서대로 완료되므로 마커는 단조 증가
+    if (marker > mTail) {
+        mTail = (marker < mHead) ? marker : mHead;
+    }
+}
+
+void VulkanStagingRing::flush() {
+    if (mBuffer) {
+        mBuffer->flush();
+    }
+}
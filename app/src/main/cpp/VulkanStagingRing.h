@@ -0,0 +1,51 @@
+#pragma once
+
+#include "volk.h"
+#include "vk_mem_alloc.h"
+#include "VulkanBuffer.h"
+
+#include <memory>
+
+// 모든 CPU->GPU 전송이 공유하는 영구 매핑 스테이징 링 버퍼
+// 한 번만 할당하고 선형으로 잘라 쓰며, GPU가 소비한 구간(마커 이전)은 release()로 회수합니다.
+class VulkanStagingRing {
+public:
+    struct Allocation {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        void* data = nullptr;
+    };
+
+    VulkanStagingRing(VmaAllocator allocator, VkDeviceSize capacity);
+    ~VulkanStagingRing() = default;
+
+    // 복사 방지
+    VulkanStagingRing(const VulkanStagingRing&) = delete;
+    VulkanStagingRing& operator=(const VulkanStagingRing&) = delete;
+
+    bool initialize();
+
+    // 공간이 부족하면 false (호출자가 진행 중인 업로드를 제출/대기 후 재시도)
+    bool allocate(VkDeviceSize size, VkDeviceSize alignment, Allocation& outAllocation);
+
+    // 현재까지 할당된 위치. 제출한 작업과 연결해 두었다가 완료 시 release()에 전달
+    uint64_t getMarker() const { return mHead; }
+    // GPU가 marker 이전의 데이터를 모두 소비했을 때 호출하여 공간 회수
+    void release(uint64_t marker);
+
+    // CPU 쓰기를 GPU에 가시화 (non-coherent 메모리 대비, coherent면 VMA가 무시)
+    void flush();
+
+    VkDeviceSize getCapacity() const { return mCapacity; }
+    VkDeviceSize getUsedSize() const { return static_cast<VkDeviceSize>(mHead - mTail); }
+
+private:
+    VmaAllocator mAllocator;
+    VkDeviceSize mCapacity;
+    std::unique_ptr<VulkanBuffer> mBuffer;
+    uint8_t* mMappedData = nullptr;
+
+    // 누적 바이트 카운터 (오프셋 = 카운터 % 용량)
+    uint64_t mHead = 0;
+    uint64_t mTail = 0;
+};
@@ -139,7 +139,7 @@ bool VulkanSwapchain::createImageViews() {
 }
 
 bool VulkanSwapchain::createDepthResources() {
-    mDepthFormat = findDepthFormat();
+    mDepthFormat = mContext->findDepthFormat();
     VkDevice device = mContext->getDevice();
     VmaAllocator allocator = mContext->getAllocator();
 
@@ -204,25 +204,3 @@ bool VulkanSwapchain::createFramebuffers(VkRenderPass renderPass) {
     }
     return true;
 }
-
-VkFormat VulkanSwapchain::findDepthFormat() {
-    return findSupportedFormat(
-            {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
-            VK_IMAGE_TILING_OPTIMAL,
-            VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
-    );
-}
-
-VkFormat VulkanSwapchain::findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features) {
-    for (VkFormat format : candidates) {
-        VkFormatProperties props;
-        vkGetPhysicalDeviceFormatProperties(mContext->getPhysicalDevice(), format, &props);
-
-        if (tiling == VK_IMAGE_TILING_LINEAR && (props.linearTilingFeatures & features) == features) {
-            return format;
-        } else if (tiling == VK_IMAGE_TILING_OPTIMAL && (props.optimalTilingFeatures & features) == features) {
-            return format;
-        }
-    }
-    return VK_FORMAT_D32_SFLOAT;
-}
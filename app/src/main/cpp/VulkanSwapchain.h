@@ -55,8 +55,6 @@ private:
     bool createSwapchain();
     bool createImageViews();
     bool createDepthResources();
-    VkFormat findDepthFormat();
-    VkFormat findSupportedFormat(const std::vector<VkFormat>& candidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 };
 
 #endif //MYGAME_VULKANSWAPCHAIN_H
@@ -2,6 +2,9 @@
 #include "VulkanBuffer.h"
 #include "Log.h"
 
+#include <algorithm>
+#include <cstring>
+
 VulkanTexture::VulkanTexture(VulkanContext* context) : mContext(context) {
 }
 
@@ -17,16 +20,28 @@ VulkanTexture::~VulkanTexture() {
     }
 }
 
-bool VulkanTexture::loadFromMemory(const unsigned char* pixels, uint32_t width, uint32_t height, VkFormat format) {
-    VkDeviceSize imageSize = width * height * 4; // RGBA 기준
+bool VulkanTexture::loadFromMemory(const unsigned char* pixels, uint32_t width, uint32_t height, VkFormat format,
+                                   VulkanUploadBatch& uploadBatch) {
+    // 제한 모드(setBoundedStaging)면 링 조각 크기에 맞춰 행 단위로 나눠 올림 (아니면 이미지 전체가 한 조각)
+    if (width == 0 || height == 0) return false;
+    VkDeviceSize rowSize = static_cast<VkDeviceSize>(width) * 4; // RGBA 기준
+    VkDeviceSize rowsPerChunk = std::max<VkDeviceSize>(uploadBatch.getStagingChunkSize() / rowSize, 1);
+    // 조각 경계(offsetY)는 전송 큐의 minImageTransferGranularity 높이 배수여야 함 (마지막 조각은 이미지 끝에 닿으므로 허용)
+    uint32_t rowGranularity = uploadBatch.getImageCopyRowGranularity();
+    if (rowGranularity == 0) {
+        rowsPerChunk = height; // 조각 복사 불가: 이미지 전체를 한 번에
+    } else {
+        rowsPerChunk = (rowsPerChunk + rowGranularity - 1) / rowGranularity * rowGranularity;
+    }
+    uint32_t chunkRows = static_cast<uint32_t>(std::min<VkDeviceSize>(rowsPerChunk, height));
 
-    // 1. 스테이징 버퍼 생성 및 데이터 복사
-    VulkanBuffer stagingBuffer(
-        mContext->getAllocator(), imageSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VMA_MEMORY_USAGE_CPU_TO_GPU
-    );
-    stagingBuffer.copyTo(pixels, imageSize);
+    // 1. 스테이징 링에 첫 조각 공간 확보 및 데이터 복사 (texel 크기 4바이트 정렬)
+    VulkanUploadBatch::StagingRegion staging = uploadBatch.allocateStaging(rowSize * chunkRows, 16);
+    if (staging.data == nullptr) {
+        LOGE("Failed to allocate staging memory for texture");
+        return false;
+    }
+    memcpy(staging.data, pixels, static_cast<size_t>(rowSize * chunkRows));
 
     // 2. GPU 이미지 생성
     mContext->createImage(
@@ -35,15 +50,28 @@ bool VulkanTexture::loadFromMemory(const unsigned char* pixels, uint32_t width,
         VMA_MEMORY_USAGE_GPU_ONLY,
         mTextureImage, mTextureAllocation
     );
+    if (mTextureImage == VK_NULL_HANDLE) return false;
 
     // 3. 레이아웃 전환: UNDEFINED -> TRANSFER_DST
-    mContext->transitionImageLayout(mTextureImage, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    uploadBatch.transitionImageLayout(mTextureImage, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
-    // 4. 버퍼에서 이미지로 복사
-    mContext->copyBufferToImage(stagingBuffer.getBuffer(), mTextureImage, width, height);
+    // 4. 버퍼에서 이미지로 복사 (나머지 조각은 복사를 기록한 뒤 차례로 스테이징)
+    for (uint32_t row = 0; row < height; row += chunkRows) {
+        uint32_t rows = std::min(chunkRows, height - row);
+        if (row > 0) {
+            staging = uploadBatch.allocateStaging(rowSize * rows, 16);
+            if (staging.data == nullptr) {
+                // 이미 기록된 명령이 이미지를 참조하므로 실패해도 이미지는 유지 (남은 행은 정의되지 않음)
+                LOGE("Failed to allocate staging memory for texture rows %u-%u", row, height - 1);
+                break;
+            }
+            memcpy(staging.data, pixels + rowSize * row, static_cast<size_t>(rowSize * rows));
+        }
+        uploadBatch.copyBufferToImage(staging.buffer, mTextureImage, width, rows, staging.offset, row);
+    }
 
     // 5. 레이아웃 전환: TRANSFER_DST -> SHADER_READ_ONLY
-    mContext->transitionImageLayout(mTextureImage, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    uploadBatch.transitionImageLayout(mTextureImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 
     // 6. 이미지 뷰 및 샘플러 생성
     createTextureImageView();
@@ -2,14 +2,17 @@
 
 #include "volk.h"
 #include "VulkanContext.h"
+#include "VulkanUploadBatch.h"
 
 class VulkanTexture {
 public:
     VulkanTexture(VulkanContext* context);
     ~VulkanTexture();
 
-    // raw 이미지 데이터(tinygltf에서 읽은 것)를 GPU로 업로드
-    bool loadFromMemory(const unsigned char* pixels, uint32_t width, uint32_t height, VkFormat format);
+    // raw 이미지 데이터(glTF 이미지를 디코딩한 것)를 GPU로 업로드
+    // 레이아웃 전환과 복사는 uploadBatch에 기록만 하며, 제출 전까지 이미지를 샘플링하면 안 됨
+    bool loadFromMemory(const unsigned char* pixels, uint32_t width, uint32_t height, VkFormat format,
+                        VulkanUploadBatch& uploadBatch);
 
     VkImageView getImageView() const { return mTextureImageView; }
     VkSampler getSampler() const { return mTextureSampler; }
@@ -0,0 +1,540 @@
+#include "VulkanUploadBatch.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+VulkanUploadBatch::VulkanUploadBatch(VulkanContext* context) : mContext(context) {
+}
+
+VulkanUploadBatch::~VulkanUploadBatch() {
+    // 제출되지 않은 기록은 버리고, 제출된 배치는 GPU가 끝낼 때까지 대기
+    if (mState == State::Submitted) {
+        wait();
+    }
+    releaseResources();
+    if (mFence != VK_NULL_HANDLE) {
+        vkDestroyFence(mContext->getDevice(), mFence, nullptr);
+    }
+}
+
+bool VulkanUploadBatch::begin() {
+    if (mState == State::Recording) return true;
+    if (mState == State::Submitted) wait();
+    releaseResources();
+
+    if (!beginCommandBuffer()) return false;
+    mCommandCount = 0;
+    mUseTransferQueue = mContext->hasDedicatedTransferQueue();
+    mState = State::Recording;
+    return true;
+}
+
+bool VulkanUploadBatch::beginCommandBuffer() {
+    VkCommandBufferAllocateInfo allocInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandPool = mContext->getTransferCommandPool();
+    allocInfo.commandBufferCount = 1;
+    if (vkAllocateCommandBuffers(mContext->getDevice(), &allocInfo, &mCommandBuffer) != VK_SUCCESS) {
+        LOGE("Failed to allocate upload command buffer");
+        return false;
+    }
+
+    VkCommandBufferBeginInfo beginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (vkBeginCommandBuffer(mCommandBuffer, &beginInfo) != VK_SUCCESS) {
+        LOGE("Failed to begin upload command buffer");
+        return false;
+    }
+    return true;
+}
+
+VkDeviceSize VulkanUploadBatch::getStagingChunkSize() const {
+    // 링 절반이면 정렬/랩어라운드로 잃는 공간이 있어도 flush 한 번 뒤에는 반드시 들어감
+    if (!mBoundedStaging) return std::numeric_limits<VkDeviceSize>::max();
+    return std::max<VkDeviceSize>(mContext->getStagingRing()->getCapacity() / 2, 16);
+}
+
+VulkanUploadBatch::StagingRegion VulkanUploadBatch::allocateStaging(VkDeviceSize size, VkDeviceSize alignment) {
+    StagingRegion region;
+    if (!isRecording() && !begin()) return region;
+
+    VulkanStagingRing* ring = mContext->getStagingRing();
+    VulkanStagingRing::Allocation allocation;
+
+    if (size <= ring->getCapacity()) {
+        bool allocated = ring->allocate(size, alignment, allocation);
+        // 링이 가득 참: 이 배치가 잡고 있는 공간을 GPU가 소비하도록 제출 후 재시도
+        if (!allocated && flushAndRestart()) {
+            allocated = ring->allocate(size, alignment, allocation);
+        }
+        if (allocated) {
+            region.buffer = allocation.buffer;
+            region.offset = allocation.offset;
+            region.data = allocation.data;
+            return region;
+        }
+    }
+
+    // 링보다 큰 요청 (또는 링 할당 실패): 전용 스테이징 버퍼로 대체
+    LOGW("Staging ring cannot fit %llu bytes, using a dedicated staging buffer",
+         static_cast<unsigned long long>(size));
+    auto stagingBuffer = std::make_unique<VulkanBuffer>(
+            mContext->getAllocator(), size,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VMA_MEMORY_USAGE_CPU_TO_GPU
+    );
+    if (!stagingBuffer->isValid()) {
+        LOGE("Failed to create dedicated staging buffer (%llu bytes)", static_cast<unsigned long long>(size));
+        return region;
+    }
+    void* data = stagingBuffer->map();
+    if (data == nullptr) {
+        LOGE("Failed to map dedicated staging buffer");
+        return region;
+    }
+    region.buffer = stagingBuffer->getBuffer();
+    region.offset = 0;
+    region.data = data;
+    mStagingBuffers.push_back(std::move(stagingBuffer));
+    return region;
+}
+
+void VulkanUploadBatch::uploadBuffer(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset) {
+    if (data == nullptr || size == 0) return;
+
+    // 제한 모드가 아니면 조각 하나 (링보다 크면 allocateStaging이 전용 스테이징 버퍼로 대체)
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    VkDeviceSize chunkSize = getStagingChunkSize();
+    for (VkDeviceSize offset = 0; offset < size;) {
+        VkDeviceSize chunk = std::min(chunkSize, size - offset);
+        StagingRegion region = allocateStaging(chunk);
+        if (region.data == nullptr) {
+            LOGE("Failed to allocate staging memory for buffer upload");
+            return;
+        }
+        memcpy(region.data, bytes + offset, static_cast<size_t>(chunk));
+        copyBuffer(region.buffer, dstBuffer, chunk, region.offset, dstOffset + offset);
+        offset += chunk;
+    }
+}
+
+void VulkanUploadBatch::writeBuffer(VulkanBuffer& dstBuffer, const void* data, VkDeviceSize size,
+                                    VkDeviceSize dstOffset) {
+    if (data == nullptr || size == 0) return;
+    // UMA 직접 할당 버퍼는 매핑된 메모리에 바로 기록 (제출 시 GPU에 가시화)
+    if (dstBuffer.isHostVisible()) {
+        dstBuffer.copyTo(data, size, dstOffset);
+        return;
+    }
+    uploadBuffer(data, size, dstBuffer.getBuffer(), dstOffset);
+}
+
+void VulkanUploadBatch::retainUntilComplete(std::unique_ptr<VulkanBuffer> buffer) {
+    if (!buffer) return;
+    // 곧 해제될 버퍼는 소유권 이전 대상에서 제외 (마지막 submit의 release 배리어가 해제된 버퍼를 가리키지 않도록)
+    VkBuffer handle = buffer->getBuffer();
+    if (mOwnershipBuffers.erase(handle) > 0) {
+        mBufferOwnershipBarriers.erase(
+                std::remove_if(mBufferOwnershipBarriers.begin(), mBufferOwnershipBarriers.end(),
+                               [handle](const VkBufferMemoryBarrier& barrier) { return barrier.buffer == handle; }),
+                mBufferOwnershipBarriers.end());
+    }
+    mRetainedBuffers.push_back(std::move(buffer));
+}
+
+std::unique_ptr<VulkanBuffer> VulkanUploadBatch::createDeviceBuffer(const void* data, VkDeviceSize size,
+                                                                   VkBufferUsageFlags usage) {
+    // 1. UMA: GPU 메모리에 CPU가 직접 기록 (vkQueueSubmit이 호스트 쓰기를 GPU에 가시화)
+    if (mContext->isUnifiedMemory()) {
+        auto buffer = std::make_unique<VulkanBuffer>(
+                mContext->getAllocator(), size, usage,
+                VMA_MEMORY_USAGE_GPU_ONLY,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+        );
+        if (buffer->isValid()) {
+            buffer->copyTo(data, size);
+            return buffer;
+        }
+        LOGW("Direct UMA allocation failed, falling back to staging upload");
+    }
+
+    // 2. 스테이징 경로: 스테이징 링 -> GPU_ONLY 버퍼 복사
+    auto buffer = std::make_unique<VulkanBuffer>(
+            mContext->getAllocator(), size,
+            usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            VMA_MEMORY_USAGE_GPU_ONLY
+    );
+    uploadBuffer(data, size, buffer->getBuffer());
+    return buffer;
+}
+
+std::unique_ptr<VulkanBuffer> VulkanUploadBatch::createDeviceBuffer(VkDeviceSize size, VkBufferUsageFlags usage) {
+    usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    if (mContext->isUnifiedMemory()) {
+        auto buffer = std::make_unique<VulkanBuffer>(
+                mContext->getAllocator(), size, usage,
+                VMA_MEMORY_USAGE_GPU_ONLY,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+        );
+        if (buffer->isValid()) {
+            buffer->map(); // writeBuffer마다 매핑/해제하지 않도록 해제될 때까지 유지
+            return buffer;
+        }
+        LOGW("Direct UMA allocation failed, falling back to staging upload");
+    }
+    return std::make_unique<VulkanBuffer>(mContext->getAllocator(), size, usage, VMA_MEMORY_USAGE_GPU_ONLY);
+}
+
+bool VulkanUploadBatch::flushAndRestart() {
+    // 그래픽스 큐: 같은 큐에 이어서 제출하므로 이전 구간의 쓰기와 이후 복사의 순서가 지켜짐
+    if (!mUseTransferQueue) {
+        if (!submit()) return false;
+        wait();
+        mRingFlushCount++;
+        return begin();
+    }
+
+    // 전송 큐: 소유권 이전(release/acquire)은 마지막 submit에서 한 번만 기록
+    // (중간에 그래픽스로 넘기면 이후 같은 버퍼/이미지에 이어서 복사할 때 전송 큐가 소유권을 갖고 있지 않음)
+    // 이번 구간은 전송 큐에만 제출/대기하고 링 공간과 전용 스테이징 버퍼만 회수
+    if (vkEndCommandBuffer(mCommandBuffer) != VK_SUCCESS) {
+        LOGE("Failed to record upload command buffer");
+        return false;
+    }
+    VulkanStagingRing* ring = mContext->getStagingRing();
+    ring->flush();
+    uint64_t marker = ring->getMarker();
+    for (auto& stagingBuffer : mStagingBuffers) {
+        stagingBuffer->flush();
+    }
+    if (!resetFence()) return false;
+
+    VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &mCommandBuffer;
+    if (vkQueueSubmit(mContext->getTransferQueue(), 1, &submitInfo, mFence) != VK_SUCCESS) {
+        LOGE("Failed to submit upload batch segment");
+        return false;
+    }
+    vkWaitForFences(mContext->getDevice(), 1, &mFence, VK_TRUE, UINT64_MAX);
+
+    ring->release(marker);
+    mStagingBuffers.clear();
+    mRetainedBuffers.clear();
+    vkFreeCommandBuffers(mContext->getDevice(), mContext->getTransferCommandPool(), 1, &mCommandBuffer);
+    mCommandBuffer = VK_NULL_HANDLE;
+    mRingFlushCount++;
+    return beginCommandBuffer();
+}
+
+bool VulkanUploadBatch::resetFence() {
+    if (mFence == VK_NULL_HANDLE) {
+        VkFenceCreateInfo fenceInfo = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        if (vkCreateFence(mContext->getDevice(), &fenceInfo, nullptr, &mFence) != VK_SUCCESS) {
+            LOGE("Failed to create upload fence");
+            return false;
+        }
+    } else {
+        vkResetFences(mContext->getDevice(), 1, &mFence);
+    }
+    return true;
+}
+
+void VulkanUploadBatch::copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size,
+                                   VkDeviceSize srcOffset, VkDeviceSize dstOffset) {
+    if (!isRecording() && !begin()) return;
+
+    VkBufferCopy copyRegion = { srcOffset, dstOffset, size };
+    vkCmdCopyBuffer(mCommandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+    mCommandCount++;
+
+    if (mUseTransferQueue) {
+        addBufferOwnershipTransfer(dstBuffer);
+    }
+}
+
+void VulkanUploadBatch::transferWriteBarrier() {
+    if (!isRecording() && !begin()) return;
+
+    VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(mCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                         1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+void VulkanUploadBatch::addBufferOwnershipTransfer(VkBuffer buffer) {
+    // 같은 버퍼에 여러 번 복사해도 소유권 이전은 한 번만
+    if (!mOwnershipBuffers.insert(buffer).second) return;
+
+    VkBufferMemoryBarrier barrier = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = 0;
+    barrier.srcQueueFamilyIndex = mContext->getTransferQueueFamilyIndex();
+    barrier.dstQueueFamilyIndex = mContext->getGraphicsQueueFamilyIndex();
+    barrier.buffer = buffer;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+    mBufferOwnershipBarriers.push_back(barrier);
+}
+
+void VulkanUploadBatch::transitionImageLayout(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout) {
+    if (!isRecording() && !begin()) return;
+
+    VkImageMemoryBarrier barrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    barrier.oldLayout = oldLayout;
+    barrier.newLayout = newLayout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+
+    VkPipelineStageFlags sourceStage;
+    VkPipelineStageFlags destinationStage;
+
+    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL &&
+               mUseTransferQueue) {
+        // 전송 큐는 프래그먼트 셰이더 단계가 없으므로, 레이아웃 전환은 소유권 이전(release/acquire)과 함께 수행
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = 0;
+        barrier.srcQueueFamilyIndex = mContext->getTransferQueueFamilyIndex();
+        barrier.dstQueueFamilyIndex = mContext->getGraphicsQueueFamilyIndex();
+        mImageOwnershipBarriers.push_back(barrier);
+        mCommandCount++;
+        return;
+    } else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    } else {
+        LOGE("Unsupported layout transition");
+        return;
+    }
+
+    vkCmdPipelineBarrier(mCommandBuffer, sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    mCommandCount++;
+}
+
+uint32_t VulkanUploadBatch::getImageCopyRowGranularity() const {
+    // 복사는 전체 너비/깊이 1로만 기록하므로 너비와 깊이는 항상 이미지 경계에 맞음 (0이면 밉 레벨 전체만 허용)
+    if (!mContext->hasDedicatedTransferQueue()) return 1;
+    VkExtent3D granularity = mContext->getTransferImageGranularity();
+    if (granularity.width == 0 || granularity.height == 0 || granularity.depth == 0) return 0;
+    return granularity.height;
+}
+
+void VulkanUploadBatch::copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height,
+                                          VkDeviceSize bufferOffset, uint32_t offsetY) {
+    if (!isRecording() && !begin()) return;
+
+    VkBufferImageCopy region = {};
+    region.bufferOffset = bufferOffset;
+    region.bufferRowLength = 0;
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = {0, static_cast<int32_t>(offsetY), 0};
+    region.imageExtent = {width, height, 1};
+
+    vkCmdCopyBufferToImage(mCommandBuffer, buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    mCommandCount++;
+}
+
+bool VulkanUploadBatch::submit() {
+    if (!isRecording()) return mState != State::Idle;
+
+    if (mUseTransferQueue) {
+        recordReleaseBarriers();
+    } else {
+        // 이후 프레임의 정점/인덱스/유니폼/셰이더(스키닝 컴퓨트 포함) 읽기가 이번 배치의 전송 쓰기를 보도록 보장
+        // (같은 큐에 제출되므로 CPU 대기 없이도 GPU 측 순서가 지켜짐)
+        VkMemoryBarrier memoryBarrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                      VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(mCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+    }
+
+    if (vkEndCommandBuffer(mCommandBuffer) != VK_SUCCESS) {
+        LOGE("Failed to record upload command buffer");
+        return false;
+    }
+
+    // 이번 배치가 링에 쓴 데이터를 GPU에 가시화하고, 완료 시 회수할 위치를 기록
+    VulkanStagingRing* ring = mContext->getStagingRing();
+    ring->flush();
+    mRingMarker = ring->getMarker();
+    for (auto& stagingBuffer : mStagingBuffers) {
+        stagingBuffer->flush();
+    }
+
+    if (!resetFence()) return false;
+
+    bool submitted = mUseTransferQueue ? submitToTransferQueue() : submitToGraphicsQueue();
+    if (!submitted) {
+        LOGE("Failed to submit upload batch");
+        return false;
+    }
+
+    LOGI("Submitted upload batch (%s queue): %u commands, ring %llu/%llu bytes, %zu dedicated staging buffers, %u ring flushes",
+         mUseTransferQueue ? "transfer" : "graphics",
+         mCommandCount,
+         static_cast<unsigned long long>(ring->getUsedSize()),
+         static_cast<unsigned long long>(ring->getCapacity()),
+         mStagingBuffers.size(), mRingFlushCount);
+    mState = State::Submitted;
+    return true;
+}
+
+bool VulkanUploadBatch::submitToGraphicsQueue() {
+    VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &mCommandBuffer;
+    return vkQueueSubmit(mContext->getGraphicsQueue(), 1, &submitInfo, mFence) == VK_SUCCESS;
+}
+
+bool VulkanUploadBatch::submitToTransferQueue() {
+    if (!recordAcquireCommands()) return false;
+
+    VkSemaphore timeline = mContext->getUploadTimelineSemaphore();
+    mTimelineValue = mContext->acquireNextUploadTimelineValue();
+
+    // 1. 전송 큐: 복사 + 소유권 release, 완료 시 타임라인 값 signal
+    VkTimelineSemaphoreSubmitInfoKHR signalInfo = { VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR };
+    signalInfo.signalSemaphoreValueCount = 1;
+    signalInfo.pSignalSemaphoreValues = &mTimelineValue;
+
+    VkSubmitInfo transferSubmit = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    transferSubmit.pNext = &signalInfo;
+    transferSubmit.commandBufferCount = 1;
+    transferSubmit.pCommandBuffers = &mCommandBuffer;
+    transferSubmit.signalSemaphoreCount = 1;
+    transferSubmit.pSignalSemaphores = &timeline;
+    if (vkQueueSubmit(mContext->getTransferQueue(), 1, &transferSubmit, VK_NULL_HANDLE) != VK_SUCCESS) {
+        return false;
+    }
+
+    // 2. 그래픽스 큐: 타임라인 값을 기다린 뒤 소유권 acquire (CPU는 기다리지 않음)
+    //    이후 제출되는 프레임은 제출 순서에 따라 acquire 이후에 실행됨
+    VkTimelineSemaphoreSubmitInfoKHR waitInfo = { VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR };
+    waitInfo.waitSemaphoreValueCount = 1;
+    waitInfo.pWaitSemaphoreValues = &mTimelineValue;
+
+    VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo acquireSubmit = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    acquireSubmit.pNext = &waitInfo;
+    acquireSubmit.waitSemaphoreCount = 1;
+    acquireSubmit.pWaitSemaphores = &timeline;
+    acquireSubmit.pWaitDstStageMask = &waitStage;
+    acquireSubmit.commandBufferCount = 1;
+    acquireSubmit.pCommandBuffers = &mAcquireCommandBuffer;
+    return vkQueueSubmit(mContext->getGraphicsQueue(), 1, &acquireSubmit, mFence) == VK_SUCCESS;
+}
+
+void VulkanUploadBatch::recordReleaseBarriers() {
+    if (mBufferOwnershipBarriers.empty() && mImageOwnershipBarriers.empty()) return;
+
+    // release: 전송 쓰기 완료 후 소유권을 그래픽스 패밀리로 넘김 (dst 단계/접근은 acquire 쪽에서 지정)
+    vkCmdPipelineBarrier(mCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+                         0, nullptr,
+                         static_cast<uint32_t>(mBufferOwnershipBarriers.size()), mBufferOwnershipBarriers.data(),
+                         static_cast<uint32_t>(mImageOwnershipBarriers.size()), mImageOwnershipBarriers.data());
+}
+
+bool VulkanUploadBatch::recordAcquireCommands() {
+    VkCommandBufferAllocateInfo allocInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocInfo.commandPool = mContext->getGraphicsTransientCommandPool();
+    allocInfo.commandBufferCount = 1;
+    if (vkAllocateCommandBuffers(mContext->getDevice(), &allocInfo, &mAcquireCommandBuffer) != VK_SUCCESS) {
+        LOGE("Failed to allocate ownership acquire command buffer");
+        return false;
+    }
+
+    VkCommandBufferBeginInfo beginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(mAcquireCommandBuffer, &beginInfo);
+
+    // acquire: release와 동일한 소유권/레이아웃 정보에 그래픽스 쪽 접근 마스크만 지정
+    for (auto& barrier : mBufferOwnershipBarriers) {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT |
+                                VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+    }
+    for (auto& barrier : mImageOwnershipBarriers) {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    }
+    if (!mBufferOwnershipBarriers.empty() || !mImageOwnershipBarriers.empty()) {
+        vkCmdPipelineBarrier(mAcquireCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT |
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 0, nullptr,
+                             static_cast<uint32_t>(mBufferOwnershipBarriers.size()), mBufferOwnershipBarriers.data(),
+                             static_cast<uint32_t>(mImageOwnershipBarriers.size()), mImageOwnershipBarriers.data());
+    }
+
+    if (vkEndCommandBuffer(mAcquireCommandBuffer) != VK_SUCCESS) {
+        LOGE("Failed to record ownership acquire command buffer");
+        return false;
+    }
+    return true;
+}
+
+bool VulkanUploadBatch::isComplete() {
+    if (mState == State::Completed) return true;
+    if (mState != State::Submitted) return false;
+
+    if (vkGetFenceStatus(mContext->getDevice(), mFence) != VK_SUCCESS) return false;
+
+    onComplete();
+    return true;
+}
+
+void VulkanUploadBatch::wait() {
+    if (mState != State::Submitted) return;
+
+    vkWaitForFences(mContext->getDevice(), 1, &mFence, VK_TRUE, UINT64_MAX);
+    onComplete();
+}
+
+void VulkanUploadBatch::onComplete() {
+    mState = State::Completed;
+    // GPU가 스테이징 데이터를 모두 소비했으므로 링 공간 회수
+    mContext->getStagingRing()->release(mRingMarker);
+    releaseResources();
+}
+
+void VulkanUploadBatch::releaseResources() {
+    mStagingBuffers.clear();
+    mRetainedBuffers.clear();
+    mBufferOwnershipBarriers.clear();
+    mImageOwnershipBarriers.clear();
+    mOwnershipBuffers.clear();
+    if (mCommandBuffer != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(mContext->getDevice(), mContext->getTransferCommandPool(), 1, &mCommandBuffer);
+        mCommandBuffer = VK_NULL_HANDLE;
+    }
+    if (mAcquireCommandBuffer != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(mContext->getDevice(), mContext->getGraphicsTransientCommandPool(), 1,
+                             &mAcquireCommandBuffer);
+        mAcquireCommandBuffer = VK_NULL_HANDLE;
+    }
+}
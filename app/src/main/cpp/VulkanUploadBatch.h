@@ -0,0 +1,122 @@
+#pragma once
+
+#include "volk.h"
+#include "VulkanContext.h"
+#include "VulkanBuffer.h"
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+// 여러 업로드(버퍼 복사, 이미지 레이아웃 전환, 버퍼->이미지 복사)를 하나의 커맨드 버퍼에 모아
+// 한 번만 제출하는 업로드 배치. 완료는 펜스로 알리며 vkQueueWaitIdle을 사용하지 않습니다.
+// 스테이징 메모리는 VulkanContext의 스테이징 링에서 잘라 쓰고, 완료 시 링에 반환합니다.
+// 전송 전용 큐가 있으면 복사는 전송 큐에서 실행하고, 큐 패밀리 소유권을 그래픽스로 이전한 뒤
+// 그래픽스 큐는 타임라인 세마포어를 기다려 소유권을 획득합니다 (렌더링과 업로드가 겹쳐 실행됨).
+class VulkanUploadBatch {
+public:
+    struct StagingRegion {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        void* data = nullptr; // 영구 매핑된 CPU 주소 (호출자가 직접 기록)
+    };
+
+    explicit VulkanUploadBatch(VulkanContext* context);
+    ~VulkanUploadBatch();
+
+    // 복사 방지
+    VulkanUploadBatch(const VulkanUploadBatch&) = delete;
+    VulkanUploadBatch& operator=(const VulkanUploadBatch&) = delete;
+
+    // 기록 시작 (커맨드 버퍼 할당 및 begin)
+    bool begin();
+
+    // 스테이징 메모리를 링 크기로 제한 (메모리 예산 로드용, 기본 비활성화)
+    // 활성화하면 링보다 큰 업로드도 전용 스테이징 버퍼 대신 getStagingChunkSize 크기 조각으로 나눠 기록하고,
+    // 조각마다 링이 가득 차면 제출/대기 후 이어서 기록합니다 (대신 큰 업로드는 CPU 대기가 늘어남)
+    void setBoundedStaging(bool bounded) { mBoundedStaging = bounded; }
+    // 한 번에 스테이징할 최대 크기 (제한 모드가 아니면 제한 없음)
+    VkDeviceSize getStagingChunkSize() const;
+
+    // 스테이징 공간 확보. 링이 가득 차면 지금까지 기록한 업로드를 제출/대기한 뒤 재시도하고,
+    // 링보다 큰 요청은 전용 스테이징 버퍼로 대체합니다.
+    StagingRegion allocateStaging(VkDeviceSize size, VkDeviceSize alignment = 16);
+    // 초기 데이터를 가진 GPU 버퍼 생성
+    // UMA면 DEVICE_LOCAL | HOST_VISIBLE 메모리에 직접 기록하고(스테이징/GPU 복사 생략),
+    // 그 외(외장 GPU 또는 직접 할당 실패)에는 스테이징 링을 거쳐 GPU_ONLY 버퍼로 복사합니다.
+    std::unique_ptr<VulkanBuffer> createDeviceBuffer(const void* data, VkDeviceSize size, VkBufferUsageFlags usage);
+    // 초기 데이터 없이 GPU 버퍼만 생성 (이후 writeBuffer로 구간별 기록, 스트리밍 로드용)
+    // 메모리 선택은 위와 같고, 버퍼 간 복사(크기 확장)를 위해 TRANSFER_SRC/DST 용도를 항상 포함
+    std::unique_ptr<VulkanBuffer> createDeviceBuffer(VkDeviceSize size, VkBufferUsageFlags usage);
+    // createDeviceBuffer로 만든 버퍼의 dstOffset 위치에 기록 (매핑 가능하면 직접 쓰고, 아니면 스테이징 경유)
+    void writeBuffer(VulkanBuffer& dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset);
+    // data를 스테이징에 복사하고 dstBuffer로의 복사를 기록
+    void uploadBuffer(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset = 0);
+    // 기록된 복사가 끝날 때까지 버퍼를 유지한 뒤 해제 (크기를 키우며 교체한 버퍼 등)
+    void retainUntilComplete(std::unique_ptr<VulkanBuffer> buffer);
+
+    void copyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size,
+                    VkDeviceSize srcOffset = 0, VkDeviceSize dstOffset = 0);
+    // 지금까지 기록(또는 이전 구간에서 제출)한 전송 쓰기를 이후 전송 명령이 읽을 수 있도록 배리어 기록
+    // (업로드한 버퍼를 다시 복사 원본으로 쓸 때)
+    void transferWriteBarrier();
+    void transitionImageLayout(VkImage image, VkImageLayout oldLayout, VkImageLayout newLayout);
+    // 행 단위 조각 복사에서 offsetY와 조각 높이가 따라야 하는 행 배수 (기록할 큐 패밀리의 전송 단위 기준)
+    // 0이면 조각 복사가 불가능하므로 이미지 전체를 한 번에 복사해야 함
+    uint32_t getImageCopyRowGranularity() const;
+    // 촘촘히 패킹된 height개 행을 이미지의 offsetY 행부터 복사 (큰 이미지를 행 단위 조각으로 나눠 올릴 때 사용)
+    void copyBufferToImage(VkBuffer buffer, VkImage image, uint32_t width, uint32_t height,
+                           VkDeviceSize bufferOffset = 0, uint32_t offsetY = 0);
+
+    // 기록 종료 후 제출 (펜스로 완료 신호)
+    // 전송 큐 사용 시: 전송 큐(타임라인 signal) -> 그래픽스 큐(타임라인 wait + 소유권 획득) 순서로 제출
+    bool submit();
+    // 완료 여부를 블로킹 없이 확인하고, 완료되었으면 스테이징 자원을 해제
+    bool isComplete();
+    // 완료될 때까지 CPU 대기 (해당 배치의 펜스만 기다림)
+    void wait();
+
+    bool isRecording() const { return mState == State::Recording; }
+    uint32_t getCommandCount() const { return mCommandCount; }
+
+private:
+    enum class State { Idle, Recording, Submitted, Completed };
+
+    VulkanContext* mContext;
+    VkCommandBuffer mCommandBuffer = VK_NULL_HANDLE;
+    VkFence mFence = VK_NULL_HANDLE;
+    State mState = State::Idle;
+    uint32_t mCommandCount = 0;
+
+    // 링에 담기지 않는 큰 업로드용 전용 스테이징 버퍼 (완료 후 해제)
+    std::vector<std::unique_ptr<VulkanBuffer>> mStagingBuffers;
+    // 복사 원본으로 쓰인 뒤 교체된 버퍼 (완료 후 해제)
+    std::vector<std::unique_ptr<VulkanBuffer>> mRetainedBuffers;
+    bool mBoundedStaging = false;
+    // 제출 시점의 링 마커 (완료 시 이 위치까지 링 공간 회수)
+    uint64_t mRingMarker = 0;
+    uint32_t mRingFlushCount = 0;
+
+    // 전송 전용 큐 사용 시 큐 패밀리 소유권 이전 정보 (release 기준으로 저장, acquire는 마스크만 변경)
+    bool mUseTransferQueue = false;
+    VkCommandBuffer mAcquireCommandBuffer = VK_NULL_HANDLE;
+    std::vector<VkBufferMemoryBarrier> mBufferOwnershipBarriers;
+    std::vector<VkImageMemoryBarrier> mImageOwnershipBarriers;
+    std::unordered_set<VkBuffer> mOwnershipBuffers;
+    uint64_t mTimelineValue = 0;
+
+    void addBufferOwnershipTransfer(VkBuffer buffer);
+    void recordReleaseBarriers();
+    bool recordAcquireCommands();
+    bool submitToTransferQueue();
+    bool submitToGraphicsQueue();
+
+    // 커맨드 버퍼 할당 + begin (소유권 이전 목록 등 배치 상태는 유지)
+    bool beginCommandBuffer();
+    // 펜스 생성 또는 리셋
+    bool resetFence();
+    // 링이 가득 찼을 때 지금까지의 기록을 제출하고 완료를 기다린 뒤 다시 기록 시작
+    bool flushAndRestart();
+    void onComplete();
+    void releaseResources();
+};
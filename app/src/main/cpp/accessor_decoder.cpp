@@ -0,0 +1,267 @@
+#include "accessor_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ACCESSOR_SIMD_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ACCESSOR_SIMD_SSE2 1
+#endif
+
+namespace AccessorDecoder {
+namespace {
+// 정규화 계수: 성분 타입의 최댓값 역수 (FLOAT/정규화되지 않은 정수는 1)
+template <typename T>
+float normalizeScale(bool normalized) {
+    if (std::is_floating_point<T>::value || !normalized) return 1.0f;
+    return 1.0f / static_cast<float>(std::numeric_limits<T>::max());
+}
+
+// 정렬되지 않은 위치에서도 안전하게 읽기 (byteOffset/byteStride는 성분 크기 배수가 아닐 수 있음)
+template <typename T>
+inline T loadScalar(const uint8_t* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template <typename T>
+inline float convertScalar(T value, float scale, bool clampNegative) {
+    float result = static_cast<float>(value) * scale;
+    return clampNegative ? std::max(result, -1.0f) : result;
+}
+
+#if defined(ACCESSOR_SIMD_NEON) || defined(ACCESSOR_SIMD_SSE2)
+// 4-wide 변환 래퍼: 성분 4개(4 * sizeof(T) 바이트)를 읽어 float 4개로. 알고리즘은 백엔드와 무관하게 하나만 작성
+#if defined(ACCESSOR_SIMD_NEON)
+using Float4 = float32x4_t;
+inline Float4 set1(float v) { return vdupq_n_f32(v); }
+inline Float4 mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+inline Float4 max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+inline void store(float* p, Float4 v) { vst1q_f32(p, v); }
+
+template <typename T>
+inline Float4 load4(const uint8_t* p) {
+    if constexpr (std::is_same<T, float>::value) {
+        return vreinterpretq_f32_u8(vld1q_u8(p));
+    } else if constexpr (sizeof(T) == 1) {
+        uint32_t bits = loadScalar<uint32_t>(p);
+        uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32(bits));
+        if constexpr (std::is_signed<T>::value) {
+            return vcvtq_f32_s32(vmovl_s16(vget_low_s16(vmovl_s8(vreinterpret_s8_u8(bytes)))));
+        } else {
+            return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(bytes))));
+        }
+    } else if constexpr (sizeof(T) == 2) {
+        uint16x4_t halves = vreinterpret_u16_u64(vcreate_u64(loadScalar<uint64_t>(p)));
+        if constexpr (std::is_signed<T>::value) {
+            return vcvtq_f32_s32(vmovl_s16(vreinterpret_s16_u16(halves)));
+        } else {
+            return vcvtq_f32_u32(vmovl_u16(halves));
+        }
+    } else {
+        return vcvtq_f32_u32(vreinterpretq_u32_u8(vld1q_u8(p)));
+    }
+}
+#else
+using Float4 = __m128;
+inline Float4 set1(float v) { return _mm_set1_ps(v); }
+inline Float4 mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+inline Float4 max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+inline void store(float* p, Float4 v) { _mm_storeu_ps(p, v); }
+
+template <typename T>
+inline Float4 load4(const uint8_t* p) {
+    if constexpr (std::is_same<T, float>::value) {
+        return _mm_loadu_ps(reinterpret_cast<const float*>(p));
+    } else if constexpr (sizeof(T) == 1) {
+        __m128i v = _mm_cvtsi32_si128(loadScalar<int32_t>(p));
+        if constexpr (std::is_signed<T>::value) {
+            // 바이트를 상위로 올린 뒤 산술 시프트로 부호 확장
+            v = _mm_unpacklo_epi8(v, v);
+            return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 24));
+        } else {
+            __m128i zero = _mm_setzero_si128();
+            return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(v, zero), zero));
+        }
+    } else if constexpr (sizeof(T) == 2) {
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        if constexpr (std::is_signed<T>::value) {
+            return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+        } else {
+            return _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, _mm_setzero_si128()));
+        }
+    } else {
+        // SSE2에는 부호 없는 32비트 변환이 없으므로 UNSIGNED_INT는 스칼라 경로만 사용 (hasSimdPath 참고)
+        return _mm_setzero_ps();
+    }
+}
+#endif
+
+template <typename T>
+constexpr bool hasSimdPath() {
+#if defined(ACCESSOR_SIMD_SSE2)
+    return !std::is_same<T, uint32_t>::value;
+#else
+    return true;
+#endif
+}
+
+template <typename T>
+inline Float4 finish(Float4 v, Float4 scale, bool clampNegative) {
+    if constexpr (std::is_floating_point<T>::value) return v;
+    v = mul(v, scale);
+    return clampNegative ? max(v, set1(-1.0f)) : v;
+}
+#endif
+
+template <typename T>
+void decodeTyped(const uint8_t* data, size_t count, int components, size_t stride, bool normalized, float* out) {
+    const float scale = normalizeScale<T>(normalized);
+    const bool clampNegative = normalized && std::is_signed<T>::value && !std::is_floating_point<T>::value;
+    const size_t elementSize = components * sizeof(T);
+
+    // 1. 촘촘한 스트림: 원소 경계와 무관하게 성분 배열 하나로 변환 (FLOAT는 그대로 복사)
+    if (stride == elementSize) {
+        size_t scalarCount = count * components;
+        if constexpr (std::is_same<T, float>::value) {
+            std::memcpy(out, data, scalarCount * sizeof(float));
+            return;
+        }
+        size_t i = 0;
+#if defined(ACCESSOR_SIMD_NEON) || defined(ACCESSOR_SIMD_SSE2)
+        if constexpr (hasSimdPath<T>()) {
+            Float4 scale4 = set1(scale);
+            for (; i + 4 <= scalarCount; i += 4) {
+                store(out + i, finish<T>(load4<T>(data + i * sizeof(T)), scale4, clampNegative));
+            }
+        }
+#endif
+        for (; i < scalarCount; i++) {
+            out[i] = convertScalar(loadScalar<T>(data + i * sizeof(T)), scale, clampNegative);
+        }
+        return;
+    }
+
+    size_t i = 0;
+#if defined(ACCESSOR_SIMD_NEON) || defined(ACCESSOR_SIMD_SSE2)
+    // 2. 패딩/인터리브된 VEC3/VEC4: 원소마다 성분 4개를 한 번에 읽어 변환
+    //    VEC3은 4번째 성분(패딩 또는 다음 속성)까지 float 4개를 쓰고 다음 원소가 덮어씀.
+    //    마지막 원소는 버퍼 끝을 넘어 읽거나 쓸 수 있으므로 스칼라 경로로 처리
+    if constexpr (hasSimdPath<T>()) {
+        if ((components == 3 || components == 4) && stride >= 4 * sizeof(T) && count > 0) {
+            Float4 scale4 = set1(scale);
+            size_t simdCount = components == 4 ? count : count - 1;
+            for (; i < simdCount; i++) {
+                store(out + i * components, finish<T>(load4<T>(data + i * stride), scale4, clampNegative));
+            }
+        }
+    }
+#endif
+
+    // 3. 그 외 인터리브 레이아웃 (VEC2 UV 등): 타입이 고정된 스칼라 루프
+    for (; i < count; i++) {
+        const uint8_t* element = data + i * stride;
+        float* dst = out + i * components;
+        for (int c = 0; c < components; c++) {
+            dst[c] = convertScalar(loadScalar<T>(element + c * sizeof(T)), scale, clampNegative);
+        }
+    }
+}
+
+bool isValidLayout(const Layout& layout, size_t& stride) {
+    size_t componentSize = getComponentSize(layout.componentType);
+    if (componentSize == 0 || layout.components < 1 || layout.components > 16) return false;
+    size_t elementSize = componentSize * layout.components;
+    stride = layout.stride ? layout.stride : elementSize;
+    return stride >= elementSize;
+}
+} // namespace
+
+size_t getComponentSize(int componentType) {
+    switch (componentType) {
+        case Byte:
+        case UnsignedByte: return 1;
+        case Short:
+        case UnsignedShort: return 2;
+        case UnsignedInt:
+        case Float: return 4;
+        default: return 0;
+    }
+}
+
+bool decode(const uint8_t* data, size_t count, const Layout& layout, float* out) {
+    size_t stride = 0;
+    if (!isValidLayout(layout, stride)) return false;
+    if (count == 0) return true;
+
+    const int components = layout.components;
+    const bool normalized = layout.normalized;
+    switch (layout.componentType) {
+        case Byte: decodeTyped<int8_t>(data, count, components, stride, normalized, out); break;
+        case UnsignedByte: decodeTyped<uint8_t>(data, count, components, stride, normalized, out); break;
+        case Short: decodeTyped<int16_t>(data, count, components, stride, normalized, out); break;
+        case UnsignedShort: decodeTyped<uint16_t>(data, count, components, stride, normalized, out); break;
+        case UnsignedInt: decodeTyped<uint32_t>(data, count, components, stride, normalized, out); break;
+        case Float: decodeTyped<float>(data, count, components, stride, false, out); break;
+        default: return false;
+    }
+    return true;
+}
+
+bool decodeReference(const uint8_t* data, size_t count, const Layout& layout, float* out) {
+    size_t stride = 0;
+    if (!isValidLayout(layout, stride)) return false;
+
+    bool normalized = layout.normalized;
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* element = data + i * stride;
+        float* dst = out + i * layout.components;
+        for (int c = 0; c < layout.components; c++) {
+            switch (layout.componentType) {
+                case Byte:
+                    dst[c] = convertScalar(loadScalar<int8_t>(element + c), normalizeScale<int8_t>(normalized),
+                                           normalized);
+                    break;
+                case UnsignedByte:
+                    dst[c] = convertScalar(loadScalar<uint8_t>(element + c), normalizeScale<uint8_t>(normalized),
+                                           false);
+                    break;
+                case Short:
+                    dst[c] = convertScalar(loadScalar<int16_t>(element + c * 2), normalizeScale<int16_t>(normalized),
+                                           normalized);
+                    break;
+                case UnsignedShort:
+                    dst[c] = convertScalar(loadScalar<uint16_t>(element + c * 2),
+                                           normalizeScale<uint16_t>(normalized), false);
+                    break;
+                case UnsignedInt:
+                    dst[c] = convertScalar(loadScalar<uint32_t>(element + c * 4),
+                                           normalizeScale<uint32_t>(normalized), false);
+                    break;
+                case Float:
+                    dst[c] = loadScalar<float>(element + c * 4);
+                    break;
+                default:
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+const char* getBackendName() {
+#if defined(ACCESSOR_SIMD_NEON)
+    return "NEON";
+#elif defined(ACCESSOR_SIMD_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+} // namespace AccessorDecoder
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// glTF 접근자 -> float 스트림 변환
+// 모든 componentType(BYTE ~ FLOAT), normalized 플래그, 원소당 1~16성분, 임의의 byteStride를 처리하고
+// 결과는 원소마다 components개의 float를 촘촘히 이어 씁니다.
+// - normalized 정수: unorm은 v / max, snorm은 max(v / max, -1) (glTF 규칙)
+// - 정규화되지 않은 정수: 값 그대로 float로 변환 (KHR_mesh_quantization의 정수 위치 등)
+// 촘촘한 스트림과 4성분 단위로 읽을 수 있는 VEC3/VEC4(패딩/인터리브 포함)는 SIMD 경로,
+// 그 외에는 타입별로 특수화된 스칼라 경로를 사용합니다. 백엔드: ARM은 NEON, x86 호스트는 SSE2
+// sparse 치환은 호출하는 쪽에서 값 배열을 이 함수로 변환한 뒤 인덱스 위치에 덮어씁니다.
+namespace AccessorDecoder {
+    // glTF componentType 값과 같음 (tinygltf의 TINYGLTF_COMPONENT_TYPE_*를 그대로 전달 가능)
+    enum ComponentType : int {
+        Byte = 5120,
+        UnsignedByte = 5121,
+        Short = 5122,
+        UnsignedShort = 5123,
+        UnsignedInt = 5125,
+        Float = 5126,
+    };
+
+    struct Layout {
+        int componentType = Float;
+        int components = 3;      // SCALAR 1, VEC2 2, VEC3 3, VEC4 4, MAT4 16
+        bool normalized = false; // FLOAT이면 무시
+        size_t stride = 0;       // 원소 간격 (바이트), 0이면 촘촘히 패킹
+    };
+
+    // 성분 하나의 크기 (바이트), 지원하지 않는 타입이면 0
+    size_t getComponentSize(int componentType);
+
+    // data에서 원소 count개를 읽어 out[count * components]에 기록
+    // 레이아웃이 잘못되었으면(타입, 성분 수, stride < 원소 크기) false
+    // 호출하는 쪽이 data부터 (count - 1) * stride + 원소 크기 바이트를 읽을 수 있음을 보장해야 함
+    bool decode(const uint8_t* data, size_t count, const Layout& layout, float* out);
+
+    // 성분마다 타입을 분기하는 단순한 스칼라 구현 (검증/벤치마크 기준)
+    bool decodeReference(const uint8_t* data, size_t count, const Layout& layout, float* out);
+
+    // 컴파일된 백엔드 이름 ("NEON", "SSE2", "scalar")
+    const char* getBackendName();
+}
@@ -0,0 +1,237 @@
+#include "animation.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Animation {
+namespace {
+void normalizeQuat(float* q) {
+    float length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if (length <= 0.0f) {
+        q[0] = q[1] = q[2] = 0.0f;
+        q[3] = 1.0f;
+        return;
+    }
+    float inv = 1.0f / length;
+    for (int i = 0; i < 4; i++) q[i] *= inv;
+}
+
+// smallest-three 성분 범위 [-1/sqrt(2), 1/sqrt(2)] <-> 15비트
+constexpr float kSqrtHalf = 0.70710678f;
+constexpr float kQuatScale = 32767.0f;
+
+template <typename T>
+uint32_t findKeyframeImpl(const std::vector<T>& times, float time, uint32_t& cursor) {
+    const uint32_t count = static_cast<uint32_t>(times.size());
+    if (count < 2) return cursor = 0;
+
+    const uint32_t last = count - 2; // 마지막 구간의 시작 키
+    uint32_t key = std::min(cursor, last);
+
+    // 1. 직전 구간 또는 바로 다음 구간 (프레임 간 시간 변화가 키 간격보다 작은 일반적인 경우)
+    if (time >= times[key]) {
+        if (key == last || time < times[key + 1]) return cursor = key;
+        if (key + 1 == last || time < times[key + 2]) return cursor = key + 1;
+    } else if (key == 0) {
+        return cursor = 0;
+    }
+
+    // 2. 루프/탐색으로 크게 건너뛴 경우 이진 탐색
+    auto it = std::upper_bound(times.begin(), times.end(), time,
+                               [](float value, T element) { return value < static_cast<float>(element); });
+    uint32_t upper = static_cast<uint32_t>(it - times.begin());
+    key = upper == 0 ? 0 : std::min(upper - 1, last);
+    return cursor = key;
+}
+} // namespace
+
+// 최단 경로 slerp, 두 쿼터니언이 거의 같으면 nlerp로 대체 (sin(theta) -> 0 나눗셈 방지)
+void slerp(const float* a, const float* b, float t, float* out) {
+    float cosTheta = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    float sign = 1.0f;
+    if (cosTheta < 0.0f) {
+        cosTheta = -cosTheta;
+        sign = -1.0f;
+    }
+
+    float wa;
+    float wb;
+    if (cosTheta > 0.9995f) {
+        wa = 1.0f - t;
+        wb = t;
+    } else {
+        float theta = std::acos(cosTheta);
+        float invSin = 1.0f / std::sin(theta);
+        wa = std::sin((1.0f - t) * theta) * invSin;
+        wb = std::sin(t * theta) * invSin;
+    }
+    wb *= sign;
+    for (int i = 0; i < 4; i++) out[i] = a[i] * wa + b[i] * wb;
+    normalizeQuat(out);
+}
+
+void packQuaternion(const float* q, uint16_t* out) {
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; i++) {
+        if (std::fabs(q[i]) > std::fabs(q[largest])) largest = i;
+    }
+    // q와 -q는 같은 회전이므로 생략할 성분이 양수가 되도록 부호를 맞춤
+    float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        if (i == largest) continue;
+        float v = std::clamp(q[i] * sign / kSqrtHalf, -1.0f, 1.0f);
+        out[k++] = static_cast<uint16_t>((v * 0.5f + 0.5f) * kQuatScale + 0.5f);
+    }
+    out[0] |= static_cast<uint16_t>((largest & 1u) << 15);
+    out[1] |= static_cast<uint16_t>((largest >> 1) << 15);
+}
+
+void unpackQuaternion(const uint16_t* packed, float* q) {
+    uint32_t largest = (packed[0] >> 15) | ((packed[1] >> 15) << 1);
+    float sum = 0.0f;
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        if (i == largest) continue;
+        float v = ((packed[k++] & 0x7FFF) / kQuatScale * 2.0f - 1.0f) * kSqrtHalf;
+        q[i] = v;
+        sum += v * v;
+    }
+    q[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+}
+
+uint32_t findKeyframe(const std::vector<float>& times, float time, uint32_t& cursor) {
+    return findKeyframeImpl(times, time, cursor);
+}
+
+uint32_t findKeyframe(const std::vector<uint16_t>& times, float time, uint32_t& cursor) {
+    return findKeyframeImpl(times, time, cursor);
+}
+
+uint32_t getKeyCount(const Channel& channel) {
+    return static_cast<uint32_t>(isCompressed(channel) ? channel.quantizedTimes.size() : channel.times.size());
+}
+
+float getKeyTime(const Channel& channel, uint32_t key) {
+    return isCompressed(channel) ? channel.timeOffset + channel.quantizedTimes[key] * channel.timeScale
+                                 : channel.times[key];
+}
+
+namespace {
+// 압축 채널의 구간 탐색 (키 시간은 양자화 단위로 비교, rotation은 두 키만 풀어서 사용)
+Segment findCompressedSegment(const Channel& channel, float time, uint32_t& cursor, float* decodeBuffer) {
+    const uint32_t keyCount = static_cast<uint32_t>(channel.quantizedTimes.size());
+    const bool rotation = channel.path == Path::Rotation;
+    auto keyData = [&](uint32_t key, uint32_t slot) -> const float* {
+        if (!rotation) return &channel.values[key * channel.components];
+        unpackQuaternion(&channel.packedRotations[key * 3], decodeBuffer + slot * 4);
+        return decodeBuffer + slot * 4;
+    };
+    Segment segment;
+
+    float keyTime = channel.timeScale > 0.0f ? (time - channel.timeOffset) / channel.timeScale : 0.0f;
+    if (keyCount == 1 || keyTime <= channel.quantizedTimes.front() || keyTime >= channel.quantizedTimes.back()) {
+        uint32_t key = (keyCount == 1 || keyTime <= channel.quantizedTimes.front()) ? 0 : keyCount - 1;
+        cursor = key == 0 ? 0 : keyCount - 2;
+        segment.k0 = segment.k1 = keyData(key, 0);
+        return segment;
+    }
+
+    uint32_t key = findKeyframe(channel.quantizedTimes, keyTime, cursor);
+    float q0 = channel.quantizedTimes[key];
+    float span = channel.quantizedTimes[key + 1] - q0;
+    segment.duration = span * channel.timeScale;
+    segment.t = span > 0.0f ? (keyTime - q0) / span : 0.0f;
+    segment.k0 = keyData(key, 0);
+    segment.k1 = keyData(key + 1, 1);
+    return segment;
+}
+} // namespace
+
+Segment findSegment(const Channel& channel, float time, uint32_t& cursor, float* decodeBuffer) {
+    if (isCompressed(channel)) return findCompressedSegment(channel, time, cursor, decodeBuffer);
+
+    const uint32_t keyCount = static_cast<uint32_t>(channel.times.size());
+    const uint32_t keyStride = channel.components *
+                               (channel.interpolation == Interpolation::CubicSpline ? 3 : 1);
+    Segment segment;
+
+    // 키가 하나뿐이거나 범위 밖이면 가장 가까운 키 값 그대로
+    if (keyCount == 1 || time <= channel.times.front() || time >= channel.times.back()) {
+        uint32_t key = (keyCount == 1 || time <= channel.times.front()) ? 0 : keyCount - 1;
+        cursor = key == 0 ? 0 : keyCount - 2;
+        segment.k0 = segment.k1 = &channel.values[key * keyStride];
+        return segment;
+    }
+
+    uint32_t key = findKeyframe(channel.times, time, cursor);
+    float t0 = channel.times[key];
+    segment.duration = channel.times[key + 1] - t0;
+    segment.t = segment.duration > 0.0f ? (time - t0) / segment.duration : 0.0f;
+    segment.k0 = &channel.values[key * keyStride];
+    segment.k1 = &channel.values[(key + 1) * keyStride];
+    return segment;
+}
+
+void sampleChannel(const Channel& channel, float time, uint32_t& cursor, float* out) {
+    const uint32_t n = channel.components;
+    const bool rotation = channel.path == Path::Rotation;
+    float decodeBuffer[8];
+    Segment segment = findSegment(channel, time, cursor, decodeBuffer);
+    const float* k0 = segment.k0;
+    const float* k1 = segment.k1;
+    const float t = segment.t;
+
+    switch (channel.interpolation) {
+        case Interpolation::Step:
+            std::copy(k0, k0 + n, out);
+            break;
+
+        case Interpolation::Linear:
+            if (rotation) {
+                slerp(k0, k1, t, out);
+            } else {
+                for (uint32_t i = 0; i < n; i++) out[i] = k0[i] + (k1[i] - k0[i]) * t;
+            }
+            break;
+
+        case Interpolation::CubicSpline: {
+            // p(t) = h00 * v0 + h10 * dt * b0 + h01 * v1 + h11 * dt * a1
+            // (b0 = k0의 out-tangent, a1 = k1의 in-tangent)
+            float dt = segment.duration;
+            float t2 = t * t;
+            float t3 = t2 * t;
+            float h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;
+            float h10 = (t3 - 2.0f * t2 + t) * dt;
+            float h01 = -2.0f * t3 + 3.0f * t2;
+            float h11 = (t3 - t2) * dt;
+            const float* v0 = k0 + n;
+            const float* b0 = k0 + 2 * n;
+            const float* a1 = k1;
+            const float* v1 = k1 + n;
+            for (uint32_t i = 0; i < n; i++) {
+                out[i] = h00 * v0[i] + h10 * b0[i] + h01 * v1[i] + h11 * a1[i];
+            }
+            if (rotation) normalizeQuat(out);
+            break;
+        }
+    }
+}
+
+bool isValid(const Channel& channel) {
+    if (isCompressed(channel)) {
+        if (channel.interpolation == Interpolation::CubicSpline || !channel.times.empty()) return false;
+        size_t keyCount = channel.quantizedTimes.size();
+        if (channel.path == Path::Rotation) {
+            return channel.components == 4 && channel.packedRotations.size() == keyCount * 3 && channel.values.empty();
+        }
+        return channel.components > 0 && channel.values.size() == keyCount * channel.components;
+    }
+    if (channel.times.empty() || channel.components == 0) return false;
+    if (channel.path == Path::Rotation && channel.components != 4) return false;
+    if ((channel.path == Path::Translation || channel.path == Path::Scale) && channel.components != 3) return false;
+    size_t expected = channel.times.size() * channel.components *
+                      (channel.interpolation == Interpolation::CubicSpline ? 3 : 1);
+    return channel.values.size() == expected;
+}
+} // namespace Animation
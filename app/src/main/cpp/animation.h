@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// glTF 애니메이션 데이터와 채널 샘플링
+// - 채널: 노드 하나의 translation/rotation/scale/weights 중 하나를 키프레임으로 구동
+// - 보간: STEP, LINEAR (rotation은 slerp), CUBICSPLINE (에르미트, 키마다 in-tangent/value/out-tangent)
+// - 키 탐색은 채널별 커서를 이어서 사용하므로 순방향 재생에서는 O(1), 점프/루프 시에만 이진 탐색
+// - 압축 채널(AnimationCompression)은 16비트 키 시간과 48비트 쿼터니언을 샘플링 시점에 두 키만 풀어서 사용
+namespace Animation {
+    enum class Path : uint8_t {
+        Translation,
+        Rotation,
+        Scale,
+        Weights
+    };
+
+    enum class Interpolation : uint8_t {
+        Step,
+        Linear,
+        CubicSpline
+    };
+
+    struct Channel {
+        uint32_t targetNode = 0; // 씬 그래프 노드 인덱스
+        Path path = Path::Translation;
+        Interpolation interpolation = Interpolation::Linear;
+        uint32_t components = 3; // translation/scale 3, rotation 4 (x, y, z, w), weights = 모프 타깃 수
+        std::vector<float> times;
+        // 키마다 components개 (CUBICSPLINE이면 키마다 in-tangent, value, out-tangent 순서로 3배)
+        std::vector<float> values;
+
+        // 압축 채널 (STEP/LINEAR만): quantizedTimes가 비어 있지 않으면 times 대신 사용
+        // 키 시간 = timeOffset + quantizedTimes[key] * timeScale
+        // rotation이면 values 대신 packedRotations (키마다 uint16 3개, packQuaternion 형식)
+        std::vector<uint16_t> quantizedTimes;
+        std::vector<uint16_t> packedRotations;
+        float timeOffset = 0.0f;
+        float timeScale = 0.0f;
+    };
+
+    struct Clip {
+        std::string name;
+        float duration = 0.0f; // 모든 채널의 마지막 키 시간 중 최댓값
+        std::vector<Channel> channels;
+    };
+
+    // times[key] <= time < times[key + 1]인 key 반환 (범위 밖이면 0 또는 마지막 구간으로 고정)
+    // cursor는 직전 결과로, 같은 구간이나 바로 다음 구간이면 비교 한두 번으로 끝나고 아니면 이진 탐색
+    uint32_t findKeyframe(const std::vector<float>& times, float time, uint32_t& cursor);
+    // 16비트 양자화 키 시간용 (time도 같은 양자화 단위)
+    uint32_t findKeyframe(const std::vector<uint16_t>& times, float time, uint32_t& cursor);
+
+    // time이 속한 보간 구간: 두 키의 데이터 시작 위치(CUBICSPLINE이면 in-tangent부터)와 구간 내 비율
+    // 범위 밖이거나 키가 하나면 k0 == k1, t = 0
+    struct Segment {
+        const float* k0 = nullptr;
+        const float* k1 = nullptr;
+        float t = 0.0f;
+        float duration = 0.0f; // 두 키의 시간 차 (CUBICSPLINE 탄젠트 스케일)
+    };
+    // 압축 rotation 채널은 두 키를 decodeBuffer[8]에 풀고 k0/k1이 그 안을 가리킴 (다른 채널은 사용하지 않음)
+    Segment findSegment(const Channel& channel, float time, uint32_t& cursor, float* decodeBuffer = nullptr);
+
+    // 채널을 time에서 샘플링해 out[components]에 기록 (rotation은 정규화된 x, y, z, w)
+    void sampleChannel(const Channel& channel, float time, uint32_t& cursor, float* out);
+
+    // 채널 값 개수 검증 (키 수 * components * (CUBICSPLINE이면 3))
+    bool isValid(const Channel& channel);
+
+    inline bool isCompressed(const Channel& channel) { return !channel.quantizedTimes.empty(); }
+    uint32_t getKeyCount(const Channel& channel);
+    float getKeyTime(const Channel& channel, uint32_t key);
+
+    // 최단 경로 slerp (a, b, out은 x, y, z, w)
+    void slerp(const float* a, const float* b, float t, float* out);
+
+    // smallest-three 48비트 쿼터니언: 절댓값이 가장 큰 성분을 양수로 맞춰 생략하고 나머지 세 성분을 15비트씩 저장
+    // (생략한 성분 인덱스 2비트는 out[0], out[1]의 최상위 비트). 성분 오차 ~2e-5
+    void packQuaternion(const float* q, uint16_t* out);
+    void unpackQuaternion(const uint16_t* packed, float* q);
+}
@@ -0,0 +1,193 @@
+#include "animation_compression.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace AnimationCompression {
+namespace {
+// 한 구간에서 제거를 시도할 최대 키 수 (구간 검사 비용 O(n * kMaxSegmentKeys) 제한)
+constexpr uint32_t kMaxSegmentKeys = 512;
+
+float toleranceFor(const Animation::Channel& channel, const Settings& settings) {
+    switch (channel.path) {
+        case Animation::Path::Translation: return settings.translationError;
+        case Animation::Path::Rotation: return settings.rotationError;
+        case Animation::Path::Scale: return settings.scaleError;
+        case Animation::Path::Weights: return settings.weightError;
+    }
+    return 0.0f;
+}
+
+// 경로별 오차: rotation은 회전 각도, translation은 거리, scale/weights는 성분 최대 차이
+float valueError(Animation::Path path, const float* a, const float* b, uint32_t components) {
+    if (path == Animation::Path::Rotation) {
+        // acos(dot)은 1 근처에서 정밀도를 잃으므로 |a - b|, |a + b|의 atan2 사용 (q와 -q는 같은 회전)
+        float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+        float sign = dot < 0.0f ? -1.0f : 1.0f;
+        float diff = 0.0f;
+        float sum = 0.0f;
+        for (int i = 0; i < 4; i++) {
+            float d = a[i] - sign * b[i];
+            float s = a[i] + sign * b[i];
+            diff += d * d;
+            sum += s * s;
+        }
+        return 4.0f * std::atan2(std::sqrt(diff), std::sqrt(sum));
+    }
+    if (path == Animation::Path::Translation) {
+        float d2 = 0.0f;
+        for (uint32_t i = 0; i < components; i++) d2 += (a[i] - b[i]) * (a[i] - b[i]);
+        return std::sqrt(d2);
+    }
+    float maxDiff = 0.0f;
+    for (uint32_t i = 0; i < components; i++) maxDiff = std::max(maxDiff, std::fabs(a[i] - b[i]));
+    return maxDiff;
+}
+// 키 시간 눈금 (초). 고정 프레임레이트로 구운 클립처럼 모든 키가 가장 짧은 키 간격의 배수에 놓이면
+// 그 간격을 눈금으로 써서 키 시간을 정확히 보존하고, 아니면 [첫 키, 마지막 키]를 65535 단계로 나눔
+float selectTimeScale(const std::vector<float>& times) {
+    float range = times.back() - times.front();
+    if (range <= 0.0f) return 0.0f;
+
+    float minGap = range;
+    for (size_t i = 1; i < times.size(); i++) {
+        float gap = times[i] - times[i - 1];
+        if (gap > 0.0f) minGap = std::min(minGap, gap);
+    }
+    // 인접 키 차이는 float 반올림 오차가 크므로 전체 구간을 눈금 수로 나눈 값을 간격으로 사용
+    float tickCount = std::round(range / minGap);
+    if (tickCount <= 65535.0f) {
+        float interval = range / tickCount;
+        bool onGrid = true;
+        for (size_t i = 0; i < times.size() && onGrid; i++) {
+            float ticks = (times[i] - times.front()) / interval;
+            onGrid = std::fabs(ticks - std::round(ticks)) <= 0.01f;
+        }
+        if (onGrid) return interval;
+    }
+    return range / 65535.0f;
+}
+} // namespace
+
+size_t getChannelBytes(const Animation::Channel& channel) {
+    return channel.times.size() * sizeof(float) + channel.values.size() * sizeof(float) +
+           channel.quantizedTimes.size() * sizeof(uint16_t) + channel.packedRotations.size() * sizeof(uint16_t);
+}
+
+bool compressChannel(Animation::Channel& channel, const Settings& settings, Stats& stats) {
+    stats.bytesBefore += getChannelBytes(channel);
+    stats.keysBefore += Animation::getKeyCount(channel);
+    if (Animation::isCompressed(channel) || channel.interpolation == Animation::Interpolation::CubicSpline ||
+        !Animation::isValid(channel)) {
+        stats.bytesAfter += getChannelBytes(channel);
+        stats.keysAfter += Animation::getKeyCount(channel);
+        return false;
+    }
+
+    const uint32_t n = channel.components;
+    const uint32_t keyCount = static_cast<uint32_t>(channel.times.size());
+    const bool rotation = channel.path == Animation::Path::Rotation;
+    const bool step = channel.interpolation == Animation::Interpolation::Step;
+    const float tolerance = toleranceFor(channel, settings);
+
+    // 1. 양자화: 키 시간은 16비트 눈금, rotation은 48비트 (복원 값으로 오차 검사)
+    const float timeOffset = channel.times.front();
+    const float timeScale = selectTimeScale(channel.times);
+    std::vector<uint16_t> quantizedTimes(keyCount, 0);
+    std::vector<float> keyTimes(keyCount, timeOffset);
+    for (uint32_t i = 0; i < keyCount; i++) {
+        if (timeScale > 0.0f) {
+            float q = std::round((channel.times[i] - timeOffset) / timeScale);
+            quantizedTimes[i] = static_cast<uint16_t>(std::clamp(q, 0.0f, 65535.0f));
+        }
+        keyTimes[i] = timeOffset + quantizedTimes[i] * timeScale;
+    }
+    std::vector<uint16_t> packed;
+    std::vector<float> decoded(channel.values);
+    if (rotation) {
+        packed.resize(keyCount * 3);
+        for (uint32_t i = 0; i < keyCount; i++) {
+            Animation::packQuaternion(&channel.values[i * 4], &packed[i * 3]);
+            Animation::unpackQuaternion(&packed[i * 3], &decoded[i * 4]);
+        }
+    }
+
+    // 2. 키 선택
+    std::vector<uint32_t> kept;
+    auto keyError = [&](uint32_t key, const float* reconstructed) {
+        return valueError(channel.path, reconstructed, &channel.values[key * n], n);
+    };
+
+    // 2.1 모든 키가 첫 키 값으로 복원되면 키 하나만 유지
+    bool constant = true;
+    for (uint32_t i = 0; i < keyCount && constant; i++) {
+        constant = keyError(i, &decoded[0]) <= tolerance;
+    }
+
+    if (constant) {
+        kept.push_back(0);
+    } else {
+        // 2.2 그리디: anchor에서 가능한 한 먼 키까지 구간을 늘리고, 사이 키가 하나라도 오차를 넘으면 직전 키를 유지
+        std::vector<float> sample(n);
+        auto segmentFits = [&](uint32_t a, uint32_t b) {
+            float span = keyTimes[b] - keyTimes[a];
+            for (uint32_t i = a + 1; i < b; i++) {
+                const float* v0 = &decoded[a * n];
+                const float* v1 = &decoded[b * n];
+                const float* reconstructed = v0;
+                if (!step) {
+                    float t = span > 0.0f ? std::clamp((channel.times[i] - keyTimes[a]) / span, 0.0f, 1.0f) : 0.0f;
+                    if (rotation) {
+                        Animation::slerp(v0, v1, t, sample.data());
+                    } else {
+                        for (uint32_t c = 0; c < n; c++) sample[c] = v0[c] + (v1[c] - v0[c]) * t;
+                    }
+                    reconstructed = sample.data();
+                }
+                if (keyError(i, reconstructed) > tolerance) return false;
+            }
+            return true;
+        };
+
+        kept.push_back(0);
+        uint32_t anchor = 0;
+        for (uint32_t b = 2; b < keyCount; b++) {
+            if (b - anchor > kMaxSegmentKeys || !segmentFits(anchor, b)) {
+                anchor = b - 1;
+                kept.push_back(anchor);
+            }
+        }
+        if (keyCount > 1) kept.push_back(keyCount - 1);
+    }
+
+    // 3. 선택한 키만 압축 형식으로 저장 (원본 float 시간/rotation 값은 해제)
+    channel.quantizedTimes.resize(kept.size());
+    std::vector<float> values;
+    std::vector<uint16_t> packedRotations;
+    for (size_t k = 0; k < kept.size(); k++) {
+        uint32_t key = kept[k];
+        channel.quantizedTimes[k] = quantizedTimes[key];
+        if (rotation) {
+            packedRotations.insert(packedRotations.end(), &packed[key * 3], &packed[key * 3] + 3);
+        } else {
+            values.insert(values.end(), &channel.values[key * n], &channel.values[key * n] + n);
+        }
+    }
+    channel.timeOffset = timeOffset;
+    channel.timeScale = timeScale;
+    channel.packedRotations.swap(packedRotations);
+    channel.values.swap(values);
+    std::vector<float>().swap(channel.times);
+
+    stats.bytesAfter += getChannelBytes(channel);
+    stats.keysAfter += kept.size();
+    stats.channelsCompressed++;
+    return true;
+}
+
+void compressClip(Animation::Clip& clip, const Settings& settings, Stats& stats) {
+    for (auto& channel : clip.channels) {
+        compressChannel(channel, settings, stats);
+    }
+}
+} // namespace AnimationCompression
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "animation.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// 임포트 시 애니메이션 클립 압축 (결정적, 외부 의존성 없음)
+// 1. 키 시간은 16비트 눈금(고정 프레임레이트면 키 간격, 아니면 채널 구간 / 65535), rotation 값은 smallest-three 48비트로 양자화
+// 2. 양자화된 이웃 키 사이의 보간(LINEAR는 lerp/slerp, STEP은 이전 키 유지)으로
+//    허용 오차 안에서 복원되는 키를 제거 (값이 일정한 채널은 키 하나만 남김)
+// STEP/LINEAR 채널만 압축하고 CUBICSPLINE 채널은 그대로 둡니다. translation/scale/weights 값은 float를 유지합니다.
+// 압축된 채널은 Animation::sampleChannel/findSegment가 그대로 샘플링합니다.
+namespace AnimationCompression {
+    // 경로별 허용 오차 (제거한 키 위치에서 원본 값과의 차이)
+    struct Settings {
+        float rotationError = 0.001f;     // 회전 각도 (라디안)
+        float translationError = 0.0001f; // 거리 (모델 단위)
+        float scaleError = 0.0001f;       // 성분 차이
+        float weightError = 0.001f;       // 모프 가중치 차이
+    };
+
+    struct Stats {
+        size_t bytesBefore = 0;
+        size_t bytesAfter = 0;
+        size_t keysBefore = 0;
+        size_t keysAfter = 0;
+        uint32_t channelsCompressed = 0;
+    };
+
+    // channel을 제자리에서 압축. 압축하지 않은 채널(CUBICSPLINE, 이미 압축됨, 잘못된 채널)은 false
+    // stats에는 압축 여부와 관계없이 채널 크기와 키 수를 누적
+    bool compressChannel(Animation::Channel& channel, const Settings& settings, Stats& stats);
+    void compressClip(Animation::Clip& clip, const Settings& settings, Stats& stats);
+
+    // 채널 키 데이터 크기 (바이트, 시간 + 값)
+    size_t getChannelBytes(const Animation::Channel& channel);
+}
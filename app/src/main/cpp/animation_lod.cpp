@@ -0,0 +1,83 @@
+#include "animation_lod.h"
+
+#include <algorithm>
+
+void AnimationLod::setup(std::vector<int32_t> nodeObjects, uint32_t objectCount) {
+    mNodeObjects = std::move(nodeObjects);
+    mObjects.assign(objectCount, Object{});
+    mNodeMask.assign(mNodeObjects.size(), 1);
+    mFrame = 0;
+    mStats = Stats{};
+    mStats.objects = objectCount;
+}
+
+void AnimationLod::setBounds(uint32_t object, const glm::vec3& center, float radius) {
+    if (object >= mObjects.size()) return;
+    mObjects[object].center = center;
+    mObjects[object].radius = radius;
+}
+
+uint32_t AnimationLod::selectInterval(const Object& object, const Culling::Frustum& frustum,
+                                      const glm::vec3& cameraPosition, float projectionScale) const {
+    if (object.radius < 0.0f) return 1;
+    if (!Culling::isSphereVisible(frustum, object.center, object.radius)) return mSettings.offscreenInterval;
+
+    // 화면 지름(px) = 2r * projectionScale / 거리. 카메라가 구 안에 있으면 매 프레임
+    float distance = glm::length(object.center - cameraPosition) - object.radius;
+    if (distance <= 0.0f || projectionScale <= 0.0f) return 1;
+    float pixels = 2.0f * object.radius * projectionScale / distance;
+
+    uint32_t interval = 1;
+    float threshold = mSettings.fullRatePixels;
+    while (pixels < threshold && interval < mSettings.maxInterval) {
+        interval *= 2;
+        threshold *= 0.5f;
+    }
+    return std::min(interval, std::max(1u, mSettings.maxInterval));
+}
+
+uint32_t AnimationLod::schedule(const Culling::Frustum& frustum, const glm::vec3& cameraPosition,
+                                float projectionScale) {
+    mStats = Stats{};
+    mStats.objects = static_cast<uint32_t>(mObjects.size());
+    if (mObjects.empty()) return 0;
+
+    for (size_t i = 0; i < mObjects.size(); i++) {
+        Object& object = mObjects[i];
+        uint32_t interval = mSettings.enabled ? selectInterval(object, frustum, cameraPosition, projectionScale) : 1;
+
+        // 위상: (프레임 + 객체 인덱스) % 주기. 주기보다 오래 밀린 객체는 위상과 관계없이 바로 갱신
+        if (interval == 0) {
+            object.updated = !object.everUpdated; // 처음 한 번은 포즈를 만들어 둠
+            mStats.frozen++;
+        } else {
+            bool onPhase = (mFrame + i) % interval == 0;
+            bool overdue = !object.everUpdated || mFrame - object.lastUpdate > interval;
+            object.updated = onPhase || overdue;
+            if (interval == 1) {
+                mStats.fullRate++;
+            } else {
+                mStats.reducedRate++;
+            }
+        }
+
+        if (object.updated) {
+            object.lastUpdate = mFrame;
+            object.everUpdated = true;
+            mStats.updated++;
+        }
+    }
+
+    for (size_t node = 0; node < mNodeObjects.size(); node++) {
+        int32_t object = mNodeObjects[node];
+        mNodeMask[node] = (object < 0 || mObjects[object].updated) ? 1 : 0;
+    }
+
+    mFrame++;
+    return mStats.updated;
+}
+
+const uint8_t* AnimationLod::getNodeMask() const {
+    if (!mSettings.enabled || mObjects.empty()) return nullptr;
+    return mNodeMask.data();
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "culling.h"
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+// 애니메이션 갱신 빈도 조절 (애니메이션 LOD)
+// 애니메이션 객체(씬 그래프 노드 묶음)마다 월드 공간 바운딩 구로 가시성과 화면 크기를 판정해 갱신 주기를 고릅니다.
+// - 화면에서 fullRatePixels 이상이면 매 프레임, 절반 크기마다 주기를 2배로 늘려 maxInterval까지
+// - 화면 밖이면 offscreenInterval (0이면 정지)
+// 같은 주기의 객체는 객체 인덱스로 위상을 엇갈려 프레임마다 비슷한 수만 갱신하고(프레임 비용 평탄화),
+// 주기보다 오래 갱신되지 않은 객체(화면 밖에서 다시 들어온 객체 등)는 즉시 갱신합니다.
+// 재생 시간은 모든 객체가 함께 진행하므로 갱신될 때는 항상 현재 시간의 포즈를 샘플링합니다.
+class AnimationLod {
+public:
+    struct Settings {
+        bool enabled = true;
+        float fullRatePixels = 128.0f; // 바운딩 구의 화면 지름 (px)
+        uint32_t maxInterval = 8;      // 보이는 객체의 최대 갱신 주기 (프레임)
+        uint32_t offscreenInterval = 0; // 화면 밖 객체의 갱신 주기 (0이면 정지)
+    };
+
+    struct Stats {
+        uint32_t objects = 0;
+        uint32_t updated = 0;      // 이번 프레임에 갱신한 객체
+        uint32_t fullRate = 0;     // 매 프레임 갱신 대상
+        uint32_t reducedRate = 0;  // 주기 2 이상
+        uint32_t frozen = 0;       // 화면 밖에서 정지
+    };
+
+    AnimationLod() = default;
+    ~AnimationLod() = default;
+
+    // 복사 방지
+    AnimationLod(const AnimationLod&) = delete;
+    AnimationLod& operator=(const AnimationLod&) = delete;
+
+    // nodeObjects: 씬 그래프 노드 -> 객체 인덱스 (-1이면 항상 갱신)
+    void setup(std::vector<int32_t> nodeObjects, uint32_t objectCount);
+    void setSettings(const Settings& settings) { mSettings = settings; }
+    const Settings& getSettings() const { return mSettings; }
+
+    uint32_t getObjectCount() const { return static_cast<uint32_t>(mObjects.size()); }
+    // 이번 프레임의 객체 바운딩 구 (월드 공간, schedule 전에 설정). radius < 0이면 항상 갱신
+    void setBounds(uint32_t object, const glm::vec3& center, float radius);
+
+    // 이번 프레임에 갱신할 객체를 고르고 노드 마스크를 작성. 갱신할 객체 수 반환
+    // projectionScale = 화면 높이(px) / (2 * tan(fovY / 2))
+    uint32_t schedule(const Culling::Frustum& frustum, const glm::vec3& cameraPosition, float projectionScale);
+
+    // AnimationPlayer::update에 넘길 노드 마스크 (비활성 또는 객체가 없으면 nullptr = 모든 노드 갱신)
+    const uint8_t* getNodeMask() const;
+    bool isObjectUpdated(uint32_t object) const { return mObjects[object].updated; }
+    const Stats& getStats() const { return mStats; }
+
+private:
+    struct Object {
+        glm::vec3 center{0.0f};
+        float radius = -1.0f;
+        uint64_t lastUpdate = 0;
+        bool everUpdated = false;
+        bool updated = false;
+    };
+
+    Settings mSettings;
+    std::vector<int32_t> mNodeObjects;
+    std::vector<Object> mObjects;
+    std::vector<uint8_t> mNodeMask;
+    uint64_t mFrame = 0;
+    Stats mStats;
+
+    uint32_t selectInterval(const Object& object, const Culling::Frustum& frustum, const glm::vec3& cameraPosition,
+                            float projectionScale) const;
+};
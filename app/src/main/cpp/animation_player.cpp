@@ -0,0 +1,297 @@
+#include "animation_player.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cmath>
+
+void AnimationPlayer::setup(std::vector<Animation::Clip> clips, std::vector<NodePose> restPose) {
+    mClips = std::move(clips);
+    mRestPose = std::move(restPose);
+    mInstances.clear();
+
+    size_t nodeCount = mRestPose.size();
+    mAccTranslation.assign(nodeCount, glm::vec3(0.0f));
+    mAccRotation.assign(nodeCount, glm::vec4(0.0f));
+    mAccScale.assign(nodeCount, glm::vec3(0.0f));
+    mAccWeight.assign(nodeCount, glm::vec4(0.0f));
+    mTouched.assign(nodeCount, 0);
+    mTouchedNodes.clear();
+
+    // 잘못된 채널은 미리 제거해 update에서 검사하지 않도록 함
+    for (auto& clip : mClips) {
+        auto invalid = [&](const Animation::Channel& channel) {
+            if (channel.targetNode >= nodeCount || !Animation::isValid(channel)) {
+                LOGW("Animation '%s': dropping invalid channel (node %u)", clip.name.c_str(), channel.targetNode);
+                return true;
+            }
+            return false;
+        };
+        clip.channels.erase(std::remove_if(clip.channels.begin(), clip.channels.end(), invalid), clip.channels.end());
+    }
+
+    // 모프 가중치 구간: weights 채널이 있는 노드만 할당
+    mWeightOffsets.assign(nodeCount, -1);
+    mWeightCounts.assign(nodeCount, 0);
+    mWeights.clear();
+    for (const auto& clip : mClips) {
+        for (const auto& channel : clip.channels) {
+            if (channel.path != Animation::Path::Weights || mWeightOffsets[channel.targetNode] >= 0) continue;
+            uint32_t node = channel.targetNode;
+            mWeightOffsets[node] = static_cast<int32_t>(mWeights.size());
+            mWeightCounts[node] = channel.components;
+            std::vector<float>& rest = mRestPose[node].weights;
+            rest.resize(channel.components, 0.0f);
+            mWeights.insert(mWeights.end(), rest.begin(), rest.end());
+        }
+    }
+    mAccMorph.assign(mWeights.size(), 0.0f);
+
+    mClipBatchedChannels.assign(mClips.size(), 0);
+    for (size_t i = 0; i < mClips.size(); i++) {
+        for (const auto& channel : mClips[i].channels) {
+            if (isBatched(channel)) mClipBatchedChannels[i]++;
+        }
+    }
+}
+
+bool AnimationPlayer::isBatched(const Animation::Channel& channel) {
+    return channel.path == Animation::Path::Rotation && channel.interpolation == Animation::Interpolation::Linear;
+}
+
+int32_t AnimationPlayer::findClip(const std::string& name) const {
+    for (size_t i = 0; i < mClips.size(); i++) {
+        if (mClips[i].name == name) return static_cast<int32_t>(i);
+    }
+    return -1;
+}
+
+AnimationPlayer::Instance* AnimationPlayer::findInstance(uint32_t clip) {
+    for (auto& instance : mInstances) {
+        if (instance.clip == clip) return &instance;
+    }
+    return nullptr;
+}
+
+void AnimationPlayer::play(uint32_t clip, bool loop, float speed, float weight) {
+    if (clip >= mClips.size()) return;
+
+    Instance* instance = findInstance(clip);
+    if (!instance) {
+        mInstances.emplace_back();
+        instance = &mInstances.back();
+        instance->clip = clip;
+        instance->time = speed < 0.0f ? mClips[clip].duration : 0.0f;
+        instance->cursors.assign(mClips[clip].channels.size(), 0);
+    }
+    instance->loop = loop;
+    instance->speed = speed;
+    instance->weight = weight;
+}
+
+void AnimationPlayer::stop(uint32_t clip) {
+    mInstances.erase(std::remove_if(mInstances.begin(), mInstances.end(),
+                                    [clip](const Instance& instance) { return instance.clip == clip; }),
+                     mInstances.end());
+}
+
+void AnimationPlayer::stopAll() {
+    mInstances.clear();
+}
+
+void AnimationPlayer::setWeight(uint32_t clip, float weight) {
+    if (Instance* instance = findInstance(clip)) instance->weight = weight;
+}
+
+void AnimationPlayer::accumulate(const Animation::Channel& channel, const float* value, float weight) {
+    uint32_t node = channel.targetNode;
+    if (!mTouched[node]) {
+        mTouched[node] = 1;
+        mTouchedNodes.push_back(node);
+    }
+
+    switch (channel.path) {
+        case Animation::Path::Translation:
+            mAccTranslation[node] += glm::vec3(value[0], value[1], value[2]) * weight;
+            mAccWeight[node].x += weight;
+            break;
+        case Animation::Path::Rotation: {
+            // q와 -q는 같은 회전이므로 레스트 포즈와 같은 반구로 맞춘 뒤 누적 (정규화는 마지막에)
+            const glm::quat& rest = mRestPose[node].rotation;
+            float sign = (value[0] * rest.x + value[1] * rest.y + value[2] * rest.z + value[3] * rest.w) < 0.0f
+                         ? -weight : weight;
+            mAccRotation[node] += glm::vec4(value[0], value[1], value[2], value[3]) * sign;
+            mAccWeight[node].y += weight;
+            break;
+        }
+        case Animation::Path::Scale:
+            mAccScale[node] += glm::vec3(value[0], value[1], value[2]) * weight;
+            mAccWeight[node].z += weight;
+            break;
+        case Animation::Path::Weights: {
+            float* acc = &mAccMorph[mWeightOffsets[node]];
+            uint32_t count = std::min(channel.components, mWeightCounts[node]);
+            for (uint32_t i = 0; i < count; i++) acc[i] += value[i] * weight;
+            mAccWeight[node].w += weight;
+            break;
+        }
+    }
+}
+
+uint32_t AnimationPlayer::update(float deltaSeconds, SceneGraph& scene, const uint8_t* nodeMask) {
+    if (mInstances.empty()) return 0;
+
+    // 1. 시간 진행 후 채널 샘플링 -> 노드별 가중 누적
+    //    배치 모드에서는 LINEAR rotation 채널은 키 쌍만 SoA로 모아 두고 2단계에서 한 번에 보간
+    uint32_t sampled = 0;
+    size_t batchCount = 0;
+    if (mBatchedEvaluation) {
+        size_t capacity = 0;
+        for (const auto& instance : mInstances) capacity += mClipBatchedChannels[instance.clip];
+        mBatchA.resize(capacity);
+        mBatchB.resize(capacity);
+        mBatchOut.resize(capacity);
+        mBatchT.resize(mBatchA.x.size(), 0.0f);
+        mBatchTargets.resize(capacity);
+    }
+
+    float value[4];
+    float decodeBuffer[8]; // 압축 rotation 채널의 두 키 (SoA로 바로 옮기므로 채널마다 재사용)
+    for (auto& instance : mInstances) {
+        const Animation::Clip& clip = mClips[instance.clip];
+        instance.time += deltaSeconds * instance.speed;
+        if (clip.duration > 0.0f) {
+            if (instance.loop) {
+                instance.time = std::fmod(instance.time, clip.duration);
+                if (instance.time < 0.0f) instance.time += clip.duration;
+            } else {
+                instance.time = std::clamp(instance.time, 0.0f, clip.duration);
+            }
+        }
+        if (instance.weight <= 0.0f) continue;
+
+        for (size_t c = 0; c < clip.channels.size(); c++) {
+            const Animation::Channel& channel = clip.channels[c];
+            // 이번 프레임에 갱신하지 않는 노드는 이전 로컬 변환 유지 (커서는 다음 샘플링 때 다시 탐색)
+            if (nodeMask && !nodeMask[channel.targetNode]) continue;
+            sampled++;
+            if (mBatchedEvaluation && isBatched(channel)) {
+                Animation::Segment segment = Animation::findSegment(channel, instance.time, instance.cursors[c],
+                                                                    decodeBuffer);
+                mBatchA.x[batchCount] = segment.k0[0];
+                mBatchA.y[batchCount] = segment.k0[1];
+                mBatchA.z[batchCount] = segment.k0[2];
+                mBatchA.w[batchCount] = segment.k0[3];
+                mBatchB.x[batchCount] = segment.k1[0];
+                mBatchB.y[batchCount] = segment.k1[1];
+                mBatchB.z[batchCount] = segment.k1[2];
+                mBatchB.w[batchCount] = segment.k1[3];
+                mBatchT[batchCount] = segment.t;
+                mBatchTargets[batchCount] = { &channel, instance.weight };
+                batchCount++;
+                continue;
+            }
+
+            float* out = value;
+            if (channel.components > 4) {
+                mScratchWeights.resize(channel.components);
+                out = mScratchWeights.data();
+            }
+            Animation::sampleChannel(channel, instance.time, instance.cursors[c], out);
+            accumulate(channel, out, instance.weight);
+        }
+    }
+
+    // 2. 모아 둔 rotation 채널을 4개씩 SIMD로 보간한 뒤 누적
+    if (batchCount > 0) {
+        AnimationSimd::slerp(mBatchA, mBatchB, mBatchT.data(), mBatchOut, batchCount);
+        for (size_t i = 0; i < batchCount; i++) {
+            float q[4] = { mBatchOut.x[i], mBatchOut.y[i], mBatchOut.z[i], mBatchOut.w[i] };
+            accumulate(*mBatchTargets[i].channel, q, mBatchTargets[i].weight);
+        }
+    }
+
+    // 3. 구동된 노드만 레스트 포즈와 합성 (가중치 합이 1 미만이면 남은 비율은 레스트 포즈)
+    //    TRS는 SoA로 모아 행렬 변환을 배치로 수행
+    size_t poseCount = 0;
+    mPoseTranslation.resize(mTouchedNodes.size());
+    mPoseRotation.resize(mTouchedNodes.size());
+    mPoseScale.resize(mTouchedNodes.size());
+    mPoseNodes.resize(mTouchedNodes.size());
+    for (uint32_t node : mTouchedNodes) {
+        const NodePose& rest = mRestPose[node];
+        glm::vec4 w = mAccWeight[node];
+
+        glm::vec3 translation = rest.translation;
+        if (w.x > 0.0f) {
+            glm::vec3 acc = mAccTranslation[node] + rest.translation * std::max(0.0f, 1.0f - w.x);
+            translation = acc / std::max(w.x, 1.0f);
+        }
+
+        glm::quat rotation = rest.rotation;
+        if (w.y > 0.0f) {
+            glm::vec4 acc = mAccRotation[node] +
+                            glm::vec4(rest.rotation.x, rest.rotation.y, rest.rotation.z, rest.rotation.w) *
+                            std::max(0.0f, 1.0f - w.y);
+            float length = std::sqrt(glm::dot(acc, acc));
+            if (length > 0.0f) rotation = glm::quat(acc.w / length, acc.x / length, acc.y / length, acc.z / length);
+        }
+
+        glm::vec3 scale = rest.scale;
+        if (w.z > 0.0f) {
+            glm::vec3 acc = mAccScale[node] + rest.scale * std::max(0.0f, 1.0f - w.z);
+            scale = acc / std::max(w.z, 1.0f);
+        }
+
+        if (w.w > 0.0f) {
+            int32_t offset = mWeightOffsets[node];
+            for (uint32_t i = 0; i < mWeightCounts[node]; i++) {
+                float acc = mAccMorph[offset + i] + rest.weights[i] * std::max(0.0f, 1.0f - w.w);
+                mWeights[offset + i] = acc / std::max(w.w, 1.0f);
+                mAccMorph[offset + i] = 0.0f;
+            }
+        }
+
+        if (w.x > 0.0f || w.y > 0.0f || w.z > 0.0f) {
+            if (mBatchedEvaluation) {
+                mPoseTranslation.x[poseCount] = translation.x;
+                mPoseTranslation.y[poseCount] = translation.y;
+                mPoseTranslation.z[poseCount] = translation.z;
+                mPoseRotation.x[poseCount] = rotation.x;
+                mPoseRotation.y[poseCount] = rotation.y;
+                mPoseRotation.z[poseCount] = rotation.z;
+                mPoseRotation.w[poseCount] = rotation.w;
+                mPoseScale.x[poseCount] = scale.x;
+                mPoseScale.y[poseCount] = scale.y;
+                mPoseScale.z[poseCount] = scale.z;
+                mPoseNodes[poseCount] = node;
+                poseCount++;
+            } else {
+                scene.setLocalTransform(node, translation, rotation, scale);
+            }
+        }
+
+        mAccTranslation[node] = glm::vec3(0.0f);
+        mAccRotation[node] = glm::vec4(0.0f);
+        mAccScale[node] = glm::vec3(0.0f);
+        mAccWeight[node] = glm::vec4(0.0f);
+        mTouched[node] = 0;
+    }
+    mTouchedNodes.clear();
+
+    if (poseCount > 0) {
+        mPoseMatrices.resize(poseCount);
+        AnimationSimd::composeTransforms(mPoseTranslation, mPoseRotation, mPoseScale, mPoseMatrices.data(), poseCount);
+        for (size_t i = 0; i < poseCount; i++) scene.setLocalMatrix(mPoseNodes[i], mPoseMatrices[i]);
+    }
+
+    return sampled;
+}
+
+const float* AnimationPlayer::getMorphWeights(uint32_t node, uint32_t& count) const {
+    if (node >= mWeightOffsets.size() || mWeightOffsets[node] < 0) {
+        count = 0;
+        return nullptr;
+    }
+    count = mWeightCounts[node];
+    return &mWeights[mWeightOffsets[node]];
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "animation.h"
+#include "animation_simd.h"
+#include "scene_graph.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 여러 클립을 동시에 재생해 씬 그래프 노드의 로컬 변환(과 모프 가중치)을 갱신
+// - 같은 노드/경로를 여러 클립이 구동하면 클립 가중치로 블렌딩 (합이 1 미만이면 나머지는 레스트 포즈)
+// - 클립 인스턴스마다 채널별 키 커서를 유지하므로 프레임당 비용은 채널 수에 비례
+// - 배치 모드(기본)에서는 LINEAR rotation 보간과 TRS -> 행렬 변환을 SoA로 모아 SIMD로 처리
+//   (rotation은 slerp 근사를 사용하므로 스칼라 경로와 1e-3 rad 미만 차이)
+class AnimationPlayer {
+public:
+    // 노드의 레스트 포즈 (glTF 노드의 TRS와 메시 기본 모프 가중치)
+    struct NodePose {
+        glm::vec3 translation{0.0f};
+        glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+        glm::vec3 scale{1.0f};
+        std::vector<float> weights;
+    };
+
+    AnimationPlayer() = default;
+    ~AnimationPlayer() = default;
+
+    // 복사 방지
+    AnimationPlayer(const AnimationPlayer&) = delete;
+    AnimationPlayer& operator=(const AnimationPlayer&) = delete;
+
+    // restPose는 씬 그래프 노드 순서. 채널의 targetNode도 씬 그래프 인덱스여야 함
+    void setup(std::vector<Animation::Clip> clips, std::vector<NodePose> restPose);
+
+    uint32_t getClipCount() const { return static_cast<uint32_t>(mClips.size()); }
+    const Animation::Clip& getClip(uint32_t clip) const { return mClips[clip]; }
+    int32_t findClip(const std::string& name) const;
+
+    // 이미 재생 중인 클립이면 파라미터만 갱신
+    void play(uint32_t clip, bool loop = true, float speed = 1.0f, float weight = 1.0f);
+    void stop(uint32_t clip);
+    void stopAll();
+    void setWeight(uint32_t clip, float weight);
+    bool isPlaying() const { return !mInstances.empty(); }
+
+    // 재생 시간을 진행하고 샘플링 결과를 scene에 반영 (dirty 표시만, 월드 행렬 갱신은 scene.update())
+    // nodeMask(노드 인덱스 기준, 0이면 건너뜀)가 있으면 해당 노드를 구동하는 채널만 샘플링하고 재생 시간은 모두 진행
+    // 샘플링한 채널 수 반환
+    uint32_t update(float deltaSeconds, SceneGraph& scene, const uint8_t* nodeMask = nullptr);
+
+    // false면 채널/노드마다 스칼라로 평가 (비교/디버깅용)
+    void setBatchedEvaluation(bool enabled) { mBatchedEvaluation = enabled; }
+
+    // 노드의 현재 모프 가중치 (weights 채널이 없는 노드는 nullptr)
+    const float* getMorphWeights(uint32_t node, uint32_t& count) const;
+
+private:
+    struct Instance {
+        uint32_t clip = 0;
+        float time = 0.0f;
+        float speed = 1.0f;
+        float weight = 1.0f;
+        bool loop = true;
+        std::vector<uint32_t> cursors; // 채널별 키 커서
+    };
+
+    std::vector<Animation::Clip> mClips;
+    std::vector<NodePose> mRestPose;
+    std::vector<Instance> mInstances;
+
+    // 프레임 누적 버퍼 (노드 인덱스 기준, 이번 프레임에 구동된 노드만 사용)
+    std::vector<glm::vec3> mAccTranslation;
+    std::vector<glm::vec4> mAccRotation;
+    std::vector<glm::vec3> mAccScale;
+    std::vector<glm::vec4> mAccWeight; // (translation, rotation, scale, weights) 가중치 합
+    std::vector<uint8_t> mTouched;
+    std::vector<uint32_t> mTouchedNodes;
+
+    // 모프 가중치: 노드마다 mWeights 안의 구간
+    std::vector<int32_t> mWeightOffsets; // -1이면 weights 채널 없음
+    std::vector<uint32_t> mWeightCounts;
+    std::vector<float> mWeights;
+    std::vector<float> mAccMorph;
+
+    // 배치 평가 스크래치 (프레임마다 재사용)
+    struct BatchTarget {
+        const Animation::Channel* channel = nullptr;
+        float weight = 0.0f;
+    };
+    bool mBatchedEvaluation = true;
+    std::vector<uint32_t> mClipBatchedChannels; // 클립별 배치 대상 채널 수
+    AnimationSimd::QuatSoA mBatchA;
+    AnimationSimd::QuatSoA mBatchB;
+    AnimationSimd::QuatSoA mBatchOut;
+    std::vector<float> mBatchT;
+    std::vector<BatchTarget> mBatchTargets;
+    AnimationSimd::Vec3SoA mPoseTranslation;
+    AnimationSimd::QuatSoA mPoseRotation;
+    AnimationSimd::Vec3SoA mPoseScale;
+    std::vector<uint32_t> mPoseNodes;
+    std::vector<glm::mat4> mPoseMatrices;
+    std::vector<float> mScratchWeights;
+
+    static bool isBatched(const Animation::Channel& channel);
+    Instance* findInstance(uint32_t clip);
+    void accumulate(const Animation::Channel& channel, const float* value, float weight);
+};
@@ -0,0 +1,244 @@
+#include "animation_simd.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ANIMATION_SIMD_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define ANIMATION_SIMD_SSE2 1
+#endif
+
+namespace AnimationSimd {
+namespace {
+// 4-wide float 연산 래퍼. 알고리즘은 백엔드와 무관하게 하나만 작성
+#if defined(ANIMATION_SIMD_NEON)
+using Float4 = float32x4_t;
+inline Float4 load(const float* p) { return vld1q_f32(p); }
+inline void store(float* p, Float4 v) { vst1q_f32(p, v); }
+inline Float4 set1(float v) { return vdupq_n_f32(v); }
+inline Float4 add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+inline Float4 sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+inline Float4 mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+inline Float4 signBits(Float4 v) {
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), vdupq_n_u32(0x80000000u)));
+}
+inline Float4 xorBits(Float4 a, Float4 b) {
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+// 추정값 + 뉴턴-랩슨 2회 (상대 오차 ~1e-7)
+inline Float4 rsqrt(Float4 v) {
+    Float4 e = vrsqrteq_f32(v);
+    e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(v, e), e));
+    e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(v, e), e));
+    return e;
+}
+inline void transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+    float32x4x2_t t01 = vtrnq_f32(r0, r1);
+    float32x4x2_t t23 = vtrnq_f32(r2, r3);
+    r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+    r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+    r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+    r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+#elif defined(ANIMATION_SIMD_SSE2)
+using Float4 = __m128;
+inline Float4 load(const float* p) { return _mm_loadu_ps(p); }
+inline void store(float* p, Float4 v) { _mm_storeu_ps(p, v); }
+inline Float4 set1(float v) { return _mm_set1_ps(v); }
+inline Float4 add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+inline Float4 sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+inline Float4 mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+inline Float4 signBits(Float4 v) { return _mm_and_ps(v, _mm_set1_ps(-0.0f)); }
+inline Float4 xorBits(Float4 a, Float4 b) { return _mm_xor_ps(a, b); }
+// 추정값(12비트) + 뉴턴-랩슨 1회
+inline Float4 rsqrt(Float4 v) {
+    Float4 e = _mm_rsqrt_ps(v);
+    Float4 half = _mm_mul_ps(v, _mm_set1_ps(0.5f));
+    return _mm_mul_ps(e, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(half, _mm_mul_ps(e, e))));
+}
+inline void transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+#else
+struct Float4 {
+    float v[4];
+};
+inline Float4 load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+inline void store(float* p, Float4 a) { std::memcpy(p, a.v, sizeof(a.v)); }
+inline Float4 set1(float s) { return { { s, s, s, s } }; }
+#define ANIMATION_SIMD_SCALAR_OP(name, expr)                      \
+    inline Float4 name(Float4 a, Float4 b) {                      \
+        Float4 r;                                                 \
+        for (int i = 0; i < 4; i++) r.v[i] = expr;                \
+        return r;                                                 \
+    }
+ANIMATION_SIMD_SCALAR_OP(add, a.v[i] + b.v[i])
+ANIMATION_SIMD_SCALAR_OP(sub, a.v[i] - b.v[i])
+ANIMATION_SIMD_SCALAR_OP(mul, a.v[i] * b.v[i])
+#undef ANIMATION_SIMD_SCALAR_OP
+inline Float4 signBits(Float4 a) {
+    Float4 r;
+    for (int i = 0; i < 4; i++) r.v[i] = std::signbit(a.v[i]) ? -0.0f : 0.0f;
+    return r;
+}
+inline Float4 xorBits(Float4 a, Float4 b) {
+    Float4 r;
+    for (int i = 0; i < 4; i++) {
+        uint32_t x;
+        uint32_t y;
+        std::memcpy(&x, &a.v[i], 4);
+        std::memcpy(&y, &b.v[i], 4);
+        x ^= y;
+        std::memcpy(&r.v[i], &x, 4);
+    }
+    return r;
+}
+inline Float4 rsqrt(Float4 a) {
+    Float4 r;
+    for (int i = 0; i < 4; i++) r.v[i] = 1.0f / std::sqrt(a.v[i]);
+    return r;
+}
+inline void transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+    Float4 m[4] = { r0, r1, r2, r3 };
+    for (int i = 0; i < 4; i++) {
+        r0.v[i] = m[i].v[0];
+        r1.v[i] = m[i].v[1];
+        r2.v[i] = m[i].v[2];
+        r3.v[i] = m[i].v[3];
+    }
+}
+#endif
+
+inline Float4 madd(Float4 a, Float4 b, Float4 c) { return add(mul(a, b), c); }
+
+inline size_t paddedCount(size_t count) { return (count + 3) & ~size_t(3); }
+
+// 공통 구현: correct가 true면 Zeux의 slerp 근사 보정(t 재매핑)을 적용
+void interpolateQuats(const QuatSoA& a, const QuatSoA& b, const float* t, QuatSoA& out, size_t count,
+                      bool correct) {
+    for (size_t i = 0; i < count; i += 4) {
+        Float4 ax = load(&a.x[i]), ay = load(&a.y[i]), az = load(&a.z[i]), aw = load(&a.w[i]);
+        Float4 bx = load(&b.x[i]), by = load(&b.y[i]), bz = load(&b.z[i]), bw = load(&b.w[i]);
+        Float4 tt = load(&t[i]);
+
+        // 최단 경로: dot < 0이면 b의 부호를 뒤집음 (부호 비트 xor)
+        Float4 d = madd(ax, bx, madd(ay, by, madd(az, bz, mul(aw, bw))));
+        Float4 sign = signBits(d);
+        bx = xorBits(bx, sign);
+        by = xorBits(by, sign);
+        bz = xorBits(bz, sign);
+        bw = xorBits(bw, sign);
+
+        if (correct) {
+            // k = A * (t - 0.5)^2 + B, t' = t + t * (t - 0.5) * (t - 1) * k (A, B는 |dot|의 다항식)
+            Float4 ad = xorBits(d, sign);
+            Float4 A = madd(ad, madd(ad, madd(ad, set1(-1.43519f), set1(3.55645f)), set1(-3.2452f)), set1(1.0904f));
+            Float4 B = madd(ad, madd(ad, set1(0.215638f), set1(-1.06021f)), set1(0.848013f));
+            Float4 th = sub(tt, set1(0.5f));
+            Float4 k = madd(mul(A, th), th, B);
+            tt = madd(mul(mul(tt, th), sub(tt, set1(1.0f))), k, tt);
+        }
+
+        Float4 rx = madd(sub(bx, ax), tt, ax);
+        Float4 ry = madd(sub(by, ay), tt, ay);
+        Float4 rz = madd(sub(bz, az), tt, az);
+        Float4 rw = madd(sub(bw, aw), tt, aw);
+        Float4 inv = rsqrt(madd(rx, rx, madd(ry, ry, madd(rz, rz, mul(rw, rw)))));
+        store(&out.x[i], mul(rx, inv));
+        store(&out.y[i], mul(ry, inv));
+        store(&out.z[i], mul(rz, inv));
+        store(&out.w[i], mul(rw, inv));
+    }
+}
+} // namespace
+
+void Vec3SoA::resize(size_t count) {
+    size_t padded = paddedCount(count);
+    x.resize(padded, 0.0f);
+    y.resize(padded, 0.0f);
+    z.resize(padded, 0.0f);
+}
+
+void QuatSoA::resize(size_t count) {
+    size_t padded = paddedCount(count);
+    x.resize(padded, 0.0f);
+    y.resize(padded, 0.0f);
+    z.resize(padded, 0.0f);
+    w.resize(padded, 1.0f); // 패딩 레인도 단위 쿼터니언 (정규화 시 0 나눗셈 방지)
+}
+
+void nlerp(const QuatSoA& a, const QuatSoA& b, const float* t, QuatSoA& out, size_t count) {
+    interpolateQuats(a, b, t, out, count, false);
+}
+
+void slerp(const QuatSoA& a, const QuatSoA& b, const float* t, QuatSoA& out, size_t count) {
+    interpolateQuats(a, b, t, out, count, true);
+}
+
+void lerp(const Vec3SoA& a, const Vec3SoA& b, const float* t, Vec3SoA& out, size_t count) {
+    for (size_t i = 0; i < count; i += 4) {
+        Float4 tt = load(&t[i]);
+        Float4 ax = load(&a.x[i]), ay = load(&a.y[i]), az = load(&a.z[i]);
+        store(&out.x[i], madd(sub(load(&b.x[i]), ax), tt, ax));
+        store(&out.y[i], madd(sub(load(&b.y[i]), ay), tt, ay));
+        store(&out.z[i], madd(sub(load(&b.z[i]), az), tt, az));
+    }
+}
+
+void composeTransforms(const Vec3SoA& translation, const QuatSoA& rotation, const Vec3SoA& scale,
+                       glm::mat4* out, size_t count) {
+    const Float4 one = set1(1.0f);
+    const Float4 two = set1(2.0f);
+    const Float4 zero = set1(0.0f);
+
+    for (size_t i = 0; i < count; i += 4) {
+        Float4 qx = load(&rotation.x[i]), qy = load(&rotation.y[i]);
+        Float4 qz = load(&rotation.z[i]), qw = load(&rotation.w[i]);
+        Float4 sx = load(&scale.x[i]), sy = load(&scale.y[i]), sz = load(&scale.z[i]);
+
+        Float4 x2 = mul(qx, two), y2 = mul(qy, two), z2 = mul(qz, two);
+        Float4 xx = mul(qx, x2), yy = mul(qy, y2), zz = mul(qz, z2);
+        Float4 xy = mul(qx, y2), xz = mul(qx, z2), yz = mul(qy, z2);
+        Float4 wx = mul(qw, x2), wy = mul(qw, y2), wz = mul(qw, z2);
+
+        // 열 단위 (glm::mat4_cast와 같은 배치) 후 스케일
+        Float4 c0x = mul(sub(one, add(yy, zz)), sx), c0y = mul(add(xy, wz), sx), c0z = mul(sub(xz, wy), sx);
+        Float4 c1x = mul(sub(xy, wz), sy), c1y = mul(sub(one, add(xx, zz)), sy), c1z = mul(add(yz, wx), sy);
+        Float4 c2x = mul(add(xz, wy), sz), c2y = mul(sub(yz, wx), sz), c2z = mul(sub(one, add(xx, yy)), sz);
+        Float4 c3x = load(&translation.x[i]), c3y = load(&translation.y[i]), c3z = load(&translation.z[i]);
+        Float4 c0w = zero, c1w = zero, c2w = zero, c3w = one;
+
+        // 성분별 벡터(노드 4개) -> 노드별 열 벡터로 전치
+        transpose(c0x, c0y, c0z, c0w);
+        transpose(c1x, c1y, c1z, c1w);
+        transpose(c2x, c2y, c2z, c2w);
+        transpose(c3x, c3y, c3z, c3w);
+        Float4 columns[4][4] = {
+            { c0x, c1x, c2x, c3x },
+            { c0y, c1y, c2y, c3y },
+            { c0z, c1z, c2z, c3z },
+            { c0w, c1w, c2w, c3w },
+        };
+
+        size_t lanes = (count - i) < 4 ? (count - i) : 4;
+        for (size_t lane = 0; lane < lanes; lane++) {
+            float* m = &out[i + lane][0][0];
+            for (int column = 0; column < 4; column++) store(m + column * 4, columns[lane][column]);
+        }
+    }
+}
+
+const char* getBackendName() {
+#if defined(ANIMATION_SIMD_NEON)
+    return "NEON";
+#elif defined(ANIMATION_SIMD_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+} // namespace AnimationSimd
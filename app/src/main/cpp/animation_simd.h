@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <glm/glm.hpp>
+
+// 애니메이션 배치 평가 (SoA + 4-wide SIMD)
+// 채널/노드 단위 스칼라 연산 대신 같은 종류의 샘플을 성분별 배열로 모아 4개씩 처리합니다.
+// 백엔드: ARM은 NEON, x86 호스트는 SSE2, 그 외에는 같은 알고리즘의 스칼라 구현
+namespace AnimationSimd {
+    // 성분별 배열. resize는 4의 배수로 올려 잡고 0으로 채우므로 마지막 묶음도 벡터로 읽고 쓸 수 있음
+    struct Vec3SoA {
+        std::vector<float> x, y, z;
+        void resize(size_t count);
+    };
+
+    struct QuatSoA {
+        std::vector<float> x, y, z, w;
+        void resize(size_t count);
+    };
+
+    // out[i] = normalize(lerp(a[i], sign * b[i], t[i])) (최단 경로)
+    void nlerp(const QuatSoA& a, const QuatSoA& b, const float* t, QuatSoA& out, size_t count);
+
+    // slerp 근사: t를 3차 다항식으로 보정한 nlerp (삼각 함수 없이 각도 오차 1e-3 rad 미만)
+    void slerp(const QuatSoA& a, const QuatSoA& b, const float* t, QuatSoA& out, size_t count);
+
+    // out[i] = a[i] + (b[i] - a[i]) * t[i]
+    void lerp(const Vec3SoA& a, const Vec3SoA& b, const float* t, Vec3SoA& out, size_t count);
+
+    // TRS -> 4x4 행렬 (T * R * S, rotation은 정규화되어 있어야 함)
+    void composeTransforms(const Vec3SoA& translation, const QuatSoA& rotation, const Vec3SoA& scale,
+                           glm::mat4* out, size_t count);
+
+    // 컴파일된 백엔드 이름 ("NEON", "SSE2", "scalar")
+    const char* getBackendName();
+}
@@ -0,0 +1,34 @@
+#include "arena.h"
+
+Arena::Arena(size_t blockSize) : mBlockSize(blockSize) {
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    size_t padding = (alignment - reinterpret_cast<uintptr_t>(mCursor) % alignment) % alignment;
+    if (!mCursor || padding + size > mRemaining) {
+        // 블록 크기의 1/4보다 큰 요청은 전용 블록으로 (현재 블록의 남은 공간을 버리지 않도록 커서는 유지)
+        size_t blockSize = size + alignment;
+        if (blockSize > mBlockSize / 4) {
+            mBlocks.emplace_back(new uint8_t[blockSize]);
+            mReservedBytes += blockSize;
+            uint8_t* block = mBlocks.back().get();
+            return block + (alignment - reinterpret_cast<uintptr_t>(block) % alignment) % alignment;
+        }
+        mBlocks.emplace_back(new uint8_t[mBlockSize]);
+        mReservedBytes += mBlockSize;
+        mCursor = mBlocks.back().get();
+        mRemaining = mBlockSize;
+        padding = (alignment - reinterpret_cast<uintptr_t>(mCursor) % alignment) % alignment;
+    }
+    void* result = mCursor + padding;
+    mCursor += padding + size;
+    mRemaining -= padding + size;
+    return result;
+}
+
+void Arena::reset() {
+    mBlocks.clear();
+    mCursor = nullptr;
+    mRemaining = 0;
+    mReservedBytes = 0;
+}
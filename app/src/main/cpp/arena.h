@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// 큰 블록에서 순서대로 잘라 쓰는 선형 할당기
+// 개별 해제 없이 소멸(또는 reset) 시 한 번에 해제하므로, 로드 동안만 쓰는 작은 객체가 많은 경우
+// (glTF 문서의 노드/접근자/문자열 등) 할당 횟수와 힙 단편화를 줄입니다.
+// 소멸자를 호출하지 않으므로 trivially destructible 타입만 담습니다.
+class Arena {
+public:
+    explicit Arena(size_t blockSize = 64 * 1024);
+    ~Arena() = default;
+
+    // 복사 방지
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // alignment는 2의 거듭제곱
+    void* allocate(size_t size, size_t alignment);
+
+    // 기본 생성된 T count개
+    template <typename T>
+    T* allocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible<T>::value, "arena objects are never destroyed");
+        if (count == 0) return nullptr;
+        T* data = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        for (size_t i = 0; i < count; i++) new (data + i) T();
+        return data;
+    }
+
+    template <typename T>
+    T* copyArray(const T* source, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "arena copies are plain memcpy");
+        if (count == 0) return nullptr;
+        T* data = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        std::memcpy(data, source, sizeof(T) * count);
+        return data;
+    }
+
+    // 모든 블록 해제 (이전에 할당한 포인터는 무효)
+    void reset();
+
+    // 블록으로 확보한 총 바이트 (사용량이 아닌 힙 점유량)
+    size_t getReservedBytes() const { return mReservedBytes; }
+
+private:
+    std::vector<std::unique_ptr<uint8_t[]>> mBlocks;
+    size_t mBlockSize;
+    uint8_t* mCursor = nullptr;
+    size_t mRemaining = 0;
+    size_t mReservedBytes = 0;
+};
@@ -5,8 +5,19 @@
 #include "asset_utils.h"
 #include "Log.h"
 
+#include <cstring>
+
+#ifndef __ANDROID__
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace AssetUtils {
 
+#ifdef __ANDROID__
     std::vector<uint32_t> loadSpirvFromAssets(AAssetManager* assetManager, const char* filename) {
         AAsset* asset = AAssetManager_open(assetManager, filename, AASSET_MODE_BUFFER);
 
@@ -26,4 +37,143 @@ namespace AssetUtils {
 
         return buffer;
     }
-}
\ No newline at end of file
+
+    bool MappedAsset::open(AAssetManager* assetManager, const std::string& filename) {
+        close();
+        // AASSET_MODE_BUFFER: 압축되지 않은 에셋은 APK를 직접 mmap한 포인터를 돌려줌
+        mAsset = AAssetManager_open(assetManager, filename.c_str(), AASSET_MODE_BUFFER);
+        if (!mAsset) {
+            LOGE("Failed to open asset: %s", filename.c_str());
+            return false;
+        }
+        mData = static_cast<const uint8_t*>(AAsset_getBuffer(mAsset));
+        mSize = static_cast<size_t>(AAsset_getLength64(mAsset));
+        if (!mData) {
+            LOGE("Failed to map asset: %s", filename.c_str());
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void MappedAsset::close() {
+        if (mAsset) AAsset_close(mAsset);
+        mAsset = nullptr;
+        mData = nullptr;
+        mSize = 0;
+    }
+#else
+    namespace {
+        std::string gHostAssetRoot = "assets";
+    }
+
+    void setHostAssetRoot(const std::string& root) {
+        gHostAssetRoot = root;
+    }
+
+    std::string resolveHostAssetPath(const std::string& filename) {
+        if (gHostAssetRoot.empty()) return filename;
+        return gHostAssetRoot + "/" + filename;
+    }
+
+    std::vector<uint32_t> loadSpirvFromAssets(AAssetManager* /*assetManager*/, const char* filename) {
+        std::string path = resolveHostAssetPath(filename);
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+        if (!file.is_open()) {
+            LOGE("Failed to open asset: %s", path.c_str());
+            return {};
+        }
+
+        size_t size = static_cast<size_t>(file.tellg());
+        if (size % 4 != 0) {
+            LOGE("SPIR-V file size is not multiple of 4: %s", filename);
+        }
+
+        std::vector<uint32_t> buffer(size / 4);
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size() * 4));
+
+        return buffer;
+    }
+
+    bool MappedAsset::open(AAssetManager* /*assetManager*/, const std::string& filename) {
+        close();
+        std::string path = resolveHostAssetPath(filename);
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            LOGE("Failed to open asset: %s", path.c_str());
+            return false;
+        }
+        struct stat info {};
+        if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+            LOGE("Failed to map empty or unreadable asset: %s", path.c_str());
+            ::close(fd);
+            return false;
+        }
+        // 매핑은 fd를 닫아도 유지됨
+        void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            LOGE("Failed to map asset: %s", path.c_str());
+            return false;
+        }
+        mData = static_cast<const uint8_t*>(mapping);
+        mSize = static_cast<size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedAsset::close() {
+        if (mData) munmap(const_cast<uint8_t*>(mData), mSize);
+        mData = nullptr;
+        mSize = 0;
+    }
+#endif
+
+    MappedAsset::~MappedAsset() {
+        close();
+    }
+
+    bool isGlb(ByteSpan bytes) {
+        return bytes.size >= 4 && std::memcmp(bytes.data, "glTF", 4) == 0;
+    }
+
+    bool parseGlb(ByteSpan bytes, GlbChunks& out) {
+        // 헤더 12바이트 + 청크마다 (길이, 타입) 8바이트, 모든 값은 little-endian uint32
+        constexpr uint32_t kChunkJson = 0x4E4F534A;
+        constexpr uint32_t kChunkBin = 0x004E4942;
+        auto readU32 = [&](size_t offset) {
+            uint32_t value;
+            std::memcpy(&value, bytes.data + offset, 4);
+            return value;
+        };
+
+        out = GlbChunks{};
+        if (!isGlb(bytes) || bytes.size < 20) return false;
+        uint32_t version = readU32(4);
+        uint32_t length = readU32(8);
+        if (version != 2 || length > bytes.size) {
+            LOGE("Invalid GLB header (version %u, length %u, file %zu bytes)", version, length, bytes.size);
+            return false;
+        }
+
+        uint32_t jsonLength = readU32(12);
+        if (readU32(16) != kChunkJson || 20ull + jsonLength > length) {
+            LOGE("GLB: first chunk must be JSON");
+            return false;
+        }
+        out.json = { bytes.data + 20, jsonLength };
+
+        // BIN 청크는 선택 사항 (없거나 알 수 없는 타입이면 비워 둠)
+        size_t binHeader = 20ull + jsonLength;
+        if (binHeader + 8 <= length && readU32(binHeader + 4) == kChunkBin) {
+            uint32_t binLength = readU32(binHeader);
+            if (binHeader + 8 + binLength > length) {
+                LOGE("GLB: BIN chunk exceeds file length");
+                return false;
+            }
+            out.bin = { bytes.data + binHeader + 8, binLength };
+        }
+        return true;
+    }
+}
@@ -1,11 +1,68 @@
 #pragma once
 
 #include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <string>
+
+#ifdef __ANDROID__
 #include <android/asset_manager.h>
+#else
+// 호스트 빌드에는 AAssetManager가 없으므로 불투명 타입만 선언 (항상 nullptr로 전달)
+struct AAssetManager;
+#endif
 
 namespace AssetUtils {
 
 std::vector<uint32_t> loadSpirvFromAssets(AAssetManager* assetManager, const char* filename);
 
-} // namespace AssetUtils
\ No newline at end of file
+// 소유하지 않는 읽기 전용 바이트 범위
+struct ByteSpan {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+// 에셋 하나를 읽기 전용 메모리로 매핑 (Android: AAsset_getBuffer, 호스트: mmap)
+// 파일 내용을 std::vector로 읽어 들이지 않으므로 큰 .glb의 BIN 청크를 사본 없이 바로 읽을 수 있습니다.
+// 압축되어 패키징된 Android 에셋은 AAsset_getBuffer가 압축을 풀어 메모리에 올리므로 .glb는 noCompress로 패키징합니다.
+class MappedAsset {
+public:
+    MappedAsset() = default;
+    ~MappedAsset();
+
+    // 복사 방지
+    MappedAsset(const MappedAsset&) = delete;
+    MappedAsset& operator=(const MappedAsset&) = delete;
+
+    bool open(AAssetManager* assetManager, const std::string& filename);
+    void close();
+
+    // 매핑은 close 또는 소멸 전까지만 유효
+    ByteSpan getBytes() const { return { mData, mSize }; }
+
+private:
+    const uint8_t* mData = nullptr;
+    size_t mSize = 0;
+#ifdef __ANDROID__
+    AAsset* mAsset = nullptr;
+#endif
+};
+
+// GLB 컨테이너의 청크 범위 (bin은 BIN 청크가 없으면 비어 있음)
+struct GlbChunks {
+    ByteSpan json;
+    ByteSpan bin;
+};
+
+// 매직 "glTF"로 시작하는지 검사
+bool isGlb(ByteSpan bytes);
+// 헤더(매직/버전 2/전체 길이)와 JSON/BIN 청크 경계 검증 후 청크 범위 반환 (복사 없음)
+bool parseGlb(ByteSpan bytes, GlbChunks& out);
+
+#ifndef __ANDROID__
+// 호스트 빌드: assets 폴더 역할을 하는 디렉터리 지정 및 에셋 경로 변환
+void setHostAssetRoot(const std::string& root);
+std::string resolveHostAssetPath(const std::string& filename);
+#endif
+
+} // namespace AssetUtils
@@ -0,0 +1,299 @@
+#include "baked_model.h"
+#include "Log.h"
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace BakedModel {
+namespace {
+// 파일 레이아웃이 곧 메모리 레이아웃이므로 레코드는 memcpy 가능해야 하고,
+// 4바이트 정렬 매핑(압축하지 않은 APK 에셋)에서 포인터로 바로 읽을 수 있어야 함
+template <typename T>
+constexpr bool isRecord() {
+    return std::is_trivially_copyable<T>::value && alignof(T) <= 4;
+}
+static_assert(isRecord<Vertex>() && isRecord<CompactVertex>(), "vertex layout must be a plain record");
+static_assert(isRecord<Primitive>() && isRecord<MeshletBuilder::Meshlet>() && isRecord<LodLevel>() &&
+              isRecord<Mesh>() && isRecord<Node>() && isRecord<Texture>() && isRecord<Material>() &&
+              isRecord<Clip>() && isRecord<Channel>(), "baked records must be plain 4-byte aligned structs");
+
+size_t alignUp(size_t value) {
+    return (value + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+}
+
+// [offset, offset + count)가 [0, size) 안에 있는지 (오버플로 없이)
+bool inRange(uint64_t offset, uint64_t count, uint64_t size) {
+    return offset <= size && count <= size - offset;
+}
+
+bool isValidRange(const Range& range, const Header& header) {
+    return inRange(range.firstIndex, range.indexCount, header.indexCount) && range.vertexOffset >= 0 &&
+           static_cast<uint32_t>(range.vertexOffset) <= header.vertexCount;
+}
+
+template <typename T>
+bool readArray(AssetUtils::ByteSpan bytes, const Header& header, SectionId id, Array<T>& out) {
+    const Section& section = header.sections[static_cast<size_t>(id)];
+    if (section.size % sizeof(T) != 0) return false;
+    out.data = reinterpret_cast<const T*>(bytes.data + section.offset);
+    out.count = static_cast<size_t>(section.size / sizeof(T));
+    return true;
+}
+
+AssetUtils::ByteSpan readBytes(AssetUtils::ByteSpan bytes, const Header& header, SectionId id) {
+    const Section& section = header.sections[static_cast<size_t>(id)];
+    return { bytes.data + section.offset, static_cast<size_t>(section.size) };
+}
+
+template <typename T>
+PoolRange appendPool(std::vector<T>& pool, const std::vector<T>& values) {
+    PoolRange range;
+    range.offset = static_cast<uint32_t>(pool.size());
+    range.count = static_cast<uint32_t>(values.size());
+    pool.insert(pool.end(), values.begin(), values.end());
+    return range;
+}
+
+template <typename T>
+std::vector<T> readPool(const Array<T>& pool, const PoolRange& range) {
+    return std::vector<T>(pool.data + range.offset, pool.data + range.offset + range.count);
+}
+} // namespace
+
+bool write(const Contents& contents, const std::string& path) {
+    // 1. 애니메이션: 클립/채널 레코드와 값 풀로 평탄화
+    std::vector<Clip> clips;
+    std::vector<Channel> channels;
+    std::vector<float> floats;
+    std::vector<uint16_t> shorts;
+    std::string strings;
+    for (const Animation::Clip& source : contents.clips) {
+        Clip clip;
+        clip.nameOffset = static_cast<uint32_t>(strings.size());
+        clip.nameLength = static_cast<uint32_t>(source.name.size());
+        clip.duration = source.duration;
+        clip.firstChannel = static_cast<uint32_t>(channels.size());
+        clip.channelCount = static_cast<uint32_t>(source.channels.size());
+        strings += source.name;
+        for (const Animation::Channel& sourceChannel : source.channels) {
+            Channel channel;
+            channel.targetNode = sourceChannel.targetNode;
+            channel.path = static_cast<uint8_t>(sourceChannel.path);
+            channel.interpolation = static_cast<uint8_t>(sourceChannel.interpolation);
+            channel.components = sourceChannel.components;
+            channel.timeOffset = sourceChannel.timeOffset;
+            channel.timeScale = sourceChannel.timeScale;
+            channel.times = appendPool(floats, sourceChannel.times);
+            channel.values = appendPool(floats, sourceChannel.values);
+            channel.quantizedTimes = appendPool(shorts, sourceChannel.quantizedTimes);
+            channel.packedRotations = appendPool(shorts, sourceChannel.packedRotations);
+            channels.push_back(channel);
+        }
+        clips.push_back(clip);
+    }
+
+    // 2. 텍스처: 픽셀을 이미지 순서대로 (텍스처마다 섹션 정렬 단위로 시작)
+    std::vector<Texture> textures;
+    std::vector<uint8_t> pixels;
+    for (const Image& image : contents.images) {
+        Texture texture;
+        if (!image.pixels.empty() && image.pixels.size() == static_cast<size_t>(image.width) * image.height * 4) {
+            pixels.resize(alignUp(pixels.size()));
+            texture.width = image.width;
+            texture.height = image.height;
+            texture.pixelOffset = static_cast<uint32_t>(pixels.size());
+            pixels.insert(pixels.end(), image.pixels.begin(), image.pixels.end());
+        }
+        textures.push_back(texture);
+    }
+
+    // 3. 헤더 + 섹션을 정렬하며 이어 붙임
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.vertexFormat = static_cast<uint32_t>(contents.vertexFormat);
+    header.vertexStride = static_cast<uint32_t>(contents.vertexFormat == VertexFormat::Compact
+                                                ? sizeof(CompactVertex) : sizeof(Vertex));
+    header.vertexCount = contents.vertexCount;
+    header.indexSize = contents.indexSize;
+    header.indexCount = contents.indexSize > 0 ? static_cast<uint32_t>(contents.indices.size() / contents.indexSize)
+                                               : 0;
+    std::vector<uint8_t> file(alignUp(sizeof(Header)));
+    auto addSection = [&](SectionId id, const void* data, size_t size) {
+        file.resize(alignUp(file.size()));
+        header.sections[static_cast<size_t>(id)] = { file.size(), size };
+        const uint8_t* begin = static_cast<const uint8_t*>(data);
+        if (size > 0) file.insert(file.end(), begin, begin + size);
+    };
+    auto addArray = [&](SectionId id, const auto& values) {
+        addSection(id, values.data(), values.size() * sizeof(values[0]));
+    };
+    addArray(SectionId::Vertices, contents.vertices);
+    addArray(SectionId::Indices, contents.indices);
+    addArray(SectionId::Primitives, contents.primitives);
+    addArray(SectionId::Clusters, contents.clusters);
+    addArray(SectionId::LodLevels, contents.lodLevels);
+    addArray(SectionId::Meshes, contents.meshes);
+    addArray(SectionId::Nodes, contents.nodes);
+    addArray(SectionId::NodeRemap, contents.nodeRemap);
+    addArray(SectionId::Textures, textures);
+    addArray(SectionId::Pixels, pixels);
+    addArray(SectionId::Materials, contents.materials);
+    addArray(SectionId::Clips, clips);
+    addArray(SectionId::Channels, channels);
+    addArray(SectionId::Floats, floats);
+    addArray(SectionId::Shorts, shorts);
+    addArray(SectionId::Strings, strings);
+    std::memcpy(file.data(), &header, sizeof(Header));
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()))) {
+        LOGE("Failed to write baked model: %s", path.c_str());
+        return false;
+    }
+    LOGI("Wrote baked model %s: %zu bytes (%u vertices, %u indices, %zu primitives, %zu textures, %zu clips)",
+         path.c_str(), file.size(), header.vertexCount, header.indexCount, contents.primitives.size(),
+         textures.size(), clips.size());
+    return true;
+}
+
+bool parse(AssetUtils::ByteSpan bytes, View& out) {
+    auto fail = [](const char* reason) {
+        LOGE("Invalid baked model: %s", reason);
+        return false;
+    };
+
+    // 1. 헤더와 섹션 범위
+    if (!bytes.data || reinterpret_cast<uintptr_t>(bytes.data) % 4 != 0) return fail("misaligned data");
+    if (bytes.size < sizeof(Header)) return fail("truncated header");
+    Header& header = out.header;
+    std::memcpy(&header, bytes.data, sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) return fail("bad magic");
+    if (header.version != kVersion || header.sectionCount != kSectionCount) return fail("unsupported version");
+    size_t expectedStride = header.vertexFormat == static_cast<uint32_t>(VertexFormat::Compact)
+                            ? sizeof(CompactVertex) : sizeof(Vertex);
+    if (header.vertexFormat > static_cast<uint32_t>(VertexFormat::Compact) || header.vertexStride != expectedStride) {
+        return fail("vertex layout mismatch");
+    }
+    if (header.indexSize != 2 && header.indexSize != 4) return fail("bad index size");
+    for (const Section& section : header.sections) {
+        if (section.offset % kSectionAlignment != 0 || section.offset < sizeof(Header) ||
+            !inRange(section.offset, section.size, bytes.size)) {
+            return fail("section out of range");
+        }
+    }
+
+    // 2. 섹션 -> 배열
+    out.vertices = readBytes(bytes, header, SectionId::Vertices);
+    out.indices = readBytes(bytes, header, SectionId::Indices);
+    out.pixels = readBytes(bytes, header, SectionId::Pixels);
+    out.strings = readBytes(bytes, header, SectionId::Strings);
+    if (!readArray(bytes, header, SectionId::Primitives, out.primitives) ||
+        !readArray(bytes, header, SectionId::Clusters, out.clusters) ||
+        !readArray(bytes, header, SectionId::LodLevels, out.lodLevels) ||
+        !readArray(bytes, header, SectionId::Meshes, out.meshes) ||
+        !readArray(bytes, header, SectionId::Nodes, out.nodes) ||
+        !readArray(bytes, header, SectionId::NodeRemap, out.nodeRemap) ||
+        !readArray(bytes, header, SectionId::Textures, out.textures) ||
+        !readArray(bytes, header, SectionId::Materials, out.materials) ||
+        !readArray(bytes, header, SectionId::Clips, out.clips) ||
+        !readArray(bytes, header, SectionId::Channels, out.channels) ||
+        !readArray(bytes, header, SectionId::Floats, out.floats) ||
+        !readArray(bytes, header, SectionId::Shorts, out.shorts)) {
+        return fail("section size is not a multiple of its record size");
+    }
+    if (out.vertices.size != static_cast<uint64_t>(header.vertexCount) * header.vertexStride ||
+        out.indices.size != static_cast<uint64_t>(header.indexCount) * header.indexSize) {
+        return fail("geometry size mismatch");
+    }
+
+    // 3. 레코드 간 참조 (인덱스 값 자체는 베이커가 정점 구간 안으로 보장)
+    for (const Primitive& primitive : out.primitives) {
+        if (!isValidRange(primitive.lod0, header) ||
+            !inRange(primitive.firstCluster, primitive.clusterCount, out.clusters.count) ||
+            !inRange(primitive.firstLod, primitive.lodCount, out.lodLevels.count) ||
+            primitive.material < -1 || primitive.material >= static_cast<int64_t>(out.materials.count)) {
+            return fail("primitive references out of range");
+        }
+        for (uint32_t c = 0; c < primitive.clusterCount; c++) {
+            const MeshletBuilder::Meshlet& cluster = out.clusters[primitive.firstCluster + c];
+            if (!inRange(cluster.firstIndex, cluster.indexCount, primitive.lod0.indexCount)) {
+                return fail("cluster out of primitive range");
+            }
+        }
+    }
+    for (const LodLevel& level : out.lodLevels) {
+        if (!isValidRange(level.range, header)) return fail("LOD range out of range");
+    }
+    for (const Mesh& mesh : out.meshes) {
+        if (!inRange(mesh.firstPrimitive, mesh.primitiveCount, out.primitives.count)) {
+            return fail("mesh primitives out of range");
+        }
+    }
+    for (size_t i = 0; i < out.nodes.count; i++) {
+        const Node& node = out.nodes[i];
+        if (node.parent < -1 || node.parent >= static_cast<int64_t>(i) || node.mesh < -1 ||
+            node.mesh >= static_cast<int64_t>(out.meshes.count)) {
+            return fail("node references out of range");
+        }
+    }
+    for (int32_t node : out.nodeRemap) {
+        if (node < -1 || node >= static_cast<int64_t>(out.nodes.count)) return fail("node remap out of range");
+    }
+    for (const Texture& texture : out.textures) {
+        if (!inRange(texture.pixelOffset, static_cast<uint64_t>(texture.width) * texture.height * 4,
+                     out.pixels.size)) {
+            return fail("texture pixels out of range");
+        }
+    }
+    for (const Material& material : out.materials) {
+        if (material.baseColorTexture < -1 || material.baseColorTexture >= static_cast<int64_t>(out.textures.count)) {
+            return fail("material texture out of range");
+        }
+    }
+    for (const Clip& clip : out.clips) {
+        if (!inRange(clip.nameOffset, clip.nameLength, out.strings.size) ||
+            !inRange(clip.firstChannel, clip.channelCount, out.channels.count)) {
+            return fail("clip references out of range");
+        }
+    }
+    for (const Channel& channel : out.channels) {
+        if (channel.targetNode >= out.nodes.count ||
+            channel.path > static_cast<uint8_t>(Animation::Path::Weights) ||
+            channel.interpolation > static_cast<uint8_t>(Animation::Interpolation::CubicSpline) ||
+            !inRange(channel.times.offset, channel.times.count, out.floats.count) ||
+            !inRange(channel.values.offset, channel.values.count, out.floats.count) ||
+            !inRange(channel.quantizedTimes.offset, channel.quantizedTimes.count, out.shorts.count) ||
+            !inRange(channel.packedRotations.offset, channel.packedRotations.count, out.shorts.count)) {
+            return fail("channel references out of range");
+        }
+    }
+    return true;
+}
+
+std::vector<Animation::Clip> readClips(const View& view) {
+    std::vector<Animation::Clip> clips(view.clips.count);
+    for (size_t i = 0; i < clips.size(); i++) {
+        const Clip& source = view.clips[i];
+        Animation::Clip& clip = clips[i];
+        clip.name.assign(reinterpret_cast<const char*>(view.strings.data) + source.nameOffset, source.nameLength);
+        clip.duration = source.duration;
+        clip.channels.resize(source.channelCount);
+        for (uint32_t c = 0; c < source.channelCount; c++) {
+            const Channel& channel = view.channels[source.firstChannel + c];
+            Animation::Channel& out = clip.channels[c];
+            out.targetNode = channel.targetNode;
+            out.path = static_cast<Animation::Path>(channel.path);
+            out.interpolation = static_cast<Animation::Interpolation>(channel.interpolation);
+            out.components = channel.components;
+            out.timeOffset = channel.timeOffset;
+            out.timeScale = channel.timeScale;
+            out.times = readPool(view.floats, channel.times);
+            out.values = readPool(view.floats, channel.values);
+            out.quantizedTimes = readPool(view.shorts, channel.quantizedTimes);
+            out.packedRotations = readPool(view.shorts, channel.packedRotations);
+        }
+    }
+    return clips;
+}
+} // namespace BakedModel
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "animation.h"
+#include "asset_utils.h"
+#include "meshlet_builder.h"
+#include "vulkan_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+// 오프라인 베이커(tools/model_baker)가 glTF에서 만드는 업로드 직전 형태의 모델 파일 (.vkmodel)
+// - 헤더(섹션 테이블 포함) 뒤에 섹션 데이터가 16바이트 정렬로 이어지므로, 매핑한 파일에서 레코드 배열을 복사 없이 읽음
+// - 정점/인덱스는 VulkanGeometryBuffer가 GPU에 올리는 바이트 그대로, 텍스처는 디코딩된 RGBA8 픽셀
+// - 레코드는 렌더러 구조체(Vertex, Meshlet 등)의 메모리 레이아웃을 그대로 쓰므로 레이아웃이 바뀌면 kVersion을 올리고
+//   다시 베이크해야 함 (버전/정점 크기가 다르면 로드하지 않음). 리틀 엔디언 전용
+namespace BakedModel {
+    constexpr char kMagic[4] = { 'V', 'K', 'M', 'B' };
+    constexpr uint32_t kVersion = 1;
+    constexpr size_t kSectionAlignment = 16;
+    constexpr const char* kFileExtension = ".vkmodel";
+
+    enum class SectionId : uint32_t {
+        Vertices,    // 정점 바이트 (Vertex 또는 CompactVertex)
+        Indices,     // 인덱스 바이트 (uint16 또는 uint32, 프리미티브 로컬 값)
+        Primitives,  // Primitive
+        Clusters,    // MeshletBuilder::Meshlet (firstIndex는 프리미티브 기준 상대 위치)
+        LodLevels,   // LodLevel
+        Meshes,      // Mesh (glTF 메시별 프리미티브 구간)
+        Nodes,       // Node (씬 그래프 평탄화 순서)
+        NodeRemap,   // int32 (glTF 노드 -> 씬 그래프 노드, -1 = 미사용)
+        Textures,    // Texture (glTF 이미지 순서)
+        Pixels,      // 텍스처 RGBA8 픽셀
+        Materials,   // Material
+        Clips,       // Clip
+        Channels,    // Channel
+        Floats,      // 채널 times/values 풀
+        Shorts,      // 채널 quantizedTimes/packedRotations 풀
+        Strings,     // 클립 이름 (UTF-8, 종료 문자 없음)
+        Count
+    };
+    constexpr size_t kSectionCount = static_cast<size_t>(SectionId::Count);
+
+    struct Section {
+        uint64_t offset = 0; // 파일 시작 기준 (kSectionAlignment 배수)
+        uint64_t size = 0;   // 바이트
+    };
+
+    struct Header {
+        char magic[4];
+        uint32_t version = kVersion;
+        uint32_t vertexFormat = 0; // VertexFormat
+        uint32_t vertexStride = 0; // sizeof(Vertex) 또는 sizeof(CompactVertex)
+        uint32_t vertexCount = 0;
+        uint32_t indexSize = 4;    // 2 = uint16, 4 = uint32
+        uint32_t indexCount = 0;
+        uint32_t sectionCount = static_cast<uint32_t>(kSectionCount);
+        Section sections[kSectionCount];
+    };
+
+    // VulkanGeometryBuffer::Range와 같은 값
+    struct Range {
+        uint32_t firstIndex = 0;
+        int32_t vertexOffset = 0;
+        uint32_t indexCount = 0;
+        uint32_t reserved = 0;
+        VertexDequantization dequant{};
+    };
+
+    struct Primitive {
+        Range lod0;
+        uint32_t firstCluster = 0;
+        uint32_t clusterCount = 0;
+        uint32_t firstLod = 0; // LodLevels 구간 (LOD1부터)
+        uint32_t lodCount = 0;
+        int32_t material = -1; // Materials 인덱스
+        MeshletBuilder::Meshlet bounds{}; // 프리미티브 전체 바운딩 구
+    };
+
+    struct LodLevel {
+        Range range;
+        float error = 0.0f;
+    };
+
+    struct Mesh {
+        uint32_t firstPrimitive = 0;
+        uint32_t primitiveCount = 0;
+    };
+
+    // 부모가 항상 자식보다 앞에 있는 깊이 우선 전위 순서 (SceneGraph와 같은 순서)
+    struct Node {
+        glm::mat4 localMatrix{1.0f};
+        int32_t parent = -1;
+        int32_t mesh = -1;
+        // 애니메이션 레스트 포즈 (rotation은 x, y, z, w)
+        float translation[3] = { 0.0f, 0.0f, 0.0f };
+        float rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+        float scale[3] = { 1.0f, 1.0f, 1.0f };
+    };
+
+    // width 0이면 디코딩에 실패한 이미지 (로더가 건너뜀)
+    struct Texture {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t pixelOffset = 0; // Pixels 섹션 기준, width * height * 4 바이트
+    };
+
+    struct Material {
+        int32_t baseColorTexture = -1; // Textures 인덱스
+        float baseColorFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    };
+
+    struct Clip {
+        uint32_t nameOffset = 0; // Strings 섹션 기준
+        uint32_t nameLength = 0;
+        float duration = 0.0f;
+        uint32_t firstChannel = 0;
+        uint32_t channelCount = 0;
+    };
+
+    // 풀 구간 (Floats 또는 Shorts 섹션의 원소 단위)
+    struct PoolRange {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+    };
+
+    struct Channel {
+        uint32_t targetNode = 0;
+        uint8_t path = 0;          // Animation::Path
+        uint8_t interpolation = 0; // Animation::Interpolation
+        uint8_t reserved[2] = {};
+        uint32_t components = 0;
+        float timeOffset = 0.0f;
+        float timeScale = 0.0f;
+        PoolRange times;           // Floats
+        PoolRange values;          // Floats
+        PoolRange quantizedTimes;  // Shorts
+        PoolRange packedRotations; // Shorts
+    };
+
+    // 매핑된 파일 안의 레코드 배열 (파일이 매핑된 동안만 유효)
+    template <typename T>
+    struct Array {
+        const T* data = nullptr;
+        size_t count = 0;
+
+        const T& operator[](size_t i) const { return data[i]; }
+        const T* begin() const { return data; }
+        const T* end() const { return data + count; }
+        bool empty() const { return count == 0; }
+    };
+
+    struct View {
+        Header header{};
+        AssetUtils::ByteSpan vertices;
+        AssetUtils::ByteSpan indices;
+        Array<Primitive> primitives;
+        Array<MeshletBuilder::Meshlet> clusters;
+        Array<LodLevel> lodLevels;
+        Array<Mesh> meshes;
+        Array<Node> nodes;
+        Array<int32_t> nodeRemap;
+        Array<Texture> textures;
+        AssetUtils::ByteSpan pixels;
+        Array<Material> materials;
+        Array<Clip> clips;
+        Array<Channel> channels;
+        Array<float> floats;
+        Array<uint16_t> shorts;
+        AssetUtils::ByteSpan strings;
+    };
+
+    // 베이커가 채우는 원본 (write가 섹션으로 직렬화)
+    struct Image {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<uint8_t> pixels; // RGBA8, 비어 있으면 실패한 이미지
+    };
+    struct Contents {
+        VertexFormat vertexFormat = VertexFormat::Standard;
+        uint32_t vertexCount = 0;
+        uint32_t indexSize = 4;
+        std::vector<uint8_t> vertices;
+        std::vector<uint8_t> indices;
+        std::vector<Primitive> primitives;
+        std::vector<MeshletBuilder::Meshlet> clusters;
+        std::vector<LodLevel> lodLevels;
+        std::vector<Mesh> meshes;
+        std::vector<Node> nodes;
+        std::vector<int32_t> nodeRemap;
+        std::vector<Image> images;
+        std::vector<Material> materials;
+        std::vector<Animation::Clip> clips;
+    };
+
+    bool write(const Contents& contents, const std::string& path);
+
+    // 헤더/섹션 범위와 레코드 사이의 참조(클러스터/LOD/프리미티브 구간, 노드 부모, 픽셀/풀 범위)까지 검사
+    // 검사를 통과한 View는 로더가 추가 검사 없이 사용. bytes는 4바이트 정렬이어야 함
+    bool parse(AssetUtils::ByteSpan bytes, View& out);
+
+    // 채널 레코드와 풀 -> Animation::Clip (AnimationPlayer::setup 입력)
+    std::vector<Animation::Clip> readClips(const View& view);
+}
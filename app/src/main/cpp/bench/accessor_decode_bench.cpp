@@ -0,0 +1,110 @@
+// glTF 접근자 디코딩 처리량 벤치마크 (호스트 전용)
+// 대형 메시에서 흔한 접근자 레이아웃마다 AccessorDecoder::decode(SIMD 경로)와 decodeReference(성분별 분기)의
+// 처리량(입력 GB/s)을 비교하고 두 결과가 같은지 검사합니다. 불일치하면 종료 코드 1을 반환합니다.
+//
+// 사용법: accessor_decode_bench [--vertices N] [--iterations N]
+
+#include "accessor_decoder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr float kMaxError = 1e-6f;
+
+struct Case {
+    const char* name;
+    AccessorDecoder::Layout layout;
+};
+
+// 같은 레이아웃을 iterations번 디코딩한 평균 시간 (ms)
+template <typename Fn>
+double measureMs(uint32_t iterations, Fn&& fn) {
+    fn(); // 워밍업 (출력 페이지 폴트 제외)
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t vertexCount = 2u << 20;
+    uint32_t iterations = 10;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--vertices") == 0 && hasValue) {
+            vertexCount = std::max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--iterations") == 0 && hasValue) {
+            iterations = std::max<uint32_t>(1, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else {
+            fprintf(stderr, "Usage: %s [--vertices N] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    using namespace AccessorDecoder;
+    // 인터리브 레이아웃은 Vertex(pos, color, uv = 32바이트)와 같은 간격,
+    // 양자화 레이아웃은 KHR_mesh_quantization의 4바이트 정렬 규칙을 따름
+    const Case cases[] = {
+        { "POSITION  float vec3 packed", { Float, 3, false, 0 } },
+        { "POSITION  float vec3 stride 32", { Float, 3, false, 32 } },
+        { "POSITION  short vec3 stride 8", { Short, 3, false, 8 } },
+        { "NORMAL    snorm8 vec3 stride 4", { Byte, 3, true, 4 } },
+        { "TEXCOORD  unorm16 vec2 packed", { UnsignedShort, 2, true, 0 } },
+        { "TEXCOORD  float vec2 stride 32", { Float, 2, false, 32 } },
+        { "COLOR     unorm8 vec4 packed", { UnsignedByte, 4, true, 0 } },
+        { "COLOR     unorm16 vec4 packed", { UnsignedShort, 4, true, 0 } },
+        { "WEIGHTS   unorm8 vec4 stride 8", { UnsignedByte, 4, true, 8 } },
+    };
+
+    printf("backend=%s vertices=%zu iterations=%u\n", getBackendName(), vertexCount, iterations);
+    std::mt19937 rng(7);
+    bool failed = false;
+    for (const Case& c : cases) {
+        size_t elementSize = getComponentSize(c.layout.componentType) * c.layout.components;
+        size_t stride = c.layout.stride ? c.layout.stride : elementSize;
+
+        // 1. 입력: 임의 바이트 (FLOAT는 NaN 비교를 피하기 위해 [-1000, 1000] 값으로 채움)
+        std::vector<uint8_t> source(stride * vertexCount);
+        if (c.layout.componentType == Float) {
+            std::uniform_real_distribution<float> value(-1000.0f, 1000.0f);
+            for (size_t i = 0; i + 4 <= source.size(); i += 4) {
+                float f = value(rng);
+                std::memcpy(&source[i], &f, 4);
+            }
+        } else {
+            std::uniform_int_distribution<int> byte(0, 255);
+            for (uint8_t& b : source) b = static_cast<uint8_t>(byte(rng));
+        }
+
+        // 2. 처리량: 입력 버퍼에서 실제로 지나가는 바이트(간격 포함) 기준
+        std::vector<float> reference(vertexCount * c.layout.components);
+        std::vector<float> decoded(vertexCount * c.layout.components);
+        double referenceMs = measureMs(iterations, [&]() {
+            decodeReference(source.data(), vertexCount, c.layout, reference.data());
+        });
+        double decodeMs = measureMs(iterations, [&]() {
+            decode(source.data(), vertexCount, c.layout, decoded.data());
+        });
+
+        float maxError = 0.0f;
+        for (size_t i = 0; i < decoded.size(); i++) {
+            maxError = std::max(maxError, std::fabs(decoded[i] - reference[i]));
+        }
+        bool ok = maxError <= kMaxError;
+        failed |= !ok;
+
+        double bytes = static_cast<double>(stride) * vertexCount;
+        printf("%-32s reference %6.2f GB/s  decode %6.2f GB/s  (x%.1f)  max error %.1e  %s\n", c.name,
+               bytes / (referenceMs * 1e6), bytes / (decodeMs * 1e6), referenceMs / decodeMs, maxError,
+               ok ? "OK" : "FAIL");
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,184 @@
+// 애니메이션 샘플링 CPU 벤치마크 (호스트 전용)
+// 합성 클립(노드마다 translation/rotation/scale 채널)을 프레임 단위로 재생하며
+// 키 탐색 방식별(선형 탐색 / 이진 탐색 / 커서 캐시) 채널당 샘플링 시간을 비교하고,
+// AnimationPlayer + SceneGraph 전체 갱신(두 클립 동시 블렌딩) 비용을 측정합니다.
+//
+// 사용법: animation_bench [--channels N] [--keys N] [--frames N]
+
+#include "animation.h"
+#include "animation_player.h"
+#include "scene_graph.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr float kFrameTime = 1.0f / 60.0f;
+
+enum class SearchMode {
+    LinearScan,   // 매번 0부터 선형 탐색 (기존 getAnimationTransform 방식)
+    BinarySearch, // 매번 이진 탐색
+    CachedCursor  // 채널별 커서 유지
+};
+
+const char* modeName(SearchMode mode) {
+    switch (mode) {
+        case SearchMode::LinearScan: return "linear scan";
+        case SearchMode::BinarySearch: return "binary search";
+        case SearchMode::CachedCursor: return "cached cursor";
+    }
+    return "";
+}
+
+// 노드마다 T/R/S 세 채널, 불규칙한 키 간격. 보간은 채널 종류별로 섞음
+Animation::Clip makeClip(uint32_t nodeCount, uint32_t keyCount, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> step(0.02f, 0.06f);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+    Animation::Clip clip;
+    clip.name = "synthetic" + std::to_string(seed);
+    for (uint32_t node = 0; node < nodeCount; node++) {
+        for (int path = 0; path < 3; path++) {
+            Animation::Channel channel;
+            channel.targetNode = node;
+            channel.path = static_cast<Animation::Path>(path);
+            channel.components = channel.path == Animation::Path::Rotation ? 4 : 3;
+            channel.interpolation = path == 0 ? Animation::Interpolation::CubicSpline
+                                              : (path == 1 ? Animation::Interpolation::Linear
+                                                           : Animation::Interpolation::Step);
+
+            float time = 0.0f;
+            uint32_t valuesPerKey = channel.components *
+                                    (channel.interpolation == Animation::Interpolation::CubicSpline ? 3 : 1);
+            for (uint32_t k = 0; k < keyCount; k++) {
+                channel.times.push_back(time);
+                time += step(rng);
+                for (uint32_t v = 0; v < valuesPerKey; v++) channel.values.push_back(value(rng));
+            }
+            clip.duration = std::max(clip.duration, channel.times.back());
+            clip.channels.push_back(std::move(channel));
+        }
+    }
+    return clip;
+}
+
+uint32_t linearScan(const std::vector<float>& times, float time) {
+    uint32_t key = 0;
+    while (key + 2 < times.size() && time >= times[key + 1]) key++;
+    return key;
+}
+
+// 모든 프레임/채널을 샘플링하고 결과 합을 반환 (방식 간 결과 일치 확인용)
+double runSampling(const Animation::Clip& clip, uint32_t frames, SearchMode mode, double& nsPerChannel) {
+    std::vector<uint32_t> cursors(clip.channels.size(), 0);
+    float value[4];
+    double checksum = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        float time = std::fmod(frame * kFrameTime, clip.duration);
+        for (size_t c = 0; c < clip.channels.size(); c++) {
+            const Animation::Channel& channel = clip.channels[c];
+            uint32_t& cursor = cursors[c];
+            if (mode == SearchMode::LinearScan) {
+                cursor = linearScan(channel.times, time);
+            } else if (mode == SearchMode::BinarySearch) {
+                cursor = UINT32_MAX; // 빠른 경로를 건너뛰고 항상 이진 탐색
+            }
+            Animation::sampleChannel(channel, time, cursor, value);
+            checksum += value[0];
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double samples = static_cast<double>(frames) * clip.channels.size();
+    nsPerChannel = std::chrono::duration<double, std::nano>(end - start).count() / samples;
+    return checksum;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t channelCount = 6144;
+    uint32_t keyCount = 240;
+    uint32_t frames = 600;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--channels") == 0 && hasValue) {
+            channelCount = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--keys") == 0 && hasValue) {
+            keyCount = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            frames = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else {
+            fprintf(stderr, "Usage: %s [--channels N] [--keys N] [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    uint32_t nodeCount = std::max(1u, channelCount / 3);
+    keyCount = std::max(2u, keyCount);
+
+    Animation::Clip clip = makeClip(nodeCount, keyCount, 1);
+    printf("channels=%zu keys/channel=%u frames=%u duration=%.2fs\n",
+           clip.channels.size(), keyCount, frames, clip.duration);
+
+    // 1. 키 탐색 방식 비교 (결과는 모두 같아야 함)
+    double reference = 0.0;
+    bool mismatch = false;
+    for (SearchMode mode : { SearchMode::LinearScan, SearchMode::BinarySearch, SearchMode::CachedCursor }) {
+        double nsPerChannel = 0.0;
+        double checksum = runSampling(clip, frames, mode, nsPerChannel);
+        if (mode == SearchMode::LinearScan) reference = checksum;
+        bool same = std::fabs(checksum - reference) <= 1e-6 * std::max(1.0, std::fabs(reference));
+        mismatch |= !same;
+        printf("%-14s %7.1f ns/channel  %8.3f ms/frame  %s\n", modeName(mode), nsPerChannel,
+               nsPerChannel * clip.channels.size() / 1e6, same ? "ok" : "MISMATCH");
+    }
+
+    // 2. 두 클립 동시 재생(가중치 0.5씩) + 씬 그래프 월드 행렬 갱신까지 포함한 프레임 비용
+    std::vector<SceneGraph::NodeDesc> nodes(nodeCount);
+    std::vector<int32_t> roots;
+    for (uint32_t i = 0; i < nodeCount; i++) {
+        // 깊이 8의 사슬들 (계층 전파 비용 포함)
+        if (i % 8 == 0) {
+            roots.push_back(static_cast<int32_t>(i));
+        } else {
+            nodes[i - 1].children.push_back(static_cast<int32_t>(i));
+        }
+    }
+    SceneGraph scene;
+    scene.build(nodes, roots);
+
+    // 스칼라 평가와 배치(SIMD) 평가를 같은 입력으로 비교
+    std::vector<Animation::Clip> clips;
+    clips.push_back(clip);
+    clips.push_back(makeClip(nodeCount, keyCount, 2));
+    for (bool batched : { false, true }) {
+        AnimationPlayer player;
+        player.setup(clips, std::vector<AnimationPlayer::NodePose>(nodeCount));
+        player.setBatchedEvaluation(batched);
+        player.play(0, true, 1.0f, 0.5f);
+        player.play(1, true, 1.0f, 0.5f);
+
+        uint64_t sampled = 0;
+        uint64_t updatedNodes = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t frame = 0; frame < frames; frame++) {
+            sampled += player.update(kFrameTime, scene);
+            updatedNodes += scene.update();
+        }
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        printf("player+scene %-7s %7.1f ns/channel  %8.3f ms/frame  (%llu channels, %llu node updates)\n",
+               batched ? "batched" : "scalar", ms * 1e6 / std::max<uint64_t>(1, sampled), ms / frames,
+               static_cast<unsigned long long>(sampled), static_cast<unsigned long long>(updatedNodes));
+    }
+
+    return mismatch ? 1 : 0;
+}
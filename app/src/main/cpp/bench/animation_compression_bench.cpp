@@ -0,0 +1,204 @@
+// 애니메이션 클립 압축 벤치마크 + 허용 오차 검사 (호스트 전용)
+// 모션 캡처와 비슷한 합성 클립(고정 프레임레이트의 매끄러운 곡선 + 값이 일정한 채널)을 압축해
+// 크기/키 수 감소율, 원본 대비 최대 오차(키 사이를 촘촘히 샘플링), 채널당 샘플링 시간을 비교합니다.
+// 최대 오차가 허용 오차 + 반올림 여유를 넘으면 1을 반환합니다.
+//
+// 사용법: animation_compression_bench [--nodes N] [--fps N] [--seconds N] [--frames N]
+
+#include "animation.h"
+#include "animation_compression.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr float kFrameTime = 1.0f / 60.0f;
+// 복원 값의 float 반올림 오차 여유 (허용 오차에 대한 비율)
+constexpr float kQuantizationMargin = 0.05f;
+
+// 노드마다 T/R/S 채널. 뼈대 일부는 translation/scale이 일정 (모션 캡처에서 흔한 형태)
+Animation::Clip makeClip(uint32_t nodeCount, float fps, float seconds, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> freq(0.2f, 2.0f);
+    std::uniform_real_distribution<float> phase(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> amplitude(0.05f, 1.0f);
+    std::uniform_real_distribution<float> noise(-1e-5f, 1e-5f);
+
+    uint32_t keyCount = std::max(2u, static_cast<uint32_t>(fps * seconds) + 1);
+    Animation::Clip clip;
+    clip.name = "mocap" + std::to_string(seed);
+    for (uint32_t node = 0; node < nodeCount; node++) {
+        bool staticOffsets = node % 4 != 0;
+        for (int path = 0; path < 3; path++) {
+            Animation::Channel channel;
+            channel.targetNode = node;
+            channel.path = static_cast<Animation::Path>(path);
+            channel.components = channel.path == Animation::Path::Rotation ? 4 : 3;
+            channel.interpolation = Animation::Interpolation::Linear;
+
+            float f[3] = { freq(rng), freq(rng), freq(rng) };
+            float p[3] = { phase(rng), phase(rng), phase(rng) };
+            float a = amplitude(rng);
+            for (uint32_t k = 0; k < keyCount; k++) {
+                float t = k / fps;
+                channel.times.push_back(t);
+                if (channel.path == Animation::Path::Rotation) {
+                    // 천천히 도는 축 주위의 회전
+                    float axis[3] = { std::sin(f[0] * 0.3f * t + p[0]), std::cos(f[1] * 0.3f * t + p[1]), 0.5f };
+                    float len = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+                    float angle = a * 3.0f * std::sin(f[2] * t + p[2]);
+                    float s = std::sin(angle * 0.5f) / len;
+                    channel.values.insert(channel.values.end(),
+                                          { axis[0] * s, axis[1] * s, axis[2] * s, std::cos(angle * 0.5f) });
+                } else if (staticOffsets) {
+                    // 값은 일정하지만 센서 잡음 수준의 미세한 떨림
+                    float base = channel.path == Animation::Path::Scale ? 1.0f : a;
+                    for (int c = 0; c < 3; c++) channel.values.push_back(base + noise(rng));
+                } else {
+                    float base = channel.path == Animation::Path::Scale ? 1.0f : 0.0f;
+                    float scale = channel.path == Animation::Path::Scale ? 0.1f : a;
+                    for (int c = 0; c < 3; c++) channel.values.push_back(base + scale * std::sin(f[c] * t + p[c]));
+                }
+            }
+            clip.duration = std::max(clip.duration, channel.times.back());
+            clip.channels.push_back(std::move(channel));
+        }
+    }
+    return clip;
+}
+
+float rotationAngle(const float* a, const float* b) {
+    float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    float sign = dot < 0.0f ? -1.0f : 1.0f;
+    float diff = 0.0f;
+    float sum = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        diff += (a[i] - sign * b[i]) * (a[i] - sign * b[i]);
+        sum += (a[i] + sign * b[i]) * (a[i] + sign * b[i]);
+    }
+    return 4.0f * std::atan2(std::sqrt(diff), std::sqrt(sum));
+}
+
+// 원본 키 사이를 samplesPerKey 단계로 샘플링해 경로별 최대 오차 측정
+void measureError(const Animation::Clip& original, const Animation::Clip& compressed, uint32_t samplesPerKey,
+                  float maxError[3]) {
+    for (size_t c = 0; c < original.channels.size(); c++) {
+        const Animation::Channel& a = original.channels[c];
+        const Animation::Channel& b = compressed.channels[c];
+        uint32_t cursorA = 0;
+        uint32_t cursorB = 0;
+        float va[4];
+        float vb[4];
+        uint32_t steps = static_cast<uint32_t>(a.times.size() - 1) * samplesPerKey;
+        for (uint32_t s = 0; s <= steps; s++) {
+            float time = a.times.front() + (a.times.back() - a.times.front()) * s / steps;
+            Animation::sampleChannel(a, time, cursorA, va);
+            Animation::sampleChannel(b, time, cursorB, vb);
+            float error = 0.0f;
+            if (a.path == Animation::Path::Rotation) {
+                error = rotationAngle(va, vb);
+            } else if (a.path == Animation::Path::Translation) {
+                error = std::sqrt((va[0] - vb[0]) * (va[0] - vb[0]) + (va[1] - vb[1]) * (va[1] - vb[1]) +
+                                  (va[2] - vb[2]) * (va[2] - vb[2]));
+            } else {
+                for (int i = 0; i < 3; i++) error = std::max(error, std::fabs(va[i] - vb[i]));
+            }
+            int path = static_cast<int>(a.path);
+            maxError[path] = std::max(maxError[path], error);
+        }
+    }
+}
+
+double runSampling(const Animation::Clip& clip, uint32_t frames, double& nsPerChannel) {
+    std::vector<uint32_t> cursors(clip.channels.size(), 0);
+    float value[4];
+    double checksum = 0.0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        float time = std::fmod(frame * kFrameTime, clip.duration);
+        for (size_t c = 0; c < clip.channels.size(); c++) {
+            Animation::sampleChannel(clip.channels[c], time, cursors[c], value);
+            checksum += value[0];
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double samples = static_cast<double>(frames) * clip.channels.size();
+    nsPerChannel = std::chrono::duration<double, std::nano>(end - start).count() / samples;
+    return checksum;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t nodeCount = 512;
+    float fps = 120.0f;
+    float seconds = 10.0f;
+    uint32_t frames = 600;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--nodes") == 0 && hasValue) {
+            nodeCount = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--fps") == 0 && hasValue) {
+            fps = strtof(argv[++i], nullptr);
+        } else if (strcmp(argv[i], "--seconds") == 0 && hasValue) {
+            seconds = strtof(argv[++i], nullptr);
+        } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            frames = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else {
+            fprintf(stderr, "Usage: %s [--nodes N] [--fps N] [--seconds N] [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    nodeCount = std::max(1u, nodeCount);
+    fps = std::max(1.0f, fps);
+    seconds = std::max(0.1f, seconds);
+
+    Animation::Clip original = makeClip(nodeCount, fps, seconds, 1);
+    Animation::Clip compressed = original;
+
+    AnimationCompression::Settings settings;
+    AnimationCompression::Stats stats;
+    auto start = std::chrono::steady_clock::now();
+    AnimationCompression::compressClip(compressed, settings, stats);
+    auto end = std::chrono::steady_clock::now();
+
+    printf("channels=%zu keys/channel=%zu fps=%.0f duration=%.2fs\n",
+           original.channels.size(), original.channels[0].times.size(), fps, original.duration);
+    printf("compress       %8.2f ms  (%u channels)\n",
+           std::chrono::duration<double, std::milli>(end - start).count(), stats.channelsCompressed);
+    printf("keys           %8zu -> %8zu  (%.1f%%)\n", stats.keysBefore, stats.keysAfter,
+           100.0 * stats.keysAfter / std::max<size_t>(1, stats.keysBefore));
+    printf("bytes          %8zu -> %8zu  (%.1f%%)\n", stats.bytesBefore, stats.bytesAfter,
+           100.0 * stats.bytesAfter / std::max<size_t>(1, stats.bytesBefore));
+
+    // 1. 오차 검사 (키 사이 8단계 샘플링)
+    float maxError[3] = {};
+    measureError(original, compressed, 8, maxError);
+    float limits[3] = { settings.translationError, settings.rotationError, settings.scaleError };
+    const char* names[3] = { "translation", "rotation", "scale" };
+    bool failed = false;
+    for (int path = 0; path < 3; path++) {
+        bool ok = maxError[path] <= limits[path] * (1.0f + kQuantizationMargin);
+        failed |= !ok;
+        printf("max error %-12s %.3g (limit %.3g)  %s\n", names[path], maxError[path], limits[path],
+               ok ? "ok" : "FAIL");
+    }
+
+    // 2. 샘플링 비용 비교 (압축 채널은 rotation 키 두 개를 복원)
+    double nsRaw = 0.0;
+    double nsCompressed = 0.0;
+    runSampling(original, frames, nsRaw);
+    runSampling(compressed, frames, nsCompressed);
+    printf("sampling raw        %7.1f ns/channel\n", nsRaw);
+    printf("sampling compressed %7.1f ns/channel\n", nsCompressed);
+
+    return failed ? 1 : 0;
+}
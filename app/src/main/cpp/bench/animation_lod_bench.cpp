@@ -0,0 +1,180 @@
+// 애니메이션 LOD 벤치마크 (호스트 전용)
+// 격자에 놓인 애니메이션 객체 무리를 카메라가 한쪽 방향으로 바라보는 상황에서
+// 전체 갱신과 애니메이션 LOD(화면 밖 정지, 거리별 주기) 갱신의 프레임 비용과 프레임별 샘플링 채널 수 분포를 비교합니다.
+// 위상 분산이 동작하면 LOD 모드의 프레임별 채널 수 최댓값이 평균에 가깝게 유지됩니다.
+//
+// 사용법: animation_lod_bench [--objects N] [--joints N] [--frames N]
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+
+#include "animation.h"
+#include "animation_lod.h"
+#include "animation_player.h"
+#include "culling.h"
+#include "scene_graph.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+constexpr float kFrameTime = 1.0f / 60.0f;
+constexpr float kSpacing = 4.0f;
+
+// 객체마다 루트(배치 위치) + 깊이 joints의 관절 사슬, 관절마다 rotation 채널 하나
+struct Crowd {
+    std::vector<SceneGraph::NodeDesc> nodes;
+    std::vector<int32_t> roots;
+    std::vector<int32_t> nodeObjects;
+    std::vector<glm::vec3> positions;
+    Animation::Clip clip;
+};
+
+Crowd makeCrowd(uint32_t objectCount, uint32_t jointCount) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> phase(0.0f, 6.2831853f);
+    uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(objectCount))));
+
+    Crowd crowd;
+    for (uint32_t object = 0; object < objectCount; object++) {
+        float column = static_cast<float>(object % side);
+        float row = static_cast<float>(object / side);
+        glm::vec3 position((column - side * 0.5f) * kSpacing, 0.0f, -row * kSpacing);
+        crowd.positions.push_back(position);
+
+        int32_t root = static_cast<int32_t>(crowd.nodes.size());
+        crowd.roots.push_back(root);
+        SceneGraph::NodeDesc rootDesc;
+        rootDesc.localMatrix = glm::translate(glm::mat4(1.0f), position);
+        crowd.nodes.push_back(rootDesc);
+        crowd.nodeObjects.push_back(static_cast<int32_t>(object));
+
+        float offset = phase(rng);
+        for (uint32_t j = 0; j < jointCount; j++) {
+            int32_t node = static_cast<int32_t>(crowd.nodes.size());
+            crowd.nodes[node - 1].children.push_back(node);
+            crowd.nodes.emplace_back();
+            crowd.nodeObjects.push_back(static_cast<int32_t>(object));
+
+            Animation::Channel channel;
+            channel.targetNode = static_cast<uint32_t>(node); // 평탄화 순서 = 생성 순서 (루트마다 사슬 하나)
+            channel.path = Animation::Path::Rotation;
+            channel.components = 4;
+            channel.interpolation = Animation::Interpolation::Linear;
+            for (uint32_t k = 0; k <= 60; k++) {
+                float t = k / 30.0f;
+                float angle = 0.5f * std::sin(t * 3.1415926f + offset + j);
+                channel.times.push_back(t);
+                channel.values.insert(channel.values.end(),
+                                      { std::sin(angle * 0.5f), 0.0f, 0.0f, std::cos(angle * 0.5f) });
+            }
+            crowd.clip.duration = std::max(crowd.clip.duration, channel.times.back());
+            crowd.clip.channels.push_back(std::move(channel));
+        }
+    }
+    return crowd;
+}
+
+struct Result {
+    double msPerFrame = 0.0;
+    double avgChannels = 0.0;
+    uint32_t minChannels = UINT32_MAX;
+    uint32_t maxChannels = 0;
+};
+
+Result run(const Crowd& crowd, uint32_t frames, bool useLod) {
+    SceneGraph scene;
+    scene.build(crowd.nodes, crowd.roots);
+
+    AnimationPlayer player;
+    player.setup({ crowd.clip }, std::vector<AnimationPlayer::NodePose>(scene.getNodeCount()));
+    player.play(0);
+
+    AnimationLod lod;
+    lod.setup(crowd.nodeObjects, static_cast<uint32_t>(crowd.positions.size()));
+    AnimationLod::Settings settings;
+    settings.enabled = useLod;
+    lod.setSettings(settings);
+
+    // 카메라는 무리 앞쪽 가운데에서 -z 방향을 바라보고, 60도 시야 밖 객체는 화면 밖
+    glm::vec3 cameraPosition(0.0f, 1.5f, 6.0f);
+    glm::mat4 view = glm::lookAt(cameraPosition, cameraPosition + glm::vec3(0.3f, 0.0f, -1.0f),
+                                 glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    Culling::Frustum frustum = Culling::extractFrustum(projection * view);
+    float projectionScale = 1080.0f / (2.0f * std::tan(glm::radians(60.0f) * 0.5f));
+    const float radius = 1.0f; // 사람 크기 캐릭터
+
+    Result result;
+    uint64_t total = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        for (uint32_t object = 0; object < crowd.positions.size(); object++) {
+            lod.setBounds(object, crowd.positions[object], radius);
+        }
+        lod.schedule(frustum, cameraPosition, projectionScale);
+        uint32_t sampled = player.update(kFrameTime, scene, lod.getNodeMask());
+        scene.update();
+
+        // 첫 프레임은 모든 객체가 초기 포즈를 만들기 위해 갱신하므로 분포에서 제외
+        if (frame > 0) {
+            result.minChannels = std::min(result.minChannels, sampled);
+            result.maxChannels = std::max(result.maxChannels, sampled);
+            total += sampled;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    result.msPerFrame = std::chrono::duration<double, std::milli>(end - start).count() / frames;
+    result.avgChannels = static_cast<double>(total) / std::max(1u, frames - 1);
+
+    if (useLod) {
+        const AnimationLod::Stats& stats = lod.getStats();
+        printf("objects: %u full rate, %u reduced rate, %u frozen\n", stats.fullRate, stats.reducedRate,
+               stats.frozen);
+    }
+    return result;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t objectCount = 1024;
+    uint32_t jointCount = 24;
+    uint32_t frames = 600;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--objects") == 0 && hasValue) {
+            objectCount = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--joints") == 0 && hasValue) {
+            jointCount = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            frames = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else {
+            fprintf(stderr, "Usage: %s [--objects N] [--joints N] [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    objectCount = std::max(1u, objectCount);
+    jointCount = std::max(1u, jointCount);
+    frames = std::max(2u, frames);
+
+    Crowd crowd = makeCrowd(objectCount, jointCount);
+    printf("objects=%u joints/object=%u channels=%zu frames=%u\n", objectCount, jointCount,
+           crowd.clip.channels.size(), frames);
+
+    for (bool useLod : { false, true }) {
+        Result result = run(crowd, frames, useLod);
+        printf("%-9s %8.3f ms/frame  channels/frame avg %8.1f  min %6u  max %6u\n",
+               useLod ? "lod" : "full rate", result.msPerFrame, result.avgChannels, result.minChannels,
+               result.maxChannels);
+    }
+    return 0;
+}
@@ -0,0 +1,185 @@
+// 애니메이션 배치(SIMD) 평가 마이크로벤치마크 + 허용 오차 검사 (호스트 전용)
+// 같은 입력에 대해 스칼라 경로(채널마다 slerp, 노드마다 mat4_cast)와 AnimationSimd 배치 경로를 비교합니다.
+// 오차가 허용 범위를 넘으면 종료 코드 1을 반환하므로 CI에서 정확도 회귀 검사로도 사용할 수 있습니다.
+//
+// 사용법: animation_simd_bench [--count N] [--iterations N]
+
+#include "animation_simd.h"
+#include "scene_graph.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+// slerp 근사의 각도 오차 한계 (라디안), 행렬 성분 오차 한계 (스케일 1 기준 상대값)
+constexpr double kMaxSlerpAngleError = 1e-3;
+constexpr double kMaxMatrixError = 1e-5;
+
+struct Quat {
+    float x, y, z, w;
+};
+
+Quat randomQuat(std::mt19937& rng) {
+    std::normal_distribution<float> n(0.0f, 1.0f);
+    Quat q{ n(rng), n(rng), n(rng), n(rng) };
+    float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    return { q.x / length, q.y / length, q.z / length, q.w / length };
+}
+
+// 기준 스칼라 slerp (삼각 함수 사용, 최단 경로)
+Quat slerpScalar(const Quat& a, Quat b, float t) {
+    float d = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    if (d < 0.0f) {
+        d = -d;
+        b = { -b.x, -b.y, -b.z, -b.w };
+    }
+    float wa = 1.0f - t;
+    float wb = t;
+    if (d < 0.9995f) {
+        float theta = std::acos(d);
+        float invSin = 1.0f / std::sin(theta);
+        wa = std::sin((1.0f - t) * theta) * invSin;
+        wb = std::sin(t * theta) * invSin;
+    }
+    Quat r{ a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb };
+    float length = std::sqrt(r.x * r.x + r.y * r.y + r.z * r.z + r.w * r.w);
+    return { r.x / length, r.y / length, r.z / length, r.w / length };
+}
+
+// 두 단위 쿼터니언이 나타내는 회전 사이의 각도
+// acos(dot)은 1 근처에서 float 정밀도를 잃으므로 |a - b|와 |a + b|의 atan2로 계산
+double angleBetween(const Quat& a, const Quat& b) {
+    double sign = (static_cast<double>(a.x) * b.x + static_cast<double>(a.y) * b.y +
+                   static_cast<double>(a.z) * b.z + static_cast<double>(a.w) * b.w) < 0.0 ? -1.0 : 1.0;
+    double diff[4] = { a.x - sign * b.x, a.y - sign * b.y, a.z - sign * b.z, a.w - sign * b.w };
+    double sum[4] = { a.x + sign * b.x, a.y + sign * b.y, a.z + sign * b.z, a.w + sign * b.w };
+    double diffLength = std::sqrt(diff[0] * diff[0] + diff[1] * diff[1] + diff[2] * diff[2] + diff[3] * diff[3]);
+    double sumLength = std::sqrt(sum[0] * sum[0] + sum[1] * sum[1] + sum[2] * sum[2] + sum[3] * sum[3]);
+    return 4.0 * std::atan2(diffLength, sumLength);
+}
+
+template <typename Fn>
+double measureNs(uint32_t iterations, size_t count, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(iterations) * count);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = 8192;
+    uint32_t iterations = 200;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--count") == 0 && hasValue) {
+            count = std::max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--iterations") == 0 && hasValue) {
+            iterations = std::max<uint32_t>(1, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else {
+            fprintf(stderr, "Usage: %s [--count N] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // 1. 입력: 키 쌍은 실제 애니메이션처럼 가까운 회전(최대 ~90도)과 임의 회전을 섞음
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<Quat> a(count), b(count);
+    std::vector<float> t(count);
+    AnimationSimd::QuatSoA soaA, soaB, soaOut;
+    soaA.resize(count);
+    soaB.resize(count);
+    soaOut.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        a[i] = randomQuat(rng);
+        if (i % 2 == 0) {
+            Quat delta = randomQuat(rng);
+            float blend = 0.15f;
+            Quat near{ a[i].x + delta.x * blend, a[i].y + delta.y * blend, a[i].z + delta.z * blend,
+                       a[i].w + delta.w * blend };
+            b[i] = slerpScalar(near, near, 0.0f);
+        } else {
+            b[i] = randomQuat(rng);
+        }
+        t[i] = unit(rng);
+        soaA.x[i] = a[i].x; soaA.y[i] = a[i].y; soaA.z[i] = a[i].z; soaA.w[i] = a[i].w;
+        soaB.x[i] = b[i].x; soaB.y[i] = b[i].y; soaB.z[i] = b[i].z; soaB.w[i] = b[i].w;
+    }
+    std::vector<float> paddedT(soaA.x.size(), 0.0f);
+    std::copy(t.begin(), t.end(), paddedT.begin());
+
+    printf("backend=%s count=%zu iterations=%u\n", AnimationSimd::getBackendName(), count, iterations);
+    bool failed = false;
+
+    // 2. 회전 보간: 스칼라 slerp vs SIMD slerp 근사 / nlerp
+    std::vector<Quat> reference(count);
+    double scalarNs = measureNs(iterations, count, [&]() {
+        for (size_t i = 0; i < count; i++) reference[i] = slerpScalar(a[i], b[i], t[i]);
+    });
+    double slerpNs = measureNs(iterations, count, [&]() {
+        AnimationSimd::slerp(soaA, soaB, paddedT.data(), soaOut, count);
+    });
+    double slerpError = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        slerpError = std::max(slerpError, angleBetween(reference[i], { soaOut.x[i], soaOut.y[i], soaOut.z[i], soaOut.w[i] }));
+    }
+    double nlerpNs = measureNs(iterations, count, [&]() {
+        AnimationSimd::nlerp(soaA, soaB, paddedT.data(), soaOut, count);
+    });
+    double nlerpError = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        nlerpError = std::max(nlerpError, angleBetween(reference[i], { soaOut.x[i], soaOut.y[i], soaOut.z[i], soaOut.w[i] }));
+    }
+    bool slerpOk = slerpError <= kMaxSlerpAngleError;
+    failed |= !slerpOk;
+    printf("slerp  scalar %6.2f ns  simd %6.2f ns  (x%.1f)  max error %.2e rad  %s\n",
+           scalarNs, slerpNs, scalarNs / slerpNs, slerpError, slerpOk ? "ok" : "FAIL");
+    printf("nlerp                 simd %6.2f ns  (x%.1f)  max error %.2e rad  (reference only)\n",
+           nlerpNs, scalarNs / nlerpNs, nlerpError);
+
+    // 3. TRS -> 행렬: SceneGraph::composeTransform(mat4_cast) vs SIMD 배치
+    AnimationSimd::Vec3SoA translation, scale;
+    translation.resize(count);
+    scale.resize(count);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> scaleDist(0.5f, 2.0f);
+    for (size_t i = 0; i < count; i++) {
+        translation.x[i] = position(rng); translation.y[i] = position(rng); translation.z[i] = position(rng);
+        scale.x[i] = scaleDist(rng); scale.y[i] = scaleDist(rng); scale.z[i] = scaleDist(rng);
+    }
+    std::vector<glm::mat4> scalarMatrices(count), simdMatrices(count);
+    double composeScalarNs = measureNs(iterations, count, [&]() {
+        for (size_t i = 0; i < count; i++) {
+            scalarMatrices[i] = SceneGraph::composeTransform(
+                    glm::vec3(translation.x[i], translation.y[i], translation.z[i]),
+                    glm::quat(soaA.w[i], soaA.x[i], soaA.y[i], soaA.z[i]),
+                    glm::vec3(scale.x[i], scale.y[i], scale.z[i]));
+        }
+    });
+    double composeSimdNs = measureNs(iterations, count, [&]() {
+        AnimationSimd::composeTransforms(translation, soaA, scale, simdMatrices.data(), count);
+    });
+    double matrixError = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        for (int c = 0; c < 4; c++) {
+            for (int r = 0; r < 4; r++) {
+                double magnitude = std::max(1.0, std::fabs(static_cast<double>(scalarMatrices[i][c][r])));
+                matrixError = std::max(matrixError,
+                                       std::fabs(scalarMatrices[i][c][r] - simdMatrices[i][c][r]) / magnitude);
+            }
+        }
+    }
+    bool composeOk = matrixError <= kMaxMatrixError;
+    failed |= !composeOk;
+    printf("TRS    scalar %6.2f ns  simd %6.2f ns  (x%.1f)  max error %.2e      %s\n",
+           composeScalarNs, composeSimdNs, composeScalarNs / composeSimdNs, matrixError, composeOk ? "ok" : "FAIL");
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,291 @@
+// glTF 로드 시간 벤치마크: ASCII(.gltf + .bin) 대비 GLB (호스트 전용)
+// 같은 모델을 .gltf(+외부 .bin)와 .glb로 기록한 뒤, 파싱부터 모든 접근자를 float로 디코딩할 때까지의 시간을
+// 세 경로로 측정합니다.
+//   gltf        LoadASCIIFromFile (JSON 파싱 + .bin을 std::vector로 읽기)
+//   glb file    LoadBinaryFromFile (파일 전체를 std::vector로 읽은 뒤 BIN 청크를 다시 복사)
+//   glb mapped  VulkanModel::loadFromFile의 경로 (MappedAsset으로 mmap, BIN 청크의 접근자를 매핑에서 바로 디코딩)
+// 파일은 방금 기록했으므로 페이지 캐시에 있는 상태(웜 캐시)의 비용입니다.
+// 세 경로의 디코딩 결과 체크섬이 다르면 종료 코드 1을 반환합니다.
+//
+// 사용법: gltf_load_bench [--vertices N] [--iterations N] [--out DIR] [file.gltf]
+//         파일을 지정하지 않으면 --vertices 크기의 합성 그리드 메시를 사용
+
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "tiny_gltf.h"
+
+#include "accessor_decoder.h"
+#include "asset_utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+// 버퍼 하나를 가진 그리드 메시: POSITION(float VEC3), TEXCOORD_0(unorm16 VEC2), COLOR_0(unorm8 VEC4), uint32 인덱스
+tinygltf::Model makeGridModel(size_t vertexCount) {
+    uint32_t side = std::max<uint32_t>(2, static_cast<uint32_t>(std::sqrt(static_cast<double>(vertexCount))));
+    size_t count = static_cast<size_t>(side) * side;
+    size_t indexCount = static_cast<size_t>(side - 1) * (side - 1) * 6;
+
+    tinygltf::Model model;
+    model.asset.version = "2.0";
+    tinygltf::Buffer buffer;
+    std::vector<unsigned char>& data = buffer.data;
+    auto appendView = [&](size_t byteLength, int target) {
+        tinygltf::BufferView view;
+        view.buffer = 0;
+        view.byteOffset = data.size();
+        view.byteLength = byteLength;
+        view.target = target;
+        data.resize(data.size() + ((byteLength + 3) & ~size_t(3)));
+        model.bufferViews.push_back(view);
+        return static_cast<int>(model.bufferViews.size() - 1);
+    };
+    auto appendAccessor = [&](int view, int componentType, int type, size_t elements, bool normalized) {
+        tinygltf::Accessor accessor;
+        accessor.bufferView = view;
+        accessor.componentType = componentType;
+        accessor.type = type;
+        accessor.count = elements;
+        accessor.normalized = normalized;
+        model.accessors.push_back(accessor);
+        return static_cast<int>(model.accessors.size() - 1);
+    };
+
+    int positionView = appendView(count * 12, TINYGLTF_TARGET_ARRAY_BUFFER);
+    int uvView = appendView(count * 4, TINYGLTF_TARGET_ARRAY_BUFFER);
+    int colorView = appendView(count * 4, TINYGLTF_TARGET_ARRAY_BUFFER);
+    int indexView = appendView(indexCount * 4, TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER);
+
+    for (uint32_t y = 0; y < side; y++) {
+        for (uint32_t x = 0; x < side; x++) {
+            size_t v = static_cast<size_t>(y) * side + x;
+            float pos[3] = { static_cast<float>(x), static_cast<float>(y), std::sin(x * 0.1f) * std::cos(y * 0.1f) };
+            uint16_t uv[2] = { static_cast<uint16_t>(x * 65535u / (side - 1)),
+                               static_cast<uint16_t>(y * 65535u / (side - 1)) };
+            uint8_t color[4] = { static_cast<uint8_t>(x), static_cast<uint8_t>(y), static_cast<uint8_t>(x ^ y), 255 };
+            std::memcpy(&data[model.bufferViews[positionView].byteOffset + v * 12], pos, 12);
+            std::memcpy(&data[model.bufferViews[uvView].byteOffset + v * 4], uv, 4);
+            std::memcpy(&data[model.bufferViews[colorView].byteOffset + v * 4], color, 4);
+        }
+    }
+    uint32_t* indices = reinterpret_cast<uint32_t*>(&data[model.bufferViews[indexView].byteOffset]);
+    for (uint32_t y = 0; y + 1 < side; y++) {
+        for (uint32_t x = 0; x + 1 < side; x++) {
+            uint32_t i = y * side + x;
+            uint32_t quad[6] = { i, i + 1, i + side, i + 1, i + side + 1, i + side };
+            std::memcpy(indices, quad, sizeof(quad));
+            indices += 6;
+        }
+    }
+    model.buffers.push_back(std::move(buffer));
+
+    tinygltf::Primitive primitive;
+    primitive.attributes["POSITION"] =
+            appendAccessor(positionView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, count, false);
+    model.accessors.back().minValues = { 0.0, 0.0, -1.0 };
+    model.accessors.back().maxValues = { side - 1.0, side - 1.0, 1.0 };
+    primitive.attributes["TEXCOORD_0"] =
+            appendAccessor(uvView, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TYPE_VEC2, count, true);
+    primitive.attributes["COLOR_0"] =
+            appendAccessor(colorView, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_TYPE_VEC4, count, true);
+    primitive.indices =
+            appendAccessor(indexView, TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT, TINYGLTF_TYPE_SCALAR, indexCount, false);
+    primitive.mode = TINYGLTF_MODE_TRIANGLES;
+
+    tinygltf::Mesh mesh;
+    mesh.name = "grid";
+    mesh.primitives.push_back(primitive);
+    model.meshes.push_back(mesh);
+    tinygltf::Node node;
+    node.mesh = 0;
+    model.nodes.push_back(node);
+    tinygltf::Scene scene;
+    scene.nodes.push_back(0);
+    model.scenes.push_back(scene);
+    model.defaultScene = 0;
+    return model;
+}
+
+// bufferView가 있는 모든 접근자를 float로 디코딩 (VulkanModel의 readAccessorFloats와 같은 경계 검사)
+// 결과 합계를 체크섬으로 반환, 디코딩 실패 시 NaN
+double decodeAccessors(const tinygltf::Model& model, const std::vector<AssetUtils::ByteSpan>& buffers,
+                       std::vector<float>& scratch) {
+    double checksum = 0.0;
+    for (const tinygltf::Accessor& accessor : model.accessors) {
+        if (accessor.bufferView < 0) continue;
+        const tinygltf::BufferView& view = model.bufferViews[accessor.bufferView];
+        const AssetUtils::ByteSpan& buffer = buffers[view.buffer];
+        AccessorDecoder::Layout layout;
+        layout.componentType = accessor.componentType;
+        layout.components = tinygltf::GetNumComponentsInType(accessor.type);
+        layout.normalized = accessor.normalized;
+        int stride = accessor.ByteStride(view);
+        size_t begin = view.byteOffset + accessor.byteOffset;
+        size_t elementSize = AccessorDecoder::getComponentSize(accessor.componentType) * layout.components;
+        if (stride <= 0 || (accessor.count > 0 && begin + (accessor.count - 1) * stride + elementSize > buffer.size)) {
+            return NAN;
+        }
+        layout.stride = static_cast<size_t>(stride);
+        scratch.resize(accessor.count * layout.components);
+        if (!AccessorDecoder::decode(buffer.data + begin, accessor.count, layout, scratch.data())) return NAN;
+        for (float value : scratch) checksum += value;
+    }
+    return checksum;
+}
+
+std::vector<AssetUtils::ByteSpan> getBufferSpans(const tinygltf::Model& model) {
+    std::vector<AssetUtils::ByteSpan> buffers;
+    for (const auto& buffer : model.buffers) buffers.push_back({ buffer.data.data(), buffer.data.size() });
+    return buffers;
+}
+
+struct Result {
+    double milliseconds = 0.0;
+    double checksum = 0.0;
+    bool ok = true;
+};
+
+template <typename Fn>
+Result measure(uint32_t iterations, Fn&& load) {
+    Result result;
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        double checksum = 0.0;
+        bool ok = load(checksum);
+        auto end = std::chrono::steady_clock::now();
+        result.milliseconds += std::chrono::duration<double, std::milli>(end - start).count();
+        result.checksum = checksum;
+        result.ok &= ok;
+    }
+    result.milliseconds /= iterations;
+    return result;
+}
+
+size_t getFileSize(const std::string& path) {
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<size_t>(size);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t vertexCount = 1u << 20;
+    uint32_t iterations = 5;
+    std::string outDir = std::filesystem::temp_directory_path().string();
+    std::string input;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--vertices") == 0 && hasValue) {
+            vertexCount = std::max<size_t>(4, strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--iterations") == 0 && hasValue) {
+            iterations = std::max<uint32_t>(1, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else if (strcmp(argv[i], "--out") == 0 && hasValue) {
+            outDir = argv[++i];
+        } else if (argv[i][0] != '-' && input.empty()) {
+            input = argv[i];
+        } else {
+            fprintf(stderr, "Usage: %s [--vertices N] [--iterations N] [--out DIR] [file.gltf]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // 1. 입력 모델을 .gltf(+ .bin)와 .glb로 기록 (버퍼는 둘 다 같은 바이트)
+    tinygltf::TinyGLTF loader;
+    tinygltf::Model source;
+    std::string err;
+    std::string warn;
+    if (input.empty()) {
+        source = makeGridModel(vertexCount);
+    } else if (!loader.LoadASCIIFromFile(&source, &err, &warn, input)) {
+        fprintf(stderr, "Failed to load %s: %s\n", input.c_str(), err.c_str());
+        return 2;
+    }
+    // 이미지는 이 벤치마크의 측정 대상이 아니므로 제외 (디코딩 비용이 경로 차이를 가림)
+    source.images.clear();
+    source.textures.clear();
+    for (auto& material : source.materials) material = tinygltf::Material();
+    for (auto& buffer : source.buffers) buffer.uri.clear();
+
+    const std::string gltfPath = outDir + "/gltf_load_bench.gltf";
+    const std::string glbPath = outDir + "/gltf_load_bench.glb";
+    if (!loader.WriteGltfSceneToFile(&source, gltfPath, false, false, false, false) ||
+        !loader.WriteGltfSceneToFile(&source, glbPath, false, true, false, true)) {
+        fprintf(stderr, "Failed to write benchmark files to %s\n", outDir.c_str());
+        return 2;
+    }
+    size_t bufferBytes = 0;
+    for (const auto& buffer : source.buffers) bufferBytes += buffer.data.size();
+    printf("accessors=%zu buffer=%.1f MB  .gltf=%.1f KB  .glb=%.1f MB  iterations=%u\n", source.accessors.size(),
+           bufferBytes / 1e6, getFileSize(gltfPath) / 1e3, getFileSize(glbPath) / 1e6, iterations);
+
+    // 2. 세 경로 측정 (각 경로는 매번 새 로더/모델로 시작)
+    std::vector<float> scratch;
+    Result ascii = measure(iterations, [&](double& checksum) {
+        tinygltf::TinyGLTF gltfLoader;
+        tinygltf::Model model;
+        std::string loadErr;
+        std::string loadWarn;
+        if (!gltfLoader.LoadASCIIFromFile(&model, &loadErr, &loadWarn, gltfPath)) return false;
+        checksum = decodeAccessors(model, getBufferSpans(model), scratch);
+        return !std::isnan(checksum);
+    });
+    Result glbFile = measure(iterations, [&](double& checksum) {
+        tinygltf::TinyGLTF glbLoader;
+        tinygltf::Model model;
+        std::string loadErr;
+        std::string loadWarn;
+        if (!glbLoader.LoadBinaryFromFile(&model, &loadErr, &loadWarn, glbPath)) return false;
+        checksum = decodeAccessors(model, getBufferSpans(model), scratch);
+        return !std::isnan(checksum);
+    });
+    AssetUtils::setHostAssetRoot("");
+    Result glbMapped = measure(iterations, [&](double& checksum) {
+        tinygltf::TinyGLTF glbLoader;
+        tinygltf::Model model;
+        std::string loadErr;
+        std::string loadWarn;
+        AssetUtils::MappedAsset mapped;
+        AssetUtils::GlbChunks glb;
+        if (!mapped.open(nullptr, glbPath) || !AssetUtils::parseGlb(mapped.getBytes(), glb) ||
+            !glbLoader.LoadBinaryFromMemory(&model, &loadErr, &loadWarn, mapped.getBytes().data,
+                                            static_cast<unsigned int>(mapped.getBytes().size), outDir)) {
+            return false;
+        }
+        std::vector<AssetUtils::ByteSpan> buffers = getBufferSpans(model);
+        if (!buffers.empty() && model.buffers[0].uri.empty() && glb.bin.size >= buffers[0].size) {
+            buffers[0].data = glb.bin.data;
+            std::vector<unsigned char>().swap(model.buffers[0].data);
+        }
+        checksum = decodeAccessors(model, buffers, scratch);
+        return !std::isnan(checksum);
+    });
+
+    bool failed = false;
+    auto print = [&](const char* name, const Result& result) {
+        bool same = result.ok && result.checksum == ascii.checksum;
+        failed |= !same;
+        printf("%-11s %9.2f ms  (x%.2f vs gltf)  checksum %.6e  %s\n", name, result.milliseconds,
+               ascii.milliseconds / result.milliseconds, result.checksum, same ? "OK" : "MISMATCH");
+    };
+    print("gltf", ascii);
+    print("glb file", glbFile);
+    print("glb mapped", glbMapped);
+
+    // WriteGltfSceneToFile이 만든 외부 버퍼 이름: gltf_load_bench.bin, gltf_load_bench0.bin, ...
+    std::remove(gltfPath.c_str());
+    std::remove(glbPath.c_str());
+    std::remove((outDir + "/gltf_load_bench.bin").c_str());
+    for (size_t i = 0; i + 1 < source.buffers.size(); i++) {
+        std::remove((outDir + "/gltf_load_bench" + std::to_string(i) + ".bin").c_str());
+    }
+    return failed ? 1 : 0;
+}
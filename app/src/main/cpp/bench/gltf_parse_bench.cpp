@@ -0,0 +1,415 @@
+// glTF JSON 파싱 벤치마크: tinygltf(DOM) 대비 Gltf::File(풀 파서 + arena) (호스트 전용)
+// 노드/메시/접근자/애니메이션이 많은 합성 씬(또는 지정한 .gltf)을 .gltf + .bin으로 기록한 뒤,
+// 파일을 열어 문서를 만들 때까지의 시간(반복 중 최솟값)과 그동안의 최대 힙 사용량을 비교합니다.
+//   tinygltf    LoadASCIIFromFile (JSON DOM을 만든 뒤 Model로 복사, .bin은 std::vector로 읽음)
+//   Gltf::File  VulkanModel::loadFromFile의 경로 (JSON을 한 번 훑으며 arena에 채움, .bin은 mmap)
+// 힙 사용량은 전역 operator new/delete를 가로채 측정하므로 mmap한 바이트는 포함되지 않습니다.
+// 두 결과의 개수/체크섬(노드 변환, 접근자, 애니메이션 채널, 버퍼 크기)이 다르면 종료 코드 1을 반환합니다.
+//
+// 사용법: gltf_parse_bench [--nodes N] [--iterations N] [--out DIR] [file.gltf]
+
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "tiny_gltf.h"
+
+#include "asset_utils.h"
+#include "gltf.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+// 할당마다 크기를 앞에 붙여 현재/최대 사용량을 추적
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+std::atomic<size_t> gHeapBytes{0};
+std::atomic<size_t> gPeakHeapBytes{0};
+
+void* trackedAlloc(size_t size) {
+    uint8_t* block = static_cast<uint8_t*>(std::malloc(size + kHeaderSize));
+    if (!block) throw std::bad_alloc();
+    std::memcpy(block, &size, sizeof(size));
+    size_t current = gHeapBytes.fetch_add(size) + size;
+    size_t peak = gPeakHeapBytes.load();
+    while (current > peak && !gPeakHeapBytes.compare_exchange_weak(peak, current)) {
+    }
+    return block + kHeaderSize;
+}
+
+void trackedFree(void* pointer) {
+    if (!pointer) return;
+    uint8_t* block = static_cast<uint8_t*>(pointer) - kHeaderSize;
+    size_t size = 0;
+    std::memcpy(&size, block, sizeof(size));
+    gHeapBytes.fetch_sub(size);
+    std::free(block);
+}
+} // namespace
+
+void* operator new(size_t size) { return trackedAlloc(size); }
+void* operator new[](size_t size) { return trackedAlloc(size); }
+void operator delete(void* pointer) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { trackedFree(pointer); }
+
+namespace {
+// 4분 트리 노드 계층 + 노드 4개당 메시 1개(POSITION/TEXCOORD_0/COLOR_0/인덱스 접근자) + 이동/회전 애니메이션
+// 접근자는 작은 bufferView 몇 개를 공유하므로 .bin은 작고 JSON이 대부분을 차지함 (익스포터가 만든 큰 씬과 비슷한 비율)
+tinygltf::Model makeSceneModel(size_t nodeCount) {
+    constexpr size_t kVertices = 24;
+    constexpr size_t kIndices = 36;
+    constexpr size_t kKeys = 8;
+
+    tinygltf::Model model;
+    model.asset.version = "2.0";
+    model.asset.generator = "gltf_parse_bench";
+    tinygltf::Buffer buffer;
+    auto appendView = [&](size_t byteLength) {
+        tinygltf::BufferView view;
+        view.buffer = 0;
+        view.byteOffset = buffer.data.size();
+        view.byteLength = byteLength;
+        buffer.data.resize(buffer.data.size() + ((byteLength + 3) & ~size_t(3)));
+        for (size_t i = view.byteOffset; i < buffer.data.size(); i++) buffer.data[i] = static_cast<uint8_t>(i * 7);
+        model.bufferViews.push_back(view);
+        return static_cast<int>(model.bufferViews.size() - 1);
+    };
+    auto appendAccessor = [&](int view, int componentType, int type, size_t count, bool normalized) {
+        tinygltf::Accessor accessor;
+        accessor.bufferView = view;
+        accessor.componentType = componentType;
+        accessor.type = type;
+        accessor.count = count;
+        accessor.normalized = normalized;
+        model.accessors.push_back(accessor);
+        return static_cast<int>(model.accessors.size() - 1);
+    };
+    int positionView = appendView(kVertices * 12);
+    int uvView = appendView(kVertices * 4);
+    int colorView = appendView(kVertices * 4);
+    int indexView = appendView(kIndices * 2);
+    int timeView = appendView(kKeys * 4);
+    int translationView = appendView(kKeys * 12);
+    int rotationView = appendView(kKeys * 16);
+    // 시간 키는 증가해야 하므로 직접 채움
+    for (size_t k = 0; k < kKeys; k++) {
+        float time = k * 0.25f;
+        std::memcpy(&buffer.data[model.bufferViews[timeView].byteOffset + k * 4], &time, 4);
+    }
+    model.buffers.push_back(std::move(buffer));
+
+    for (size_t i = 0; i < nodeCount / 4; i++) {
+        tinygltf::Primitive primitive;
+        primitive.attributes["POSITION"] =
+                appendAccessor(positionView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, kVertices, false);
+        model.accessors.back().minValues = { -1.0, -1.0, -1.0 };
+        model.accessors.back().maxValues = { 1.0, 1.0, 1.0 };
+        primitive.attributes["TEXCOORD_0"] =
+                appendAccessor(uvView, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TYPE_VEC2, kVertices, true);
+        primitive.attributes["COLOR_0"] =
+                appendAccessor(colorView, TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE, TINYGLTF_TYPE_VEC4, kVertices, true);
+        primitive.indices = appendAccessor(indexView, TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, TINYGLTF_TYPE_SCALAR,
+                                           kIndices, false);
+        primitive.material = 0;
+        primitive.mode = TINYGLTF_MODE_TRIANGLES;
+        tinygltf::Mesh mesh;
+        mesh.name = "mesh_" + std::to_string(i);
+        mesh.primitives.push_back(primitive);
+        model.meshes.push_back(mesh);
+    }
+
+    model.nodes.resize(nodeCount);
+    for (size_t i = 0; i < nodeCount; i++) {
+        tinygltf::Node& node = model.nodes[i];
+        node.name = "node_" + std::to_string(i);
+        node.translation = { (i % 97) * 0.5, (i % 13) * 0.25, -0.125 * (i % 7) };
+        node.rotation = { 0.0, 0.70710678118654752, 0.0, 0.70710678118654752 };
+        node.scale = { 1.0, 1.0 + (i % 3) * 0.5, 1.0 };
+        if (i % 4 == 0 && i / 4 < model.meshes.size()) node.mesh = static_cast<int>(i / 4);
+        if (i > 0) model.nodes[(i - 1) / 4].children.push_back(static_cast<int>(i));
+    }
+    tinygltf::Scene scene;
+    scene.nodes.push_back(0);
+    model.scenes.push_back(scene);
+    model.defaultScene = 0;
+
+    tinygltf::Material material;
+    material.pbrMetallicRoughness.baseColorFactor = { 0.8, 0.6, 0.4, 1.0 };
+    model.materials.push_back(material);
+
+    // 애니메이션 4개, 각각 노드 8개 중 1개의 이동 + 회전
+    for (size_t a = 0; a < 4; a++) {
+        tinygltf::Animation animation;
+        animation.name = "clip_" + std::to_string(a);
+        for (size_t node = a; node < nodeCount; node += 8) {
+            int input = appendAccessor(timeView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_SCALAR, kKeys, false);
+            model.accessors[input].minValues = { 0.0 };
+            model.accessors[input].maxValues = { (kKeys - 1) * 0.25 };
+            int translation =
+                    appendAccessor(translationView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC3, kKeys, false);
+            int rotation =
+                    appendAccessor(rotationView, TINYGLTF_COMPONENT_TYPE_FLOAT, TINYGLTF_TYPE_VEC4, kKeys, false);
+            for (int output : { translation, rotation }) {
+                tinygltf::AnimationSampler sampler;
+                sampler.input = input;
+                sampler.output = output;
+                sampler.interpolation = output == rotation ? "STEP" : "LINEAR";
+                animation.samplers.push_back(sampler);
+                tinygltf::AnimationChannel channel;
+                channel.sampler = static_cast<int>(animation.samplers.size() - 1);
+                channel.target_node = static_cast<int>(node);
+                channel.target_path = output == rotation ? "rotation" : "translation";
+                animation.channels.push_back(channel);
+            }
+        }
+        model.animations.push_back(animation);
+    }
+    return model;
+}
+
+// 두 파서 결과에 공통인 필드만 모은 요약 (double은 float로 내려 비교)
+struct Summary {
+    size_t nodes = 0;
+    size_t meshes = 0;
+    size_t accessors = 0;
+    size_t channels = 0;
+    size_t bufferBytes = 0;
+    double checksum = 0.0;
+
+    bool operator==(const Summary& other) const {
+        return nodes == other.nodes && meshes == other.meshes && accessors == other.accessors &&
+               channels == other.channels && bufferBytes == other.bufferBytes && checksum == other.checksum;
+    }
+};
+
+double sumFloats(const std::vector<double>& values) {
+    double sum = 0.0;
+    for (double value : values) sum += static_cast<float>(value);
+    return sum;
+}
+
+// 위와 같은 순서로 더함 (합산 순서가 다르면 큰 씬에서 반올림 오차가 달라짐)
+double sumFloats(const float* values, size_t count) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) sum += values[i];
+    return sum;
+}
+
+Summary summarize(const tinygltf::Model& model) {
+    Summary summary;
+    summary.nodes = model.nodes.size();
+    summary.meshes = model.meshes.size();
+    summary.accessors = model.accessors.size();
+    for (const auto& buffer : model.buffers) summary.bufferBytes += buffer.data.size();
+    double& sum = summary.checksum;
+    for (const tinygltf::Node& node : model.nodes) {
+        // 생략된 TRS는 Gltf::Node의 기본값으로
+        sum += sumFloats(node.translation) + (node.rotation.empty() ? 1.0 : sumFloats(node.rotation)) +
+               (node.scale.empty() ? 3.0 : sumFloats(node.scale)) + node.mesh;
+        for (int child : node.children) sum += child;
+    }
+    for (const tinygltf::Mesh& mesh : model.meshes) {
+        for (const tinygltf::Primitive& primitive : mesh.primitives) {
+            // Gltf::Attributes가 읽는 속성만
+            for (const char* name : { "POSITION", "COLOR_0", "TEXCOORD_0", "JOINTS_0", "WEIGHTS_0" }) {
+                auto it = primitive.attributes.find(name);
+                if (it != primitive.attributes.end()) sum += it->second;
+            }
+            sum += primitive.indices + primitive.material;
+        }
+    }
+    for (const tinygltf::Accessor& accessor : model.accessors) {
+        sum += accessor.bufferView + static_cast<double>(accessor.count) * accessor.componentType + accessor.type;
+    }
+    for (const tinygltf::Animation& animation : model.animations) {
+        summary.channels += animation.channels.size();
+        for (const auto& channel : animation.channels) {
+            sum += channel.sampler + channel.target_node + (channel.target_path == "rotation" ? 1 : 0);
+        }
+        for (const auto& sampler : animation.samplers) {
+            sum += sampler.input + sampler.output + (sampler.interpolation == "STEP" ? 1 : 0);
+        }
+    }
+    return summary;
+}
+
+// tinygltf의 TINYGLTF_TYPE_* 값 (VEC2 = 2, ... MAT4 = 36, SCALAR = 65)
+int toTinyGltfType(Gltf::AccessorType type) {
+    switch (type) {
+        case Gltf::AccessorType::Scalar: return TINYGLTF_TYPE_SCALAR;
+        case Gltf::AccessorType::Vec2: return TINYGLTF_TYPE_VEC2;
+        case Gltf::AccessorType::Vec3: return TINYGLTF_TYPE_VEC3;
+        case Gltf::AccessorType::Vec4: return TINYGLTF_TYPE_VEC4;
+        case Gltf::AccessorType::Mat2: return TINYGLTF_TYPE_MAT2;
+        case Gltf::AccessorType::Mat3: return TINYGLTF_TYPE_MAT3;
+        case Gltf::AccessorType::Mat4: return TINYGLTF_TYPE_MAT4;
+    }
+    return -1;
+}
+
+Summary summarize(const Gltf::File& file) {
+    const Gltf::Document& document = file.getDocument();
+    Summary summary;
+    summary.nodes = document.nodes.size();
+    summary.meshes = document.meshes.size();
+    summary.accessors = document.accessors.size();
+    for (size_t i = 0; i < document.buffers.size(); i++) summary.bufferBytes += document.buffers[i].byteLength;
+    double& sum = summary.checksum;
+    for (const Gltf::Node& node : document.nodes) {
+        sum += sumFloats(node.translation, 3) + sumFloats(node.rotation, 4) + sumFloats(node.scale, 3) + node.mesh;
+        for (int32_t child : node.children) sum += child;
+    }
+    for (const Gltf::Mesh& mesh : document.meshes) {
+        for (const Gltf::Primitive& primitive : mesh.primitives) {
+            const Gltf::Attributes& attributes = primitive.attributes;
+            for (int32_t attribute : { attributes.position, attributes.color0, attributes.texcoord0,
+                                       attributes.joints0, attributes.weights0 }) {
+                if (attribute >= 0) sum += attribute;
+            }
+            sum += primitive.indices + primitive.material;
+        }
+    }
+    for (const Gltf::Accessor& accessor : document.accessors) {
+        sum += accessor.bufferView + static_cast<double>(accessor.count) * accessor.componentType +
+               toTinyGltfType(accessor.type);
+    }
+    for (const Gltf::Animation& animation : document.animations) {
+        summary.channels += animation.channels.size();
+        for (const auto& channel : animation.channels) {
+            sum += channel.sampler + channel.targetNode + (channel.targetPath == Gltf::TargetPath::Rotation ? 1 : 0);
+        }
+        for (const auto& sampler : animation.samplers) {
+            sum += sampler.input + sampler.output + (sampler.interpolation == Gltf::Interpolation::Step ? 1 : 0);
+        }
+    }
+    return summary;
+}
+
+struct Result {
+    double milliseconds = 0.0; // 반복 중 최솟값
+    size_t peakHeapBytes = 0;  // 반복 중 최댓값 (시작 시점 대비)
+    Summary summary;
+    bool ok = true;
+};
+
+template <typename Fn>
+Result measure(uint32_t iterations, Fn&& load) {
+    Result result;
+    result.milliseconds = 1e300;
+    for (uint32_t i = 0; i < iterations; i++) {
+        size_t baseline = gHeapBytes.load();
+        gPeakHeapBytes.store(baseline);
+        auto start = std::chrono::steady_clock::now();
+        bool ok = load(result.summary);
+        auto end = std::chrono::steady_clock::now();
+        result.milliseconds = std::min(result.milliseconds,
+                                       std::chrono::duration<double, std::milli>(end - start).count());
+        result.peakHeapBytes = std::max(result.peakHeapBytes, gPeakHeapBytes.load() - baseline);
+        result.ok &= ok;
+    }
+    return result;
+}
+
+size_t getFileSize(const std::string& path) {
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<size_t>(size);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t nodeCount = 40000;
+    uint32_t iterations = 5;
+    std::string outDir = std::filesystem::temp_directory_path().string();
+    std::string input;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--nodes") == 0 && hasValue) {
+            nodeCount = std::max<size_t>(8, strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--iterations") == 0 && hasValue) {
+            iterations = std::max<uint32_t>(1, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else if (strcmp(argv[i], "--out") == 0 && hasValue) {
+            outDir = argv[++i];
+        } else if (argv[i][0] != '-' && input.empty()) {
+            input = argv[i];
+        } else {
+            fprintf(stderr, "Usage: %s [--nodes N] [--iterations N] [--out DIR] [file.gltf]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // 1. 입력 모델을 .gltf + .bin으로 기록 (이미지는 측정 대상이 아니므로 제외)
+    tinygltf::TinyGLTF loader;
+    tinygltf::Model source;
+    std::string err;
+    std::string warn;
+    if (input.empty()) {
+        source = makeSceneModel(nodeCount);
+    } else if (!loader.LoadASCIIFromFile(&source, &err, &warn, input)) {
+        fprintf(stderr, "Failed to load %s: %s\n", input.c_str(), err.c_str());
+        return 2;
+    }
+    source.images.clear();
+    source.textures.clear();
+    for (auto& material : source.materials) material.pbrMetallicRoughness.baseColorTexture = tinygltf::TextureInfo();
+    for (auto& buffer : source.buffers) buffer.uri.clear();
+
+    const std::string gltfPath = outDir + "/gltf_parse_bench.gltf";
+    if (!loader.WriteGltfSceneToFile(&source, gltfPath, false, false, true, false)) {
+        fprintf(stderr, "Failed to write benchmark files to %s\n", outDir.c_str());
+        return 2;
+    }
+    printf("nodes=%zu meshes=%zu accessors=%zu animations=%zu  .gltf=%.1f MB  iterations=%u\n",
+           source.nodes.size(), source.meshes.size(), source.accessors.size(), source.animations.size(),
+           getFileSize(gltfPath) / 1e6, iterations);
+    size_t bufferCount = source.buffers.size();
+    source = tinygltf::Model();
+
+    // 2. 두 경로 측정 (매번 새 로더/문서로 시작, 결과 요약은 측정 시간에 포함)
+    Result tiny = measure(iterations, [&](Summary& summary) {
+        tinygltf::TinyGLTF gltfLoader;
+        tinygltf::Model model;
+        std::string loadErr;
+        std::string loadWarn;
+        if (!gltfLoader.LoadASCIIFromFile(&model, &loadErr, &loadWarn, gltfPath)) return false;
+        summary = summarize(model);
+        return true;
+    });
+    AssetUtils::setHostAssetRoot("");
+    size_t arenaBytes = 0;
+    Result pull = measure(iterations, [&](Summary& summary) {
+        Gltf::File file;
+        if (!file.open(nullptr, gltfPath)) return false;
+        summary = summarize(file);
+        arenaBytes = file.getArenaBytes();
+        return true;
+    });
+
+    bool same = tiny.ok && pull.ok && tiny.summary == pull.summary;
+    auto print = [&](const char* name, const Result& result) {
+        printf("%-11s %9.2f ms  peak heap %8.2f MB  checksum %.6e\n", name, result.milliseconds,
+               result.peakHeapBytes / 1e6, result.summary.checksum);
+    };
+    print("tinygltf", tiny);
+    print("Gltf::File", pull);
+    printf("speedup x%.2f, peak heap x%.2f smaller (arena %.2f MB)  %s\n", tiny.milliseconds / pull.milliseconds,
+           static_cast<double>(tiny.peakHeapBytes) / std::max<size_t>(1, pull.peakHeapBytes), arenaBytes / 1e6,
+           same ? "OK" : "MISMATCH");
+
+    // WriteGltfSceneToFile이 만든 외부 버퍼 이름: gltf_parse_bench.bin, gltf_parse_bench0.bin, ...
+    std::remove(gltfPath.c_str());
+    std::remove((outDir + "/gltf_parse_bench.bin").c_str());
+    for (size_t i = 0; i + 1 < bufferCount; i++) {
+        std::remove((outDir + "/gltf_parse_bench" + std::to_string(i) + ".bin").c_str());
+    }
+    return same ? 0 : 1;
+}
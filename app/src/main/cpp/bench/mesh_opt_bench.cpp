@@ -0,0 +1,215 @@
+// 메시 최적화 CPU 벤치마크 (호스트 전용)
+// glTF 에셋의 각 프리미티브(또는 합성 그리드)에 MeshOptimizer를 적용하고
+// 최적화 전후 ACMR/ATVR과 처리 시간을 출력합니다.
+//
+// 사용법: mesh_opt_bench [--cache N] [--grid N] [file.gltf ...]
+//         파일을 지정하지 않으면 기본 에셋(AnimatedCube)과 200x200 셔플 그리드를 측정
+
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "tiny_gltf.h"
+
+#include "mesh_optimizer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef MYGAME_ASSET_DIR
+#define MYGAME_ASSET_DIR "assets"
+#endif
+
+namespace {
+struct MeshData {
+    std::string name;
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+};
+
+struct Totals {
+    uint64_t triangles = 0;
+    uint64_t transformedBefore = 0;
+    uint64_t transformedAfter = 0;
+    double milliseconds = 0.0;
+};
+
+// 정점 속성 추출 (float POSITION / TEXCOORD_0, 인덱스는 모든 정수 타입)
+bool extractPrimitive(const tinygltf::Model& model, const tinygltf::Primitive& primitive, MeshData& out) {
+    auto posIt = primitive.attributes.find("POSITION");
+    if (posIt == primitive.attributes.end()) return false;
+
+    const tinygltf::Accessor& posAccessor = model.accessors[posIt->second];
+    const tinygltf::BufferView& posView = model.bufferViews[posAccessor.bufferView];
+    const unsigned char* posData = &model.buffers[posView.buffer].data[posView.byteOffset + posAccessor.byteOffset];
+    int posStride = posAccessor.ByteStride(posView);
+
+    out.vertices.resize(posAccessor.count);
+    for (size_t i = 0; i < posAccessor.count; i++) {
+        const float* p = reinterpret_cast<const float*>(posData + i * posStride);
+        out.vertices[i].pos = glm::vec3(p[0], p[1], p[2]);
+        out.vertices[i].color = glm::vec3(1.0f);
+        out.vertices[i].texCoord = glm::vec2(0.0f);
+    }
+
+    auto uvIt = primitive.attributes.find("TEXCOORD_0");
+    if (uvIt != primitive.attributes.end()) {
+        const tinygltf::Accessor& uvAccessor = model.accessors[uvIt->second];
+        const tinygltf::BufferView& uvView = model.bufferViews[uvAccessor.bufferView];
+        const unsigned char* uvData = &model.buffers[uvView.buffer].data[uvView.byteOffset + uvAccessor.byteOffset];
+        int uvStride = uvAccessor.ByteStride(uvView);
+        for (size_t i = 0; i < uvAccessor.count && i < out.vertices.size(); i++) {
+            const float* uv = reinterpret_cast<const float*>(uvData + i * uvStride);
+            out.vertices[i].texCoord = glm::vec2(uv[0], uv[1]);
+        }
+    }
+
+    if (primitive.indices >= 0) {
+        const tinygltf::Accessor& indexAccessor = model.accessors[primitive.indices];
+        const tinygltf::BufferView& indexView = model.bufferViews[indexAccessor.bufferView];
+        const unsigned char* indexData =
+                &model.buffers[indexView.buffer].data[indexView.byteOffset + indexAccessor.byteOffset];
+        out.indices.resize(indexAccessor.count);
+        for (size_t i = 0; i < indexAccessor.count; i++) {
+            switch (indexAccessor.componentType) {
+                case TINYGLTF_PARAMETER_TYPE_UNSIGNED_INT:
+                    out.indices[i] = reinterpret_cast<const uint32_t*>(indexData)[i];
+                    break;
+                case TINYGLTF_PARAMETER_TYPE_UNSIGNED_SHORT:
+                    out.indices[i] = reinterpret_cast<const uint16_t*>(indexData)[i];
+                    break;
+                default:
+                    out.indices[i] = indexData[i];
+                    break;
+            }
+        }
+    } else {
+        out.indices.resize(out.vertices.size());
+        for (uint32_t i = 0; i < static_cast<uint32_t>(out.vertices.size()); i++) out.indices[i] = i;
+    }
+    return true;
+}
+
+bool loadGltf(const std::string& path, std::vector<MeshData>& meshes) {
+    tinygltf::Model model;
+    tinygltf::TinyGLTF loader;
+    std::string err;
+    std::string warn;
+    bool binary = path.size() > 4 && path.compare(path.size() - 4, 4, ".glb") == 0;
+    bool ret = binary ? loader.LoadBinaryFromFile(&model, &err, &warn, path)
+                      : loader.LoadASCIIFromFile(&model, &err, &warn, path);
+    if (!ret) {
+        fprintf(stderr, "Failed to load %s: %s\n", path.c_str(), err.c_str());
+        return false;
+    }
+
+    for (size_t m = 0; m < model.meshes.size(); m++) {
+        for (size_t p = 0; p < model.meshes[m].primitives.size(); p++) {
+            MeshData mesh;
+            mesh.name = path + " mesh" + std::to_string(m) + "/prim" + std::to_string(p);
+            if (extractPrimitive(model, model.meshes[m].primitives[p], mesh)) meshes.push_back(std::move(mesh));
+        }
+    }
+    return true;
+}
+
+// 삼각형 순서를 섞은 정규 그리드 (익스포터가 순서를 최적화하지 않은 최악의 경우 근사)
+MeshData makeShuffledGrid(uint32_t size) {
+    MeshData mesh;
+    mesh.name = "grid" + std::to_string(size) + "x" + std::to_string(size) + " (shuffled)";
+    for (uint32_t y = 0; y <= size; y++) {
+        for (uint32_t x = 0; x <= size; x++) {
+            Vertex v{};
+            v.pos = glm::vec3(static_cast<float>(x), static_cast<float>(y), 0.0f);
+            v.color = glm::vec3(1.0f);
+            v.texCoord = glm::vec2(static_cast<float>(x) / size, static_cast<float>(y) / size);
+            mesh.vertices.push_back(v);
+        }
+    }
+
+    std::vector<uint32_t> grid;
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) {
+            uint32_t i = y * (size + 1) + x;
+            uint32_t quad[6] = { i, i + 1, i + size + 1, i + 1, i + size + 2, i + size + 1 };
+            grid.insert(grid.end(), quad, quad + 6);
+        }
+    }
+
+    std::vector<uint32_t> order(grid.size() / 3);
+    for (uint32_t t = 0; t < order.size(); t++) order[t] = t;
+    std::mt19937 rng(12345); // 결과 재현을 위해 고정 시드
+    std::shuffle(order.begin(), order.end(), rng);
+    for (uint32_t t : order) mesh.indices.insert(mesh.indices.end(), &grid[t * 3], &grid[t * 3] + 3);
+    return mesh;
+}
+
+void runMesh(MeshData& mesh, uint32_t cacheSize, Totals& totals) {
+    MeshOptimizer::CacheStats before = MeshOptimizer::analyzeVertexCache(mesh.indices, mesh.vertices.size(), cacheSize);
+    size_t vertexCountBefore = mesh.vertices.size();
+
+    auto start = std::chrono::steady_clock::now();
+    MeshOptimizer::optimize(mesh.vertices, mesh.indices);
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+    MeshOptimizer::CacheStats after = MeshOptimizer::analyzeVertexCache(mesh.indices, mesh.vertices.size(), cacheSize);
+
+    printf("%-48s tris=%-8zu verts=%zu->%zu  ACMR %.3f->%.3f  ATVR %.3f->%.3f  %.2fms\n",
+           mesh.name.c_str(), mesh.indices.size() / 3, vertexCountBefore, mesh.vertices.size(),
+           before.acmr, after.acmr, before.atvr, after.atvr, ms);
+
+    totals.triangles += mesh.indices.size() / 3;
+    totals.transformedBefore += before.transformedVertices;
+    totals.transformedAfter += after.transformedVertices;
+    totals.milliseconds += ms;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t cacheSize = 16;
+    uint32_t gridSize = 200;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--cache") == 0 && hasValue) {
+            cacheSize = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--grid") == 0 && hasValue) {
+            gridSize = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "Usage: %s [--cache N] [--grid N] [file.gltf ...]\n", argv[0]);
+            return 2;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        files.push_back(std::string(MYGAME_ASSET_DIR) + "/glTF/AnimatedCube/AnimatedCube.gltf");
+    }
+
+    std::vector<MeshData> meshes;
+    for (const auto& file : files) {
+        if (!loadGltf(file, meshes)) return 1;
+    }
+    if (gridSize > 0) meshes.push_back(makeShuffledGrid(gridSize));
+
+    printf("FIFO cache size %u\n", cacheSize);
+    Totals totals;
+    for (auto& mesh : meshes) {
+        runMesh(mesh, cacheSize, totals);
+    }
+
+    double triangles = static_cast<double>(totals.triangles);
+    printf("total: tris=%llu  ACMR %.3f->%.3f  optimize %.2fms (%.1f Mtri/s)\n",
+           static_cast<unsigned long long>(totals.triangles),
+           triangles > 0 ? totals.transformedBefore / triangles : 0.0,
+           triangles > 0 ? totals.transformedAfter / triangles : 0.0,
+           totals.milliseconds,
+           totals.milliseconds > 0.0 ? triangles / (totals.milliseconds * 1000.0) : 0.0);
+    return 0;
+}
@@ -0,0 +1,321 @@
+// EXT_meshopt_compression 디코더 검사 + 처리량 벤치마크 (호스트 전용)
+// 1. meshoptimizer 인코더 출력(정점/인덱스/시퀀스 코덱)을 그대로 디코딩해 원본 데이터와 비교
+// 2. 필터(OCTAHEDRAL/QUATERNION/EXPONENTIAL)는 meshoptimizer 인코더와 같은 식으로 인코딩한 값을 되돌려 비교
+// 3. 큰 정점 버퍼를 인코딩해 디코딩 처리량(출력 GB/s)을 재고 원본과 같은지 검사
+// 하나라도 불일치하면 종료 코드 1을 반환합니다.
+//
+// 사용법: meshopt_codec_bench [--vertices N] [--iterations N]
+
+#include "meshopt_codec.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+// meshoptimizer 인코더 출력: 정점 4개(12바이트 = u16 위치 3 + u8 법선 2 + u16 UV 2 중 위치만 사용)
+const uint16_t kVertexSource[4][6] = {
+    { 0, 0, 0, 0, 0, 0 },
+    { 300, 0, 0, 0, 0, 0 },
+    { 0, 300, 0, 0, 0, 0 },
+    { 300, 300, 0, 0, 0, 0 },
+};
+const uint8_t kVertexData[] = {
+    0xa0, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x58, 0x57, 0x58, 0x01, 0x26, 0x00, 0x00, 0x00, 0x01,
+    0x0c, 0x00, 0x00, 0x00, 0x58, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// 삼각형 목록 (4 6 5는 회전 없이 next 순서를 깨는 경우, 7 8 9는 모든 인덱스가 자유 인덱스인 경우)
+const uint32_t kIndexSource[] = { 0, 1, 2, 2, 1, 3, 4, 6, 5, 7, 8, 9 };
+const uint8_t kIndexData[] = {
+    0xe0, 0xf0, 0x10, 0xfe, 0xff, 0xf0, 0x0c, 0xff, 0x02, 0x02, 0x02, 0x00, 0x76, 0x87, 0x56, 0x67,
+    0x78, 0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00,
+};
+
+const uint32_t kSequenceSource[] = { 0, 1, 51, 2, 49, 1000 };
+const uint8_t kSequenceData[] = {
+    0xd1, 0x00, 0x04, 0xcd, 0x01, 0x04, 0x07, 0x98, 0x1f, 0x00, 0x00, 0x00, 0x00,
+};
+
+bool report(const char* name, bool ok) {
+    printf("%-40s %s\n", name, ok ? "OK" : "FAIL");
+    return ok;
+}
+
+// N비트 snorm 양자화 (meshopt_quantizeSnorm)
+int quantizeSnorm(float v, int bits) {
+    const float scale = static_cast<float>((1 << (bits - 1)) - 1);
+    float clamped = std::max(-1.0f, std::min(v, 1.0f));
+    return static_cast<int>(clamped * scale + (clamped >= 0.0f ? 0.5f : -0.5f));
+}
+
+// meshopt_encodeFilterOct: 8면체 좌표 (u, v) + z 자리에 1.0, 디코더가 z = 1 - |u| - |v|로 복원
+template <typename T>
+void encodeOctahedral(T* out, const float n[3], int bits) {
+    float length = std::fabs(n[0]) + std::fabs(n[1]) + std::fabs(n[2]);
+    float x = n[0] / length;
+    float y = n[1] / length;
+    float u = n[2] >= 0.0f ? x : (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+    float v = n[2] >= 0.0f ? y : (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+    out[0] = static_cast<T>(quantizeSnorm(u, bits));
+    out[1] = static_cast<T>(quantizeSnorm(v, bits));
+    out[2] = static_cast<T>(quantizeSnorm(1.0f, bits));
+    out[3] = 0;
+}
+
+// meshopt_encodeFilterQuat: 가장 큰 성분을 빼고 나머지 세 성분을 sqrt(2)배, w 자리에 (1.0 & ~3) | 빠진 성분 위치
+void encodeQuaternion(int16_t* out, const float q[4], int bits) {
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (std::fabs(q[i]) > std::fabs(q[largest])) largest = i;
+    }
+    float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+    for (int i = 0; i < 3; i++) {
+        out[i] = static_cast<int16_t>(quantizeSnorm(q[(largest + 1 + i) & 3] * std::sqrt(2.0f) * sign, bits));
+    }
+    out[3] = static_cast<int16_t>((quantizeSnorm(1.0f, bits) & ~3) | largest);
+}
+
+// 정점 코덱 v0 인코더 (meshoptimizer와 같은 비트스트림, 그룹마다 가장 작은 비트 폭만 고름)
+void encodeGroup(std::vector<uint8_t>& out, const uint8_t* deltas, int bits) {
+    if (bits == 0) return;
+    if (bits == 8) {
+        out.insert(out.end(), deltas, deltas + 16);
+        return;
+    }
+    const int sentinel = (1 << bits) - 1;
+    size_t base = out.size();
+    out.resize(base + 16 * bits / 8, 0);
+    for (int i = 0; i < 16; i++) {
+        int value = std::min<int>(deltas[i], sentinel);
+        out[base + i * bits / 8] |= static_cast<uint8_t>(value << (8 - bits - (i * bits) % 8));
+    }
+    // 표현 범위를 넘는 값은 그룹 뒤에 원래 바이트로
+    for (int i = 0; i < 16; i++) {
+        if (deltas[i] >= sentinel) out.push_back(deltas[i]);
+    }
+}
+
+size_t getGroupSize(const uint8_t* deltas, int bits) {
+    if (bits == 8) return 16;
+    const int sentinel = (1 << bits) - 1;
+    size_t size = 16 * bits / 8;
+    for (int i = 0; i < 16; i++) {
+        if (bits == 0 && deltas[i] != 0) return SIZE_MAX;
+        if (bits != 0 && deltas[i] >= sentinel) size++;
+    }
+    return size;
+}
+
+std::vector<uint8_t> encodeVertexBuffer(const uint8_t* data, size_t count, size_t stride) {
+    const size_t blockSize = std::min<size_t>((8192 / stride) & ~size_t(15), 256);
+    const int kBits[4] = { 0, 2, 4, 8 };
+    std::vector<uint8_t> out = { 0xa0 };
+    std::vector<uint8_t> last(data, data + stride);
+    std::vector<uint8_t> deltas;
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        size_t blockCount = std::min(blockSize, count - offset);
+        size_t groupCount = (blockCount + 15) / 16;
+        for (size_t k = 0; k < stride; k++) {
+            deltas.assign(groupCount * 16, 0);
+            uint8_t previous = last[k];
+            for (size_t i = 0; i < blockCount; i++) {
+                uint8_t value = data[(offset + i) * stride + k];
+                uint8_t delta = static_cast<uint8_t>(value - previous);
+                deltas[i] = static_cast<uint8_t>((delta << 1) ^ (static_cast<int8_t>(delta) >> 7)); // zigzag
+                previous = value;
+            }
+            size_t header = out.size();
+            out.resize(header + (groupCount + 3) / 4, 0);
+            for (size_t g = 0; g < groupCount; g++) {
+                int best = 3;
+                for (int b = 2; b >= 0; b--) {
+                    if (getGroupSize(&deltas[g * 16], kBits[b]) <= getGroupSize(&deltas[g * 16], kBits[best])) {
+                        best = b;
+                    }
+                }
+                out[header + g / 4] |= static_cast<uint8_t>(best << ((g % 4) * 2));
+                encodeGroup(out, &deltas[g * 16], kBits[best]);
+            }
+        }
+        std::memcpy(last.data(), data + (offset + blockCount - 1) * stride, stride);
+    }
+    // 꼬리: 최소 32바이트, 마지막 stride 바이트가 첫 원소의 기준값
+    out.insert(out.end(), std::max<size_t>(stride, 32) - stride, 0);
+    out.insert(out.end(), data, data + stride);
+    return out;
+}
+
+template <typename Fn>
+double measureMs(uint32_t iterations, Fn&& fn) {
+    fn(); // 워밍업 (출력 페이지 폴트 제외)
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+bool checkKnownBuffers() {
+    using namespace MeshoptCodec;
+    bool ok = true;
+
+    uint16_t vertices[4][6];
+    ok &= report("vertex codec v0 (stride 12)",
+                 decodeVertexBuffer(reinterpret_cast<uint8_t*>(vertices), 4, 12, kVertexData, sizeof(kVertexData)) &&
+                 std::memcmp(vertices, kVertexSource, sizeof(vertices)) == 0);
+
+    uint32_t indices32[12];
+    uint16_t indices16[12];
+    bool indexOk = decodeIndexBuffer(reinterpret_cast<uint8_t*>(indices32), 12, 4, kIndexData, sizeof(kIndexData)) &&
+                   decodeIndexBuffer(reinterpret_cast<uint8_t*>(indices16), 12, 2, kIndexData, sizeof(kIndexData));
+    for (size_t i = 0; indexOk && i < 12; i++) {
+        indexOk = indices32[i] == kIndexSource[i] && indices16[i] == kIndexSource[i];
+    }
+    ok &= report("index codec v0 (u32/u16)", indexOk);
+
+    uint32_t sequence[6];
+    ok &= report("index sequence codec v1",
+                 decodeIndexSequence(reinterpret_cast<uint8_t*>(sequence), 6, 4, kSequenceData,
+                                     sizeof(kSequenceData)) &&
+                 std::memcmp(sequence, kSequenceSource, sizeof(sequence)) == 0);
+
+    // 잘린 입력은 범위를 벗어나 읽지 않고 실패해야 함
+    ok &= report("truncated inputs rejected",
+                 !decodeVertexBuffer(reinterpret_cast<uint8_t*>(vertices), 4, 12, kVertexData, 40) &&
+                 !decodeIndexBuffer(reinterpret_cast<uint8_t*>(indices32), 12, 4, kIndexData, 20) &&
+                 !decodeIndexSequence(reinterpret_cast<uint8_t*>(sequence), 6, 4, kSequenceData, 8));
+    return ok;
+}
+
+bool checkFilters() {
+    using namespace MeshoptCodec;
+    bool ok = true;
+
+    // OCTAHEDRAL: 두 반구 모두 (z < 0은 접힌 좌표 경로)
+    const float normals[][3] = {
+        { 0.6f, 0.0f, -0.8f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f }, { -0.48f, 0.6f, 0.64f },
+        { -0.48f, -0.6f, -0.64f }, { 0.267261f, -0.534522f, -0.801784f },
+    };
+    const size_t normalCount = sizeof(normals) / sizeof(normals[0]);
+    std::vector<int8_t> oct8(normalCount * 4);
+    std::vector<int16_t> oct16(normalCount * 4);
+    for (size_t i = 0; i < normalCount; i++) {
+        encodeOctahedral(&oct8[i * 4], normals[i], 8);
+        encodeOctahedral(&oct16[i * 4], normals[i], 16);
+    }
+    bool octOk = applyFilter(reinterpret_cast<uint8_t*>(oct8.data()), normalCount, 4, Filter::Octahedral) &&
+                 applyFilter(reinterpret_cast<uint8_t*>(oct16.data()), normalCount, 8, Filter::Octahedral);
+    float octError = 0.0f;
+    for (size_t i = 0; octOk && i < normalCount; i++) {
+        for (int c = 0; c < 3; c++) {
+            octError = std::max(octError, std::fabs(oct8[i * 4 + c] / 127.0f - normals[i][c]) / 8.0f);
+            octError = std::max(octError, std::fabs(oct16[i * 4 + c] / 32767.0f - normals[i][c]));
+        }
+    }
+    // 8비트는 오차 허용치를 8배로 (위에서 /8로 맞춤)
+    ok &= report("filter OCTAHEDRAL (snorm8/snorm16)", octOk && octError < 2e-3f);
+
+    // QUATERNION: 빠진 성분 위치 4가지 모두 + 부호 반전(q와 -q는 같은 회전)
+    const float quaternions[][4] = {
+        { 0.9f, 0.3f, -0.3f, 0.1f }, { 0.1f, -0.95f, 0.2f, 0.2f }, { 0.5f, 0.5f, 0.5f, 0.5f },
+        { 0.0f, 0.0f, 0.0f, 1.0f }, { -0.2f, 0.1f, -0.3f, -0.9273618f },
+    };
+    const size_t quaternionCount = sizeof(quaternions) / sizeof(quaternions[0]);
+    std::vector<int16_t> quat(quaternionCount * 4);
+    for (size_t i = 0; i < quaternionCount; i++) {
+        float q[4];
+        float length = 0.0f;
+        for (int c = 0; c < 4; c++) length += quaternions[i][c] * quaternions[i][c];
+        for (int c = 0; c < 4; c++) q[c] = quaternions[i][c] / std::sqrt(length);
+        encodeQuaternion(&quat[i * 4], q, 16);
+    }
+    bool quatOk = applyFilter(reinterpret_cast<uint8_t*>(quat.data()), quaternionCount, 8, Filter::Quaternion);
+    float quatError = 0.0f;
+    for (size_t i = 0; quatOk && i < quaternionCount; i++) {
+        float length = 0.0f;
+        for (int c = 0; c < 4; c++) length += quaternions[i][c] * quaternions[i][c];
+        float dot = 0.0f;
+        for (int c = 0; c < 4; c++) dot += quat[i * 4 + c] / 32767.0f * quaternions[i][c] / std::sqrt(length);
+        quatError = std::max(quatError, 1.0f - std::fabs(dot));
+    }
+    ok &= report("filter QUATERNION (snorm16)", quatOk && quatError < 1e-4f);
+
+    // EXPONENTIAL: (지수 << 24) | 24비트 가수 -> 가수 * 2^지수 (정확히 표현되는 값만 사용)
+    const struct { int32_t mantissa; int32_t exponent; float value; } exponentials[] = {
+        { 3, -1, 1.5f }, { -5, 2, -20.0f }, { 0, 0, 0.0f }, { 8388607, -23, 8388607.0f / 8388608.0f },
+        { -8388608, -10, -8192.0f }, { 1, 10, 1024.0f },
+    };
+    const size_t exponentialCount = sizeof(exponentials) / sizeof(exponentials[0]);
+    std::vector<uint32_t> exp(exponentialCount);
+    for (size_t i = 0; i < exponentialCount; i++) {
+        exp[i] = (static_cast<uint32_t>(exponentials[i].exponent) << 24) |
+                 (static_cast<uint32_t>(exponentials[i].mantissa) & 0xffffff);
+    }
+    bool expOk = applyFilter(reinterpret_cast<uint8_t*>(exp.data()), exponentialCount, 4, Filter::Exponential);
+    for (size_t i = 0; expOk && i < exponentialCount; i++) {
+        float value;
+        std::memcpy(&value, &exp[i], 4);
+        expOk = value == exponentials[i].value;
+    }
+    ok &= report("filter EXPONENTIAL", expOk);
+
+    ok &= report("invalid filter stride rejected",
+                 !applyFilter(reinterpret_cast<uint8_t*>(quat.data()), 1, 4, Filter::Quaternion) &&
+                 !applyFilter(reinterpret_cast<uint8_t*>(oct16.data()), 1, 12, Filter::Octahedral));
+    return ok;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t vertexCount = 1u << 20;
+    uint32_t iterations = 10;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--vertices") == 0 && hasValue) {
+            vertexCount = std::max<size_t>(1, strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(argv[i], "--iterations") == 0 && hasValue) {
+            iterations = std::max<uint32_t>(1, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else {
+            fprintf(stderr, "Usage: %s [--vertices N] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    bool ok = checkKnownBuffers();
+    ok &= checkFilters();
+
+    // 처리량: int16 성분 10개(20바이트) 정점, 각 성분은 작은 잡음으로 움직이는 값
+    // (최적화된 순서의 메시처럼 인접 정점의 차이가 작음)
+    const size_t stride = 20;
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> noise(-24, 24);
+    std::vector<uint8_t> source(vertexCount * stride);
+    int16_t walk[stride / 2] = {};
+    for (size_t v = 0; v < vertexCount; v++) {
+        for (size_t c = 0; c < stride / 2; c++) {
+            walk[c] = static_cast<int16_t>(walk[c] + noise(rng));
+        }
+        std::memcpy(&source[v * stride], walk, stride);
+    }
+    std::vector<uint8_t> encoded = encodeVertexBuffer(source.data(), vertexCount, stride);
+    std::vector<uint8_t> decoded(source.size());
+    bool decodeOk = true;
+    double decodeMs = measureMs(iterations, [&]() {
+        decodeOk &= MeshoptCodec::decodeVertexBuffer(decoded.data(), vertexCount, stride, encoded.data(),
+                                                     encoded.size());
+    });
+    bool roundTrip = decodeOk && decoded == source;
+    ok &= roundTrip;
+    printf("vertex codec v0 %zu x %zu B: ratio %.2f  decode %6.2f GB/s  %s\n", vertexCount, stride,
+           static_cast<double>(encoded.size()) / source.size(), source.size() / (decodeMs * 1e6),
+           roundTrip ? "OK" : "FAIL");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,144 @@
+// 병렬 임포트 스케일링 벤치마크 (호스트 전용)
+// 크기가 제각각인 합성 프리미티브 무리에 VulkanModel::importPrimitive와 같은 CPU 단계
+// (정점 용접/캐시/오버드로/페치 최적화 -> 메시렛 분할 -> LOD 체인)를 ThreadPool로 나눠 적용하고,
+// 스레드 수별 소요 시간과 1스레드 대비 속도 향상을 출력합니다.
+// 결과는 스레드 수와 무관하게 같아야 하므로 프리미티브별 체크섬이 다르면 종료 코드 1을 반환합니다.
+//
+// 사용법: parallel_import_bench [--primitives N] [--max-threads N]
+
+#include "mesh_optimizer.h"
+#include "mesh_simplifier.h"
+#include "meshlet_builder.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+struct Primitive {
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+};
+
+// 물결 높이를 준 그리드 (LOD 단순화가 평면처럼 한 번에 무너지지 않도록), 삼각형 순서는 섞음
+Primitive makeWavyGrid(uint32_t size, uint32_t seed) {
+    Primitive primitive;
+    for (uint32_t y = 0; y <= size; y++) {
+        for (uint32_t x = 0; x <= size; x++) {
+            Vertex v{};
+            float fx = static_cast<float>(x);
+            float fy = static_cast<float>(y);
+            v.pos = glm::vec3(fx, fy, std::sin(fx * 0.3f + seed) * std::cos(fy * 0.2f) * 2.0f);
+            v.color = glm::vec3(1.0f);
+            v.texCoord = glm::vec2(fx / size, fy / size);
+            primitive.vertices.push_back(v);
+        }
+    }
+    std::vector<uint32_t> triangles;
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) {
+            uint32_t i = y * (size + 1) + x;
+            uint32_t quad[6] = { i, i + 1, i + size + 1, i + 1, i + size + 2, i + size + 1 };
+            triangles.insert(triangles.end(), quad, quad + 6);
+        }
+    }
+    std::vector<uint32_t> order(triangles.size() / 3);
+    std::iota(order.begin(), order.end(), 0u);
+    std::mt19937 rng(seed);
+    std::shuffle(order.begin(), order.end(), rng);
+    for (uint32_t t : order) {
+        primitive.indices.insert(primitive.indices.end(), &triangles[t * 3], &triangles[t * 3] + 3);
+    }
+    return primitive;
+}
+
+// importPrimitive의 정적 메시 경로와 같은 순서. 결과 체크섬 반환
+uint64_t importPrimitive(Primitive primitive) {
+    MeshOptimizer::optimize(primitive.vertices, primitive.indices);
+    std::vector<MeshletBuilder::Meshlet> meshlets = MeshletBuilder::build(primitive.vertices, primitive.indices);
+    MeshOptimizer::optimizeVertexFetch(primitive.vertices, primitive.indices);
+    std::vector<MeshSimplifier::LodLevel> lods = MeshSimplifier::buildLodChain(primitive.vertices, primitive.indices);
+
+    uint64_t hash = 1469598103934665603ull; // FNV-1a
+    auto mix = [&](uint64_t value) { hash = (hash ^ value) * 1099511628211ull; };
+    mix(primitive.vertices.size());
+    mix(meshlets.size());
+    for (uint32_t index : primitive.indices) mix(index);
+    for (const auto& level : lods) {
+        for (uint32_t index : level.indices) mix(index);
+    }
+    return hash;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    uint32_t primitiveCount = 48;
+    uint32_t maxThreads = std::max(8u, ThreadPool::getDefaultWorkerCount() + 1);
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--primitives") == 0 && hasValue) {
+            primitiveCount = std::max(1u, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else if (strcmp(argv[i], "--max-threads") == 0 && hasValue) {
+            maxThreads = std::max(1u, static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10)));
+        } else {
+            fprintf(stderr, "Usage: %s [--primitives N] [--max-threads N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // 1. 입력: 실제 모델처럼 큰 프리미티브 몇 개와 작은 프리미티브 여러 개 (그리드 한 변 16 ~ 192)
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::vector<Primitive> primitives;
+    size_t triangleCount = 0;
+    for (uint32_t i = 0; i < primitiveCount; i++) {
+        uint32_t size = 16 + static_cast<uint32_t>(176.0f * unit(rng) * unit(rng));
+        primitives.push_back(makeWavyGrid(size, i));
+        triangleCount += primitives.back().indices.size() / 3;
+    }
+    // VulkanModel::loadFromFile과 같이 큰 작업부터 분배
+    std::vector<size_t> jobs(primitives.size());
+    std::iota(jobs.begin(), jobs.end(), size_t{0});
+    std::stable_sort(jobs.begin(), jobs.end(), [&](size_t a, size_t b) {
+        return primitives[a].indices.size() > primitives[b].indices.size();
+    });
+    printf("primitives=%u triangles=%zu hardware threads=%u\n", primitiveCount, triangleCount,
+           ThreadPool::getDefaultWorkerCount() + 1);
+
+    // 2. 스레드 수를 1, 2, 4, ... maxThreads로 늘려 가며 측정
+    std::vector<uint32_t> threadCounts;
+    for (uint32_t threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    std::vector<uint64_t> expected;
+    double singleMs = 0.0;
+    bool failed = false;
+    for (uint32_t threads : threadCounts) {
+        ThreadPool pool(threads - 1);
+        std::vector<uint64_t> checksums(primitives.size());
+        auto start = std::chrono::steady_clock::now();
+        pool.parallelFor(jobs.size(), [&](size_t i) {
+            size_t job = jobs[i];
+            checksums[job] = importPrimitive(primitives[job]);
+        });
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+        if (expected.empty()) {
+            expected = checksums;
+            singleMs = ms;
+        }
+        bool same = checksums == expected;
+        failed |= !same;
+        printf("threads %2u  %9.1f ms  speedup x%.2f  %s\n", threads, ms, singleMs / ms,
+               same ? "OK" : "MISMATCH");
+    }
+    return failed ? 1 : 0;
+}
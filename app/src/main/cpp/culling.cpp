@@ -0,0 +1,45 @@
+#include "culling.h"
+
+namespace Culling {
+
+Frustum extractFrustum(const glm::mat4& matrix) {
+    // glm은 열 우선이므로 i번째 행 = (m[0][i], m[1][i], m[2][i], m[3][i])
+    auto row = [&](int i) {
+        return glm::vec4(matrix[0][i], matrix[1][i], matrix[2][i], matrix[3][i]);
+    };
+    glm::vec4 r0 = row(0);
+    glm::vec4 r1 = row(1);
+    glm::vec4 r2 = row(2);
+    glm::vec4 r3 = row(3);
+
+    Frustum frustum;
+    frustum.planes[0] = r3 + r0; // left   : -w <= x
+    frustum.planes[1] = r3 - r0; // right  :  x <= w
+    frustum.planes[2] = r3 + r1; // bottom : -w <= y
+    frustum.planes[3] = r3 - r1; // top    :  y <= w
+    frustum.planes[4] = r2;      // near   :  0 <= z (GLM_FORCE_DEPTH_ZERO_TO_ONE)
+    frustum.planes[5] = r3 - r2; // far    :  z <= w
+
+    for (auto& plane : frustum.planes) {
+        float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) plane /= length;
+    }
+    return frustum;
+}
+
+bool isSphereVisible(const Frustum& frustum, const glm::vec3& center, float radius) {
+    for (const auto& plane : frustum.planes) {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) return false;
+    }
+    return true;
+}
+
+bool isConeBackfacing(const glm::vec3& center, float radius, const glm::vec3& coneAxis, float coneCutoff,
+                      const glm::vec3& cameraPosition) {
+    // 카메라 -> 클러스터 방향이 콘 축과 충분히 같은 방향이면 모든 삼각형이 카메라를 등지고 있음
+    // (구 반경만큼 여유를 두어 클러스터 내 어느 위치에서 보더라도 보수적으로 판정)
+    glm::vec3 toCluster = center - cameraPosition;
+    return glm::dot(toCluster, coneAxis) >= coneCutoff * glm::length(toCluster) + radius;
+}
+
+} // namespace Culling
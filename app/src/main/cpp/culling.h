@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// CPU 가시성 판정 유틸리티 (프러스텀 + 법선 콘 백페이스)
+namespace Culling {
+    // 정규화된 평면 6개 (left, right, bottom, top, near, far), 평면 방정식 dot(n, p) + d >= 0 이 안쪽
+    struct Frustum {
+        glm::vec4 planes[6];
+    };
+
+    // clip = matrix * p 인 행렬(MVP)에서 평면을 추출 (깊이 0..1 규약)
+    // MVP를 넣으면 모델 공간 평면이 나오므로 바운딩 구를 변환하지 않고 바로 판정 가능
+    Frustum extractFrustum(const glm::mat4& matrix);
+
+    // 구가 프러스텀과 겹치면 true
+    bool isSphereVisible(const Frustum& frustum, const glm::vec3& center, float radius);
+
+    // 구를 감싸는 삼각형들의 법선 콘이 카메라에서 모두 뒷면이면 true
+    // coneCutoff = sin(콘 반각), 1.0이면 판정 불가(항상 false)
+    bool isConeBackfacing(const glm::vec3& center, float radius, const glm::vec3& coneAxis, float coneCutoff,
+                          const glm::vec3& cameraPosition);
+}
@@ -0,0 +1,1048 @@
+#include "gltf.h"
+#include "accessor_decoder.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace Gltf {
+namespace {
+// 필수 확장 중 렌더러가 처리하는 것 (그 외 extensionsRequired가 있으면 로드 실패)
+// KHR_mesh_quantization: 정수 속성은 AccessorDecoder가 float로 변환 (Compact 정점은 정수 위치 격자를 그대로 유지)
+// EXT_meshopt_compression: File::open이 압축된 bufferView를 MeshoptCodec으로 디코딩
+const char* const kSupportedExtensions[] = { "KHR_mesh_quantization", "EXT_meshopt_compression" };
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// 입력을 앞에서부터 한 번만 읽는 JSON 풀 파서
+// readObject/readArray는 키/원소마다 콜백을 부르고, 콜백은 값을 읽거나 skipValue로 건너뛰어야 함
+class JsonReader {
+public:
+    JsonReader(AssetUtils::ByteSpan json, Arena& arena)
+            : mBegin(reinterpret_cast<const char*>(json.data)), mCursor(mBegin), mEnd(mBegin + json.size),
+              mArena(arena) {
+    }
+
+    bool fail(const char* error) {
+        if (!mError) {
+            mError = error;
+            mErrorOffset = static_cast<size_t>(mCursor - mBegin);
+        }
+        return false;
+    }
+    std::string getError() const {
+        return std::string(mError ? mError : "unknown error") + " at byte " + std::to_string(mErrorOffset);
+    }
+
+    bool atEnd() {
+        skipWhitespace();
+        return mCursor == mEnd;
+    }
+
+    // onKey(std::string_view key) -> bool. key는 콜백 안에서만 유효
+    template <typename F>
+    bool readObject(F&& onKey) {
+        if (!consume('{')) return fail("expected '{'");
+        if (consume('}')) return true;
+        do {
+            std::string_view key;
+            if (!readKey(key)) return false;
+            if (!consume(':')) return fail("expected ':'");
+            if (!onKey(key)) return false;
+        } while (consume(','));
+        return consume('}') || fail("expected '}'");
+    }
+
+    // onElement() -> bool
+    template <typename F>
+    bool readArray(F&& onElement) {
+        if (!consume('[')) return fail("expected '['");
+        if (consume(']')) return true;
+        do {
+            if (!onElement()) return false;
+        } while (consume(','));
+        return consume(']') || fail("expected ']'");
+    }
+
+    bool readString(String& out) {
+        std::string_view raw;
+        bool escaped = false;
+        if (!scanString(raw, escaped)) return false;
+        // 이스케이프를 풀면 길이가 줄기만 하므로 원본 길이 + NUL만큼 할당
+        char* text = mArena.allocateArray<char>(raw.size() + 1);
+        size_t length = raw.size();
+        if (escaped) {
+            if (!unescape(raw, text, length)) return fail("invalid string escape");
+        } else {
+            std::memcpy(text, raw.data(), raw.size());
+        }
+        text[length] = '\0';
+        out.data = text;
+        out.length = static_cast<uint32_t>(length);
+        return true;
+    }
+
+    bool readNumber(double& out) {
+        skipWhitespace();
+        const char* start = mCursor;
+        while (mCursor < mEnd && isNumberChar(*mCursor)) mCursor++;
+        size_t length = static_cast<size_t>(mCursor - start);
+        if (length == 0) return fail("expected number");
+
+        // 정수 빠른 경로 (glTF 숫자의 대부분: 인덱스, 오프셋, 개수)
+        const char* digits = start + (*start == '-' ? 1 : 0);
+        size_t digitCount = static_cast<size_t>(mCursor - digits);
+        bool integer = std::all_of(digits, mCursor, [](char c) { return c >= '0' && c <= '9'; });
+        if (integer && digitCount > 0 && digitCount <= 15) {
+            int64_t value = 0;
+            for (const char* c = digits; c < mCursor; c++) value = value * 10 + (*c - '0');
+            out = static_cast<double>(digits != start ? -value : value);
+            return true;
+        }
+
+        // 소수/지수: 입력이 NUL 종료가 아니므로 잘라서 strtod
+        char buffer[64];
+        if (length >= sizeof(buffer)) return fail("number too long");
+        std::memcpy(buffer, start, length);
+        buffer[length] = '\0';
+        char* parsedEnd = nullptr;
+        out = std::strtod(buffer, &parsedEnd);
+        if (parsedEnd != buffer + length) return fail("invalid number");
+        return true;
+    }
+
+    bool readFloat(float& out) {
+        double value = 0.0;
+        if (!readNumber(value)) return false;
+        out = static_cast<float>(value);
+        return true;
+    }
+
+    // 0 이상의 정수 (2^53 이하)
+    bool readUnsigned(uint64_t& out) {
+        double value = 0.0;
+        if (!readNumber(value)) return false;
+        if (value < 0.0 || value > 9007199254740992.0 ||
+            value != static_cast<double>(static_cast<uint64_t>(value))) {
+            return fail("expected non-negative integer");
+        }
+        out = static_cast<uint64_t>(value);
+        return true;
+    }
+
+    // 배열/객체 인덱스 (0 ~ INT32_MAX)
+    bool readIndex(int32_t& out) {
+        uint64_t value = 0;
+        if (!readUnsigned(value)) return false;
+        if (value > static_cast<uint64_t>(INT32_MAX)) return fail("index out of range");
+        out = static_cast<int32_t>(value);
+        return true;
+    }
+
+    bool readBool(bool& out) {
+        skipWhitespace();
+        if (matchLiteral("true")) {
+            out = true;
+        } else if (matchLiteral("false")) {
+            out = false;
+        } else {
+            return fail("expected boolean");
+        }
+        return true;
+    }
+
+    // 값 하나를 구조만 따라가며 건너뜀 (문자열 안의 괄호는 무시, 재귀 없음)
+    bool skipValue() {
+        skipWhitespace();
+        int depth = 0;
+        while (mCursor < mEnd) {
+            char c = *mCursor;
+            if (c == '"') {
+                std::string_view raw;
+                bool escaped = false;
+                if (!scanString(raw, escaped)) return false;
+                if (depth == 0) return true;
+            } else if (c == '{' || c == '[') {
+                depth++;
+                mCursor++;
+            } else if (c == '}' || c == ']') {
+                if (depth == 0) return fail("unexpected closing bracket");
+                depth--;
+                mCursor++;
+                if (depth == 0) return true;
+            } else if (depth == 0) {
+                // 숫자/true/false/null
+                const char* start = mCursor;
+                while (mCursor < mEnd && *mCursor != ',' && *mCursor != '}' && *mCursor != ']' &&
+                       !isWhitespace(*mCursor)) {
+                    mCursor++;
+                }
+                return mCursor > start || fail("expected value");
+            } else {
+                mCursor++;
+            }
+        }
+        return fail("unexpected end of input");
+    }
+
+private:
+    const char* mBegin;
+    const char* mCursor;
+    const char* mEnd;
+    Arena& mArena;
+    const char* mError = nullptr;
+    size_t mErrorOffset = 0;
+    std::string mKeyBuffer; // 이스케이프가 있는 키 (드묾)
+
+    static bool isWhitespace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+    static bool isNumberChar(char c) {
+        return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+    }
+
+    void skipWhitespace() {
+        while (mCursor < mEnd && isWhitespace(*mCursor)) mCursor++;
+    }
+
+    bool consume(char c) {
+        skipWhitespace();
+        if (mCursor < mEnd && *mCursor == c) {
+            mCursor++;
+            return true;
+        }
+        return false;
+    }
+
+    bool matchLiteral(const char* literal) {
+        size_t length = std::strlen(literal);
+        if (static_cast<size_t>(mEnd - mCursor) < length || std::memcmp(mCursor, literal, length) != 0) return false;
+        mCursor += length;
+        return true;
+    }
+
+    // 따옴표 사이의 원본 바이트 (이스케이프 해제 전)
+    bool scanString(std::string_view& raw, bool& escaped) {
+        if (!consume('"')) return fail("expected string");
+        const char* start = mCursor;
+        escaped = false;
+        while (mCursor < mEnd && *mCursor != '"') {
+            if (*mCursor == '\\') {
+                escaped = true;
+                mCursor++; // 이스케이프된 문자(따옴표 포함)를 건너뜀
+            }
+            mCursor++;
+        }
+        if (mCursor >= mEnd) return fail("unterminated string");
+        raw = std::string_view(start, static_cast<size_t>(mCursor - start));
+        mCursor++;
+        return true;
+    }
+
+    bool readKey(std::string_view& key) {
+        bool escaped = false;
+        if (!scanString(key, escaped)) return false;
+        if (!escaped) return true;
+        mKeyBuffer.resize(key.size());
+        size_t length = 0;
+        if (!unescape(key, &mKeyBuffer[0], length)) return fail("invalid string escape");
+        key = std::string_view(mKeyBuffer.data(), length);
+        return true;
+    }
+
+    static bool readHex4(const char* p, const char* end, uint32_t& out) {
+        if (end - p < 4) return false;
+        out = 0;
+        for (int i = 0; i < 4; i++) {
+            int digit = hexValue(p[i]);
+            if (digit < 0) return false;
+            out = (out << 4) | static_cast<uint32_t>(digit);
+        }
+        return true;
+    }
+
+    // JSON 이스케이프 해제 (\uXXXX는 서로게이트 쌍까지 UTF-8로). out은 raw.size() 바이트 이상
+    static bool unescape(std::string_view raw, char* out, size_t& length) {
+        const char* p = raw.data();
+        const char* end = p + raw.size();
+        char* o = out;
+        while (p < end) {
+            if (*p != '\\') {
+                *o++ = *p++;
+                continue;
+            }
+            if (++p >= end) return false;
+            char c = *p++;
+            switch (c) {
+                case '"': case '\\': case '/': *o++ = c; break;
+                case 'b': *o++ = '\b'; break;
+                case 'f': *o++ = '\f'; break;
+                case 'n': *o++ = '\n'; break;
+                case 'r': *o++ = '\r'; break;
+                case 't': *o++ = '\t'; break;
+                case 'u': {
+                    uint32_t code = 0;
+                    if (!readHex4(p, end, code)) return false;
+                    p += 4;
+                    if (code >= 0xD800 && code <= 0xDBFF) {
+                        uint32_t low = 0;
+                        if (end - p < 6 || p[0] != '\\' || p[1] != 'u' || !readHex4(p + 2, end, low) ||
+                            low < 0xDC00 || low > 0xDFFF) {
+                            return false;
+                        }
+                        p += 6;
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    // \uXXXX(6바이트)는 UTF-8로 최대 3바이트, 서로게이트 쌍(12바이트)은 4바이트이므로 out을 넘지 않음
+                    if (code < 0x80) {
+                        *o++ = static_cast<char>(code);
+                    } else if (code < 0x800) {
+                        *o++ = static_cast<char>(0xC0 | (code >> 6));
+                        *o++ = static_cast<char>(0x80 | (code & 0x3F));
+                    } else if (code < 0x10000) {
+                        *o++ = static_cast<char>(0xE0 | (code >> 12));
+                        *o++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        *o++ = static_cast<char>(0x80 | (code & 0x3F));
+                    } else {
+                        *o++ = static_cast<char>(0xF0 | (code >> 18));
+                        *o++ = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                        *o++ = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        *o++ = static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        length = static_cast<size_t>(o - out);
+        return true;
+    }
+};
+
+// 원소를 임시 vector에 모은 뒤 arena로 한 번에 복사 (원소 수를 미리 알 수 없으므로)
+template <typename T, typename F>
+bool readArrayInto(JsonReader& reader, Arena& arena, Span<T>& out, F&& readElement) {
+    std::vector<T> items;
+    bool ok = reader.readArray([&]() {
+        items.emplace_back();
+        return readElement(items.back());
+    });
+    if (!ok) return false;
+    out.data = arena.copyArray(items.data(), items.size());
+    out.count = static_cast<uint32_t>(items.size());
+    return true;
+}
+
+bool readIndices(JsonReader& reader, Arena& arena, Span<int32_t>& out) {
+    return readArrayInto(reader, arena, out, [&](int32_t& value) { return reader.readIndex(value); });
+}
+
+bool readFloats(JsonReader& reader, Arena& arena, Span<float>& out) {
+    return readArrayInto(reader, arena, out, [&](float& value) { return reader.readFloat(value); });
+}
+
+// 정확히 count개의 숫자 (matrix/translation/rotation/scale/baseColorFactor)
+bool readFixedFloats(JsonReader& reader, float* out, size_t count) {
+    size_t read = 0;
+    bool ok = reader.readArray([&]() {
+        if (read >= count) return reader.fail("too many array elements");
+        return reader.readFloat(out[read++]);
+    });
+    return ok && (read == count || reader.fail("too few array elements"));
+}
+
+bool readAccessorType(JsonReader& reader, AccessorType& out) {
+    String type;
+    if (!reader.readString(type)) return false;
+    static const struct { const char* name; AccessorType type; } kTypes[] = {
+        { "SCALAR", AccessorType::Scalar }, { "VEC2", AccessorType::Vec2 }, { "VEC3", AccessorType::Vec3 },
+        { "VEC4", AccessorType::Vec4 }, { "MAT2", AccessorType::Mat2 }, { "MAT3", AccessorType::Mat3 },
+        { "MAT4", AccessorType::Mat4 },
+    };
+    for (const auto& entry : kTypes) {
+        if (std::string_view(type) == entry.name) {
+            out = entry.type;
+            return true;
+        }
+    }
+    return reader.fail("unknown accessor type");
+}
+
+// EXT_meshopt_compression의 mode/filter 문자열
+bool readMeshoptMode(JsonReader& reader, MeshoptCodec::Mode& out) {
+    String mode;
+    if (!reader.readString(mode)) return false;
+    static const struct { const char* name; MeshoptCodec::Mode mode; } kModes[] = {
+        { "ATTRIBUTES", MeshoptCodec::Mode::Attributes }, { "TRIANGLES", MeshoptCodec::Mode::Triangles },
+        { "INDICES", MeshoptCodec::Mode::Indices },
+    };
+    for (const auto& entry : kModes) {
+        if (std::string_view(mode) == entry.name) {
+            out = entry.mode;
+            return true;
+        }
+    }
+    return reader.fail("unknown meshopt compression mode");
+}
+
+bool readMeshoptFilter(JsonReader& reader, MeshoptCodec::Filter& out) {
+    String filter;
+    if (!reader.readString(filter)) return false;
+    static const struct { const char* name; MeshoptCodec::Filter filter; } kFilters[] = {
+        { "NONE", MeshoptCodec::Filter::None }, { "OCTAHEDRAL", MeshoptCodec::Filter::Octahedral },
+        { "QUATERNION", MeshoptCodec::Filter::Quaternion }, { "EXPONENTIAL", MeshoptCodec::Filter::Exponential },
+    };
+    for (const auto& entry : kFilters) {
+        if (std::string_view(filter) == entry.name) {
+            out = entry.filter;
+            return true;
+        }
+    }
+    return reader.fail("unknown meshopt compression filter");
+}
+
+bool readBufferView(JsonReader& reader, BufferView& view) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "buffer") return reader.readIndex(view.buffer);
+        if (key == "byteOffset") return reader.readUnsigned(view.byteOffset);
+        if (key == "byteLength") return reader.readUnsigned(view.byteLength);
+        if (key == "byteStride") {
+            int32_t stride = 0;
+            if (!reader.readIndex(stride)) return false;
+            view.byteStride = static_cast<uint32_t>(stride);
+            return true;
+        }
+        if (key == "extensions") {
+            return reader.readObject([&](std::string_view extension) {
+                if (extension != "EXT_meshopt_compression") return reader.skipValue();
+                auto& meshopt = view.meshopt;
+                meshopt.compressed = true;
+                return reader.readObject([&](std::string_view meshoptKey) {
+                    if (meshoptKey == "buffer") return reader.readIndex(meshopt.buffer);
+                    if (meshoptKey == "byteOffset") return reader.readUnsigned(meshopt.byteOffset);
+                    if (meshoptKey == "byteLength") return reader.readUnsigned(meshopt.byteLength);
+                    if (meshoptKey == "byteStride") {
+                        int32_t stride = 0;
+                        if (!reader.readIndex(stride)) return false;
+                        meshopt.byteStride = static_cast<uint32_t>(stride);
+                        return true;
+                    }
+                    if (meshoptKey == "count") return reader.readUnsigned(meshopt.count);
+                    if (meshoptKey == "mode") return readMeshoptMode(reader, meshopt.mode);
+                    if (meshoptKey == "filter") return readMeshoptFilter(reader, meshopt.filter);
+                    return reader.skipValue();
+                });
+            });
+        }
+        return reader.skipValue();
+    });
+}
+
+bool readAccessor(JsonReader& reader, Accessor& accessor) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "bufferView") return reader.readIndex(accessor.bufferView);
+        if (key == "byteOffset") return reader.readUnsigned(accessor.byteOffset);
+        if (key == "componentType") return reader.readIndex(accessor.componentType);
+        if (key == "normalized") return reader.readBool(accessor.normalized);
+        if (key == "count") return reader.readUnsigned(accessor.count);
+        if (key == "type") return readAccessorType(reader, accessor.type);
+        if (key == "sparse") {
+            accessor.sparse.isSparse = true;
+            return reader.readObject([&](std::string_view sparseKey) {
+                if (sparseKey == "count") {
+                    uint64_t count = 0;
+                    if (!reader.readUnsigned(count)) return false;
+                    accessor.sparse.count = static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX));
+                    return true;
+                }
+                if (sparseKey == "indices") {
+                    return reader.readObject([&](std::string_view indicesKey) {
+                        if (indicesKey == "bufferView") return reader.readIndex(accessor.sparse.indices.bufferView);
+                        if (indicesKey == "byteOffset") return reader.readUnsigned(accessor.sparse.indices.byteOffset);
+                        if (indicesKey == "componentType") {
+                            return reader.readIndex(accessor.sparse.indices.componentType);
+                        }
+                        return reader.skipValue();
+                    });
+                }
+                if (sparseKey == "values") {
+                    return reader.readObject([&](std::string_view valuesKey) {
+                        if (valuesKey == "bufferView") return reader.readIndex(accessor.sparse.values.bufferView);
+                        if (valuesKey == "byteOffset") return reader.readUnsigned(accessor.sparse.values.byteOffset);
+                        return reader.skipValue();
+                    });
+                }
+                return reader.skipValue();
+            });
+        }
+        return reader.skipValue(); // min/max/name/extras
+    });
+}
+
+bool readPrimitive(JsonReader& reader, Arena& arena, Primitive& primitive) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "attributes") {
+            Attributes& attributes = primitive.attributes;
+            return reader.readObject([&](std::string_view semantic) {
+                if (semantic == "POSITION") return reader.readIndex(attributes.position);
+                if (semantic == "COLOR_0") return reader.readIndex(attributes.color0);
+                if (semantic == "TEXCOORD_0") return reader.readIndex(attributes.texcoord0);
+                if (semantic == "JOINTS_0") return reader.readIndex(attributes.joints0);
+                if (semantic == "WEIGHTS_0") return reader.readIndex(attributes.weights0);
+                return reader.skipValue(); // NORMAL/TANGENT 등 (Vertex에 없음)
+            });
+        }
+        if (key == "indices") return reader.readIndex(primitive.indices);
+        if (key == "material") return reader.readIndex(primitive.material);
+        if (key == "targets") {
+            return readArrayInto(reader, arena, primitive.targetPositions, [&](int32_t& position) {
+                position = -1;
+                return reader.readObject([&](std::string_view semantic) {
+                    if (semantic == "POSITION") return reader.readIndex(position);
+                    return reader.skipValue();
+                });
+            });
+        }
+        return reader.skipValue();
+    });
+}
+
+bool readMesh(JsonReader& reader, Arena& arena, Mesh& mesh) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "primitives") {
+            return readArrayInto(reader, arena, mesh.primitives, [&](Primitive& primitive) {
+                return readPrimitive(reader, arena, primitive);
+            });
+        }
+        if (key == "weights") return readFloats(reader, arena, mesh.weights);
+        return reader.skipValue();
+    });
+}
+
+bool readNode(JsonReader& reader, Arena& arena, Node& node) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "mesh") return reader.readIndex(node.mesh);
+        if (key == "skin") return reader.readIndex(node.skin);
+        if (key == "children") return readIndices(reader, arena, node.children);
+        if (key == "weights") return readFloats(reader, arena, node.weights);
+        if (key == "matrix") {
+            node.hasMatrix = true;
+            return readFixedFloats(reader, node.matrix, 16);
+        }
+        if (key == "translation") return readFixedFloats(reader, node.translation, 3);
+        if (key == "rotation") return readFixedFloats(reader, node.rotation, 4);
+        if (key == "scale") return readFixedFloats(reader, node.scale, 3);
+        return reader.skipValue(); // name/camera/extras
+    });
+}
+
+bool readAnimation(JsonReader& reader, Arena& arena, Animation& animation) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "name") return reader.readString(animation.name);
+        if (key == "channels") {
+            return readArrayInto(reader, arena, animation.channels, [&](AnimationChannel& channel) {
+                return reader.readObject([&](std::string_view channelKey) {
+                    if (channelKey == "sampler") return reader.readIndex(channel.sampler);
+                    if (channelKey != "target") return reader.skipValue();
+                    return reader.readObject([&](std::string_view targetKey) {
+                        if (targetKey == "node") return reader.readIndex(channel.targetNode);
+                        if (targetKey != "path") return reader.skipValue();
+                        String path;
+                        if (!reader.readString(path)) return false;
+                        std::string_view value = path;
+                        channel.targetPath = value == "translation" ? TargetPath::Translation
+                                           : value == "rotation" ? TargetPath::Rotation
+                                           : value == "scale" ? TargetPath::Scale
+                                           : value == "weights" ? TargetPath::Weights : TargetPath::Unsupported;
+                        return true;
+                    });
+                });
+            });
+        }
+        if (key == "samplers") {
+            return readArrayInto(reader, arena, animation.samplers, [&](AnimationSampler& sampler) {
+                return reader.readObject([&](std::string_view samplerKey) {
+                    if (samplerKey == "input") return reader.readIndex(sampler.input);
+                    if (samplerKey == "output") return reader.readIndex(sampler.output);
+                    if (samplerKey != "interpolation") return reader.skipValue();
+                    String interpolation;
+                    if (!reader.readString(interpolation)) return false;
+                    std::string_view value = interpolation;
+                    sampler.interpolation = value == "STEP" ? Interpolation::Step
+                                          : value == "CUBICSPLINE" ? Interpolation::CubicSpline
+                                          : Interpolation::Linear;
+                    return true;
+                });
+            });
+        }
+        return reader.skipValue();
+    });
+}
+
+bool readMaterial(JsonReader& reader, Material& material) {
+    return reader.readObject([&](std::string_view key) {
+        if (key != "pbrMetallicRoughness") return reader.skipValue();
+        return reader.readObject([&](std::string_view pbrKey) {
+            if (pbrKey == "baseColorFactor") return readFixedFloats(reader, material.baseColorFactor, 4);
+            if (pbrKey != "baseColorTexture") return reader.skipValue();
+            return reader.readObject([&](std::string_view textureKey) {
+                if (textureKey == "index") return reader.readIndex(material.baseColorTexture);
+                return reader.skipValue();
+            });
+        });
+    });
+}
+
+bool readDocument(JsonReader& reader, Arena& arena, Document& document) {
+    return reader.readObject([&](std::string_view key) {
+        if (key == "scene") return reader.readIndex(document.defaultScene);
+        if (key == "scenes") {
+            return readArrayInto(reader, arena, document.scenes, [&](Scene& scene) {
+                return reader.readObject([&](std::string_view sceneKey) {
+                    if (sceneKey == "nodes") return readIndices(reader, arena, scene.nodes);
+                    return reader.skipValue();
+                });
+            });
+        }
+        if (key == "nodes") {
+            return readArrayInto(reader, arena, document.nodes, [&](Node& node) {
+                return readNode(reader, arena, node);
+            });
+        }
+        if (key == "meshes") {
+            return readArrayInto(reader, arena, document.meshes, [&](Mesh& mesh) {
+                return readMesh(reader, arena, mesh);
+            });
+        }
+        if (key == "accessors") {
+            return readArrayInto(reader, arena, document.accessors, [&](Accessor& accessor) {
+                return readAccessor(reader, accessor);
+            });
+        }
+        if (key == "bufferViews") {
+            return readArrayInto(reader, arena, document.bufferViews, [&](BufferView& view) {
+                return readBufferView(reader, view);
+            });
+        }
+        if (key == "buffers") {
+            return readArrayInto(reader, arena, document.buffers, [&](Buffer& buffer) {
+                return reader.readObject([&](std::string_view bufferKey) {
+                    if (bufferKey == "uri") return reader.readString(buffer.uri);
+                    if (bufferKey == "byteLength") return reader.readUnsigned(buffer.byteLength);
+                    if (bufferKey == "extensions") {
+                        return reader.readObject([&](std::string_view extension) {
+                            if (extension != "EXT_meshopt_compression") return reader.skipValue();
+                            return reader.readObject([&](std::string_view meshoptKey) {
+                                if (meshoptKey == "fallback") return reader.readBool(buffer.fallback);
+                                return reader.skipValue();
+                            });
+                        });
+                    }
+                    return reader.skipValue();
+                });
+            });
+        }
+        if (key == "images") {
+            return readArrayInto(reader, arena, document.images, [&](Image& image) {
+                return reader.readObject([&](std::string_view imageKey) {
+                    if (imageKey == "name") return reader.readString(image.name);
+                    if (imageKey == "uri") return reader.readString(image.uri);
+                    if (imageKey == "bufferView") return reader.readIndex(image.bufferView);
+                    return reader.skipValue();
+                });
+            });
+        }
+        if (key == "textures") {
+            return readArrayInto(reader, arena, document.textures, [&](Texture& texture) {
+                return reader.readObject([&](std::string_view textureKey) {
+                    if (textureKey == "source") return reader.readIndex(texture.source);
+                    return reader.skipValue();
+                });
+            });
+        }
+        if (key == "materials") {
+            return readArrayInto(reader, arena, document.materials, [&](Material& material) {
+                return readMaterial(reader, material);
+            });
+        }
+        if (key == "skins") {
+            return readArrayInto(reader, arena, document.skins, [&](Skin& skin) {
+                return reader.readObject([&](std::string_view skinKey) {
+                    if (skinKey == "name") return reader.readString(skin.name);
+                    if (skinKey == "inverseBindMatrices") return reader.readIndex(skin.inverseBindMatrices);
+                    if (skinKey == "joints") return readIndices(reader, arena, skin.joints);
+                    return reader.skipValue();
+                });
+            });
+        }
+        if (key == "animations") {
+            return readArrayInto(reader, arena, document.animations, [&](Animation& animation) {
+                return readAnimation(reader, arena, animation);
+            });
+        }
+        if (key == "extensionsRequired") {
+            return readArrayInto(reader, arena, document.extensionsRequired, [&](String& extension) {
+                return reader.readString(extension);
+            });
+        }
+        return reader.skipValue(); // asset/cameras/samplers/extensionsUsed/extras
+    });
+}
+
+// 인덱스 참조 검사 (optional이면 -1 허용)
+bool isValidIndex(int32_t index, size_t count, bool optional) {
+    return (optional && index == -1) || (index >= 0 && static_cast<size_t>(index) < count);
+}
+
+bool validate(const Document& document, std::string& error) {
+    auto fail = [&](const char* what, size_t index) {
+        error = std::string(what) + " " + std::to_string(index) + ": reference out of range";
+        return false;
+    };
+    const size_t accessorCount = document.accessors.size();
+    const size_t viewCount = document.bufferViews.size();
+    const size_t nodeCount = document.nodes.size();
+
+    for (size_t i = 0; i < viewCount; i++) {
+        const BufferView& view = document.bufferViews[i];
+        if (!isValidIndex(view.buffer, document.buffers.size(), false) ||
+            (view.meshopt.compressed && !isValidIndex(view.meshopt.buffer, document.buffers.size(), false))) {
+            return fail("bufferView", i);
+        }
+    }
+    for (size_t i = 0; i < accessorCount; i++) {
+        const Accessor& accessor = document.accessors[i];
+        bool sparseValid = !accessor.sparse.isSparse ||
+                           (isValidIndex(accessor.sparse.indices.bufferView, viewCount, false) &&
+                            isValidIndex(accessor.sparse.values.bufferView, viewCount, false));
+        if (!isValidIndex(accessor.bufferView, viewCount, true) || !sparseValid ||
+            AccessorDecoder::getComponentSize(accessor.componentType) == 0) {
+            return fail("accessor", i);
+        }
+    }
+    for (size_t i = 0; i < document.meshes.size(); i++) {
+        for (const Primitive& primitive : document.meshes[i].primitives) {
+            const Attributes& attributes = primitive.attributes;
+            bool valid = isValidIndex(attributes.position, accessorCount, true) &&
+                         isValidIndex(attributes.color0, accessorCount, true) &&
+                         isValidIndex(attributes.texcoord0, accessorCount, true) &&
+                         isValidIndex(attributes.joints0, accessorCount, true) &&
+                         isValidIndex(attributes.weights0, accessorCount, true) &&
+                         isValidIndex(primitive.indices, accessorCount, true) &&
+                         isValidIndex(primitive.material, document.materials.size(), true);
+            for (int32_t target : primitive.targetPositions) valid &= isValidIndex(target, accessorCount, true);
+            if (!valid) return fail("mesh", i);
+        }
+    }
+    for (size_t i = 0; i < nodeCount; i++) {
+        const Node& node = document.nodes[i];
+        bool valid = isValidIndex(node.mesh, document.meshes.size(), true) &&
+                     isValidIndex(node.skin, document.skins.size(), true);
+        for (int32_t child : node.children) valid &= isValidIndex(child, nodeCount, false);
+        if (!valid) return fail("node", i);
+    }
+    if (!isValidIndex(document.defaultScene, document.scenes.size(), true)) return fail("scene", 0);
+    for (size_t i = 0; i < document.scenes.size(); i++) {
+        for (int32_t node : document.scenes[i].nodes) {
+            if (!isValidIndex(node, nodeCount, false)) return fail("scene", i);
+        }
+    }
+    for (size_t i = 0; i < document.skins.size(); i++) {
+        const Skin& skin = document.skins[i];
+        bool valid = isValidIndex(skin.inverseBindMatrices, accessorCount, true);
+        for (int32_t joint : skin.joints) valid &= isValidIndex(joint, nodeCount, false);
+        if (!valid) return fail("skin", i);
+    }
+    for (size_t i = 0; i < document.animations.size(); i++) {
+        const Animation& animation = document.animations[i];
+        bool valid = true;
+        for (const AnimationChannel& channel : animation.channels) {
+            valid &= isValidIndex(channel.sampler, animation.samplers.size(), false) &&
+                     isValidIndex(channel.targetNode, nodeCount, true);
+        }
+        for (const AnimationSampler& sampler : animation.samplers) {
+            valid &= isValidIndex(sampler.input, accessorCount, false) &&
+                     isValidIndex(sampler.output, accessorCount, false);
+        }
+        if (!valid) return fail("animation", i);
+    }
+    for (size_t i = 0; i < document.images.size(); i++) {
+        if (!isValidIndex(document.images[i].bufferView, viewCount, true)) return fail("image", i);
+    }
+    for (size_t i = 0; i < document.textures.size(); i++) {
+        if (!isValidIndex(document.textures[i].source, document.images.size(), true)) return fail("texture", i);
+    }
+    for (size_t i = 0; i < document.materials.size(); i++) {
+        if (!isValidIndex(document.materials[i].baseColorTexture, document.textures.size(), true)) {
+            return fail("material", i);
+        }
+    }
+    for (const String& extension : document.extensionsRequired) {
+        bool supported = std::any_of(std::begin(kSupportedExtensions), std::end(kSupportedExtensions),
+                                     [&](const char* name) { return std::string_view(extension) == name; });
+        if (!supported) {
+            error = std::string("unsupported required extension ") + extension.c_str();
+            return false;
+        }
+    }
+    return true;
+}
+
+// [offset, offset + count)가 [0, size) 안에 있는지 (오버플로 없이)
+bool inRange(uint64_t offset, uint64_t count, uint64_t size) {
+    return offset <= size && count <= size - offset;
+}
+
+int base64Value(char c) {
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+// base64 -> 바이트 (끝의 '=' 패딩 허용)
+bool decodeBase64(std::string_view text, Arena& arena, AssetUtils::ByteSpan& out) {
+    while (!text.empty() && text.back() == '=') text.remove_suffix(1);
+    if (text.size() % 4 == 1) return false;
+    size_t size = text.size() / 4 * 3 + (text.size() % 4 == 0 ? 0 : text.size() % 4 - 1);
+    uint8_t* data = arena.allocateArray<uint8_t>(size);
+    uint32_t bits = 0;
+    int bitCount = 0;
+    size_t written = 0;
+    for (char c : text) {
+        int value = base64Value(c);
+        if (value < 0) return false;
+        bits = (bits << 6) | static_cast<uint32_t>(value);
+        bitCount += 6;
+        if (bitCount >= 8) {
+            bitCount -= 8;
+            data[written++] = static_cast<uint8_t>(bits >> bitCount);
+        }
+    }
+    out = { data, written };
+    return written == size;
+}
+
+// URI의 %XX 인코딩 해제 (파일 이름의 공백 등)
+std::string decodePercent(std::string_view uri) {
+    std::string path;
+    path.reserve(uri.size());
+    for (size_t i = 0; i < uri.size(); i++) {
+        int high = uri[i] == '%' && i + 2 < uri.size() ? hexValue(uri[i + 1]) : -1;
+        int low = high >= 0 ? hexValue(uri[i + 2]) : -1;
+        if (low >= 0) {
+            path.push_back(static_cast<char>(high * 16 + low));
+            i += 2;
+        } else {
+            path.push_back(uri[i]);
+        }
+    }
+    return path;
+}
+} // namespace
+
+uint32_t getComponentCount(AccessorType type) {
+    switch (type) {
+        case AccessorType::Scalar: return 1;
+        case AccessorType::Vec2: return 2;
+        case AccessorType::Vec3: return 3;
+        case AccessorType::Vec4: return 4;
+        case AccessorType::Mat2: return 4;
+        case AccessorType::Mat3: return 9;
+        case AccessorType::Mat4: return 16;
+    }
+    return 0;
+}
+
+size_t getByteStride(const Accessor& accessor, const BufferView& view) {
+    size_t componentSize = AccessorDecoder::getComponentSize(accessor.componentType);
+    if (componentSize == 0) return 0;
+    return view.byteStride > 0 ? view.byteStride : componentSize * getComponentCount(accessor.type);
+}
+
+bool parse(AssetUtils::ByteSpan json, Arena& arena, Document& out, std::string& error) {
+    out = Document{};
+    JsonReader reader(json, arena);
+    if (!readDocument(reader, arena, out) || (!reader.atEnd() && !reader.fail("trailing characters"))) {
+        error = reader.getError();
+        return false;
+    }
+    return validate(out, error);
+}
+
+bool File::resolveUri(AAssetManager* assetManager, const std::string& baseDir, const String& uri,
+                      AssetUtils::ByteSpan& out) {
+    std::string_view text = uri;
+    // 1. data URI: "data:[mime];base64,<데이터>"
+    if (text.compare(0, 5, "data:") == 0) {
+        size_t comma = text.find(',');
+        if (comma == std::string_view::npos || text.substr(0, comma).find(";base64") == std::string_view::npos) {
+            return false;
+        }
+        return decodeBase64(text.substr(comma + 1), mArena, out);
+    }
+    // 2. 원격 URI는 지원하지 않음
+    if (text.find("://") != std::string_view::npos) return false;
+
+    // 3. 파일 기준 상대 경로 (에셋 경로)
+    auto mapping = std::make_unique<AssetUtils::MappedAsset>();
+    if (!mapping->open(assetManager, baseDir + decodePercent(text))) return false;
+    out = mapping->getBytes();
+    mMappings.push_back(std::move(mapping));
+    return true;
+}
+
+bool File::open(AAssetManager* assetManager, const std::string& filename) {
+    mArena.reset();
+    mDocument = Document{};
+    mMappings.clear();
+    mBuffers.clear();
+    mImages.clear();
+
+    // 1. 파일 매핑. GLB면 JSON/BIN 청크로 나눔
+    auto mapping = std::make_unique<AssetUtils::MappedAsset>();
+    if (!mapping->open(assetManager, filename)) return false;
+    AssetUtils::ByteSpan json = mapping->getBytes();
+    mMappings.push_back(std::move(mapping));
+    AssetUtils::GlbChunks glb;
+    mBinary = AssetUtils::isGlb(json);
+    if (mBinary) {
+        if (!AssetUtils::parseGlb(json, glb)) {
+            LOGE("Invalid GLB container: %s", filename.c_str());
+            return false;
+        }
+        json = glb.json;
+    }
+
+    // 2. JSON -> Document
+    std::string error;
+    if (!parse(json, mArena, mDocument, error)) {
+        LOGE("Failed to parse glTF %s: %s", filename.c_str(), error.c_str());
+        return false;
+    }
+
+    // 3. 버퍼: uri가 없는 0번 버퍼는 GLB의 BIN 청크, 나머지는 파일 기준 상대 경로 또는 data URI
+    //    meshopt 대체 버퍼는 압축된 bufferView만 참조하므로 uri가 있어도 읽지 않음
+    size_t slash = filename.find_last_of('/');
+    std::string baseDir = slash == std::string::npos ? std::string() : filename.substr(0, slash + 1);
+    mBuffers.resize(mDocument.buffers.size());
+    for (size_t i = 0; i < mDocument.buffers.size(); i++) {
+        const Buffer& buffer = mDocument.buffers[i];
+        if (buffer.fallback) continue;
+        if (buffer.uri.empty()) {
+            if (!mBinary || i != 0) {
+                LOGE("glTF buffer %zu has no uri: %s", i, filename.c_str());
+                return false;
+            }
+            mBuffers[i] = glb.bin;
+        } else if (!resolveUri(assetManager, baseDir, buffer.uri, mBuffers[i])) {
+            LOGE("Failed to load glTF buffer %zu (%s)", i, buffer.uri.c_str());
+            return false;
+        }
+        if (mBuffers[i].size < buffer.byteLength) {
+            LOGE("glTF buffer %zu is shorter than its byteLength", i);
+            return false;
+        }
+    }
+    for (size_t i = 0; i < mDocument.bufferViews.size(); i++) {
+        // 압축된 bufferView는 압축 데이터의 범위만 검사 (디코딩 결과는 byteLength만큼 새로 할당)
+        const BufferView& view = mDocument.bufferViews[i];
+        bool valid = view.meshopt.compressed
+                         ? inRange(view.meshopt.byteOffset, view.meshopt.byteLength, mBuffers[view.meshopt.buffer].size)
+                         : inRange(view.byteOffset, view.byteLength, mBuffers[view.buffer].size);
+        if (!valid) {
+            LOGE("glTF bufferView %zu is out of its buffer range", i);
+            return false;
+        }
+    }
+    if (!decodeCompressedViews()) return false;
+
+    // 4. 이미지: bufferView는 버퍼 범위, 외부 파일은 매핑 (읽지 못한 이미지는 디코딩 단계에서 건너뜀)
+    mImages.resize(mDocument.images.size());
+    for (size_t i = 0; i < mDocument.images.size(); i++) {
+        const Image& image = mDocument.images[i];
+        if (image.bufferView >= 0) {
+            const BufferView& view = mDocument.bufferViews[image.bufferView];
+            mImages[i] = { mBuffers[view.buffer].data + view.byteOffset, static_cast<size_t>(view.byteLength) };
+        } else if (image.uri.empty() || !resolveUri(assetManager, baseDir, image.uri, mImages[i])) {
+            LOGW("Failed to load glTF image %zu (%s)", i, image.uri.c_str());
+            mImages[i] = {};
+        }
+    }
+    return true;
+}
+
+bool File::decodeCompressedViews() {
+    // 1. 디코딩 결과 크기 (bufferView마다 16바이트 정렬, 압축된 데이터가 없으면 아무것도 하지 않음)
+    const size_t viewCount = mDocument.bufferViews.size();
+    auto alignedLength = [](uint64_t length) { return (length + 15) & ~uint64_t(15); };
+    uint64_t totalBytes = 0;
+    size_t compressedCount = 0;
+    uint64_t compressedBytes = 0;
+    for (size_t i = 0; i < viewCount; i++) {
+        const BufferView& view = mDocument.bufferViews[i];
+        if (!view.meshopt.compressed) continue;
+        const auto& meshopt = view.meshopt;
+        if (meshopt.byteStride == 0 || meshopt.count > view.byteLength / meshopt.byteStride) {
+            LOGE("glTF bufferView %zu: meshopt count * byteStride exceeds byteLength", i);
+            return false;
+        }
+        totalBytes += alignedLength(view.byteLength);
+        compressedBytes += meshopt.byteLength;
+        compressedCount++;
+    }
+    if (compressedCount == 0) return true;
+    if (totalBytes > SIZE_MAX / 2) {
+        LOGE("glTF meshopt-compressed data is too large (%llu bytes)", static_cast<unsigned long long>(totalBytes));
+        return false;
+    }
+
+    // 2. bufferView/버퍼 표를 arena에 복사하고, 디코딩 결과를 담을 버퍼 하나를 끝에 추가
+    BufferView* views = mArena.copyArray(mDocument.bufferViews.data, viewCount);
+    const size_t bufferCount = mDocument.buffers.size();
+    Buffer* buffers = mArena.allocateArray<Buffer>(bufferCount + 1);
+    std::copy(mDocument.buffers.begin(), mDocument.buffers.end(), buffers);
+    buffers[bufferCount].byteLength = totalBytes;
+    uint8_t* decoded = static_cast<uint8_t*>(mArena.allocate(static_cast<size_t>(totalBytes), 16));
+
+    // 3. 디코딩 (count * byteStride 뒤의 남는 공간은 0)
+    uint64_t offset = 0;
+    for (size_t i = 0; i < viewCount; i++) {
+        BufferView& view = views[i];
+        if (!view.meshopt.compressed) continue;
+        const auto& meshopt = view.meshopt;
+        const AssetUtils::ByteSpan& source = mBuffers[meshopt.buffer];
+        uint8_t* out = decoded + offset;
+        size_t decodedLength = static_cast<size_t>(meshopt.count * meshopt.byteStride);
+        if (!MeshoptCodec::decode(out, static_cast<size_t>(meshopt.count), meshopt.byteStride, meshopt.mode,
+                                  meshopt.filter, source.data + meshopt.byteOffset,
+                                  static_cast<size_t>(meshopt.byteLength))) {
+            LOGE("Failed to decode EXT_meshopt_compression bufferView %zu", i);
+            return false;
+        }
+        std::memset(out + decodedLength, 0, static_cast<size_t>(alignedLength(view.byteLength)) - decodedLength);
+        view.buffer = static_cast<int32_t>(bufferCount);
+        view.byteOffset = offset;
+        offset += alignedLength(view.byteLength);
+    }
+
+    mDocument.bufferViews.data = views;
+    mDocument.buffers.data = buffers;
+    mDocument.buffers.count = static_cast<uint32_t>(bufferCount + 1);
+    mBuffers.push_back({ decoded, static_cast<size_t>(totalBytes) });
+    LOGI("Decoded %zu meshopt-compressed bufferViews: %llu -> %llu bytes", compressedCount,
+         static_cast<unsigned long long>(compressedBytes), static_cast<unsigned long long>(totalBytes));
+    return true;
+}
+
+AssetUtils::ByteSpan File::getImageBytes(size_t image) const {
+    return image < mImages.size() ? mImages[image] : AssetUtils::ByteSpan{};
+}
+} // namespace Gltf
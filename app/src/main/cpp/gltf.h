@@ -0,0 +1,233 @@
+#pragma once
+
+#include "arena.h"
+#include "asset_utils.h"
+#include "meshopt_codec.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// glTF 2.0 프런트엔드: JSON을 DOM 없이 한 번 훑으면서(풀 파서) 렌더러가 쓰는 필드만 Document에 채움
+// - 문서의 배열/문자열은 모두 Arena에 할당되고 File이 해제될 때 한 번에 사라짐
+// - 쓰지 않는 속성(NORMAL/TANGENT, 카메라, 샘플러, extras 등)과 모르는 키는 값을 건너뛰기만 함
+// - 인덱스 참조(노드 -> 메시, 접근자 -> bufferView 등)는 파싱 직후 한 번 범위 검사하므로 사용하는 쪽은 다시 검사하지 않음
+//   (접근자 데이터가 버퍼 범위 안에 있는지는 읽는 쪽이 검사)
+namespace Gltf {
+    // 소유하지 않는 배열 (Arena 메모리)
+    template <typename T>
+    struct Span {
+        const T* data = nullptr;
+        uint32_t count = 0;
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        const T& operator[](size_t i) const { return data[i]; }
+        const T* begin() const { return data; }
+        const T* end() const { return data + count; }
+    };
+
+    // Arena에 복사한 NUL 종료 문자열 (이스케이프 해제됨)
+    struct String {
+        const char* data = "";
+        uint32_t length = 0;
+
+        const char* c_str() const { return data; }
+        bool empty() const { return length == 0; }
+        operator std::string_view() const { return { data, length }; }
+    };
+
+    // componentType 값은 glTF와 같음 (AccessorDecoder::ComponentType)
+    enum class AccessorType : uint8_t { Scalar, Vec2, Vec3, Vec4, Mat2, Mat3, Mat4 };
+    uint32_t getComponentCount(AccessorType type);
+
+    struct Buffer {
+        String uri; // 비어 있으면 GLB의 BIN 청크
+        uint64_t byteLength = 0;
+        bool fallback = false; // EXT_meshopt_compression의 데이터 없는 대체 버퍼 (압축된 bufferView만 참조)
+    };
+
+    struct BufferView {
+        int32_t buffer = -1;
+        uint64_t byteOffset = 0;
+        uint64_t byteLength = 0;
+        uint32_t byteStride = 0; // 0이면 원소가 촘촘히 패킹됨
+        // EXT_meshopt_compression: 압축된 데이터의 위치와 디코딩 방법
+        // File::open이 디코딩한 뒤 buffer/byteOffset은 디코딩 결과를 가리키도록 바뀜
+        struct {
+            bool compressed = false;
+            int32_t buffer = -1;
+            uint64_t byteOffset = 0;
+            uint64_t byteLength = 0;
+            uint32_t byteStride = 0;
+            uint64_t count = 0;
+            MeshoptCodec::Mode mode = MeshoptCodec::Mode::Attributes;
+            MeshoptCodec::Filter filter = MeshoptCodec::Filter::None;
+        } meshopt;
+    };
+
+    struct Accessor {
+        int32_t bufferView = -1; // -1이면 0으로 채운 값 (sparse만 있을 수 있음)
+        uint64_t byteOffset = 0;
+        int32_t componentType = 0;
+        bool normalized = false;
+        AccessorType type = AccessorType::Scalar;
+        uint64_t count = 0;
+        struct {
+            bool isSparse = false;
+            uint32_t count = 0;
+            struct {
+                int32_t bufferView = -1;
+                uint64_t byteOffset = 0;
+                int32_t componentType = 0;
+            } indices;
+            struct {
+                int32_t bufferView = -1;
+                uint64_t byteOffset = 0;
+            } values;
+        } sparse;
+    };
+    // 원소 간격 (byteStride가 없으면 원소 크기), 알 수 없는 componentType이면 0
+    size_t getByteStride(const Accessor& accessor, const BufferView& view);
+
+    // 렌더러가 읽는 속성만 (없으면 -1)
+    struct Attributes {
+        int32_t position = -1;
+        int32_t color0 = -1;
+        int32_t texcoord0 = -1;
+        int32_t joints0 = -1;
+        int32_t weights0 = -1;
+    };
+
+    struct Primitive {
+        Attributes attributes;
+        int32_t indices = -1;
+        int32_t material = -1;
+        Span<int32_t> targetPositions; // 모프 타깃별 POSITION 접근자 (-1 = 위치 델타 없음)
+    };
+
+    struct Mesh {
+        Span<Primitive> primitives;
+        Span<float> weights;
+    };
+
+    struct Node {
+        int32_t mesh = -1;
+        int32_t skin = -1;
+        Span<int32_t> children;
+        Span<float> weights;
+        bool hasMatrix = false;
+        float matrix[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 }; // column-major
+        float translation[3] = { 0.0f, 0.0f, 0.0f };
+        float rotation[4] = { 0.0f, 0.0f, 0.0f, 1.0f }; // x, y, z, w
+        float scale[3] = { 1.0f, 1.0f, 1.0f };
+    };
+
+    struct Scene {
+        Span<int32_t> nodes;
+    };
+
+    struct Skin {
+        String name;
+        int32_t inverseBindMatrices = -1;
+        Span<int32_t> joints;
+    };
+
+    enum class TargetPath : uint8_t { Translation, Rotation, Scale, Weights, Unsupported };
+    enum class Interpolation : uint8_t { Linear, Step, CubicSpline };
+
+    struct AnimationChannel {
+        int32_t sampler = -1;
+        int32_t targetNode = -1;
+        TargetPath targetPath = TargetPath::Unsupported;
+    };
+
+    struct AnimationSampler {
+        int32_t input = -1;
+        int32_t output = -1;
+        Interpolation interpolation = Interpolation::Linear;
+    };
+
+    struct Animation {
+        String name;
+        Span<AnimationChannel> channels;
+        Span<AnimationSampler> samplers;
+    };
+
+    struct Image {
+        String name;
+        String uri;
+        int32_t bufferView = -1;
+    };
+
+    struct Texture {
+        int32_t source = -1;
+    };
+
+    struct Material {
+        int32_t baseColorTexture = -1; // textures 인덱스
+        float baseColorFactor[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    };
+
+    struct Document {
+        int32_t defaultScene = -1;
+        Span<Scene> scenes;
+        Span<Node> nodes;
+        Span<Mesh> meshes;
+        Span<Accessor> accessors;
+        Span<BufferView> bufferViews;
+        Span<Buffer> buffers;
+        Span<Image> images;
+        Span<Texture> textures;
+        Span<Material> materials;
+        Span<Skin> skins;
+        Span<Animation> animations;
+        Span<String> extensionsRequired;
+    };
+
+    // JSON 텍스트 -> Document (배열/문자열은 arena에 할당). 실패 시 error에 위치와 이유
+    bool parse(AssetUtils::ByteSpan json, Arena& arena, Document& out, std::string& error);
+
+    // .gltf/.glb 파일과 리소스를 열어 Document와 버퍼/이미지 바이트 범위로 제공
+    // - .glb와 .gltf는 매핑 후 파싱하고, BIN 청크와 외부 .bin/이미지 파일도 매핑해 사본 없이 참조
+    // - data URI(base64)와 EXT_meshopt_compression bufferView만 arena에 디코딩
+    //   (디코딩한 bufferView는 문서 끝에 추가된 버퍼 하나를 가리키므로 읽는 쪽은 압축 여부를 몰라도 됨)
+    // 모든 범위는 File이 열려 있는 동안만 유효
+    class File {
+    public:
+        File() = default;
+        ~File() = default;
+
+        // 복사 방지
+        File(const File&) = delete;
+        File& operator=(const File&) = delete;
+
+        bool open(AAssetManager* assetManager, const std::string& filename);
+
+        const Document& getDocument() const { return mDocument; }
+        bool isBinary() const { return mBinary; }
+        // 버퍼 인덱스별 바이트 범위 (대체 버퍼를 제외하면 byteLength 이상임을 보장)
+        const std::vector<AssetUtils::ByteSpan>& getBuffers() const { return mBuffers; }
+        // 이미지의 인코딩된 바이트 (읽을 수 없으면 빈 범위)
+        AssetUtils::ByteSpan getImageBytes(size_t image) const;
+        // 문서와 data URI 디코딩에 쓴 arena 크기
+        size_t getArenaBytes() const { return mArena.getReservedBytes(); }
+
+    private:
+        Arena mArena;
+        Document mDocument;
+        bool mBinary = false;
+        std::vector<std::unique_ptr<AssetUtils::MappedAsset>> mMappings;
+        std::vector<AssetUtils::ByteSpan> mBuffers;
+        std::vector<AssetUtils::ByteSpan> mImages;
+
+        // uri(상대 경로 또는 data URI) -> 바이트 범위
+        bool resolveUri(AAssetManager* assetManager, const std::string& baseDir, const String& uri,
+                        AssetUtils::ByteSpan& out);
+        // 압축된 bufferView를 arena의 버퍼 하나에 디코딩하고 문서의 bufferView/버퍼 표를 갱신
+        bool decodeCompressedViews();
+    };
+}
@@ -0,0 +1,150 @@
+// 데스크톱 Linux용 헤드리스 실행 파일 진입점
+// CI의 소프트웨어 Vulkan 드라이버(lavapipe/SwiftShader)에서 프레임 처리량을 측정하기 위한 용도
+//
+// 사용법: mygame_headless [--assets DIR] [--model FILE] [--frames N] [--warmup N] [--size WxH] [--dump out.png]
+//                         [--compact-vertices] [--load-budget MB]
+// --model: 에셋 루트 기준 모델 경로 (.gltf/.glb 또는 tools/model_baker로 만든 .vkmodel)
+// --load-budget: 모델 로드 중 CPU 측 임시 메모리 한도 (MB, 묶음 단위 임포트/업로드). 최대 RSS를 함께 출력
+
+#include "Renderer.h"
+#include "Log.h"
+#include "asset_utils.h"
+#include "stb_image_write.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifndef MYGAME_ASSET_DIR
+#define MYGAME_ASSET_DIR "assets"
+#endif
+
+namespace {
+struct Options {
+    std::string assetDir = MYGAME_ASSET_DIR;
+    std::string modelPath;
+    uint32_t frames = 500;
+    uint32_t warmupFrames = 20;
+    uint32_t width = 1280;
+    uint32_t height = 720;
+    std::string dumpPath;
+    bool compactVertices = false;
+    size_t loadBudgetMb = 0;
+};
+
+void printUsage(const char* exe) {
+    fprintf(stderr,
+            "Usage: %s [--assets DIR] [--model FILE] [--frames N] [--warmup N] [--size WxH] [--dump out.png]"
+            " [--compact-vertices] [--load-budget MB]\n",
+            exe);
+}
+
+bool parseOptions(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(arg, "--assets") == 0 && hasValue) {
+            opt.assetDir = argv[++i];
+        } else if (strcmp(arg, "--model") == 0 && hasValue) {
+            opt.modelPath = argv[++i];
+        } else if (strcmp(arg, "--frames") == 0 && hasValue) {
+            opt.frames = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(arg, "--warmup") == 0 && hasValue) {
+            opt.warmupFrames = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        } else if (strcmp(arg, "--size") == 0 && hasValue) {
+            if (sscanf(argv[++i], "%ux%u", &opt.width, &opt.height) != 2) return false;
+        } else if (strcmp(arg, "--dump") == 0 && hasValue) {
+            opt.dumpPath = argv[++i];
+        } else if (strcmp(arg, "--compact-vertices") == 0) {
+            opt.compactVertices = true;
+        } else if (strcmp(arg, "--load-budget") == 0 && hasValue) {
+            opt.loadBudgetMb = static_cast<size_t>(strtoull(argv[++i], nullptr, 10));
+        } else {
+            return false;
+        }
+    }
+    return opt.width > 0 && opt.height > 0;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    AssetUtils::setHostAssetRoot(opt.assetDir);
+
+    // 0. 시작 시간: 초기화(모델 로드 포함)부터 첫 프레임이 GPU에서 끝날 때까지
+    auto startupBegin = std::chrono::steady_clock::now();
+    Renderer renderer(opt.width, opt.height,
+                      opt.compactVertices ? VertexFormat::Compact : VertexFormat::Standard);
+    if (!opt.modelPath.empty()) renderer.setModelPath(opt.modelPath);
+    renderer.setLoadMemoryBudget(opt.loadBudgetMb * 1024 * 1024);
+    if (!renderer.initialize()) {
+        LOGE("Failed to initialize headless renderer");
+        return 1;
+    }
+    renderer.render();
+    renderer.waitIdle();
+    double startupMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startupBegin)
+            .count();
+    printf("startup: first frame after %.1f ms\n", startupMs);
+    LoadMemoryStats load = renderer.getLoadMemoryStats();
+    if (load.limitBytes > 0) {
+        printf("load memory: peak %.1f MB tracked (limit %.1f MB, %u waves), process peak RSS %.1f MB\n",
+               load.peakTrackedBytes / 1048576.0, load.limitBytes / 1048576.0, load.waves,
+               load.peakResidentBytes / 1048576.0);
+    } else {
+        printf("load memory: process peak RSS %.1f MB\n", load.peakResidentBytes / 1048576.0);
+    }
+
+    // 1. 워밍업 (파이프라인/드라이버 캐시 안정화)
+    for (uint32_t i = 0; i < opt.warmupFrames; i++) {
+        renderer.render();
+    }
+    renderer.waitIdle();
+
+    // 2. 측정 구간: GPU 완료까지 포함한 벽시계 시간
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < opt.frames; i++) {
+        renderer.render();
+    }
+    renderer.waitIdle();
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double msPerFrame = opt.frames > 0 ? (seconds * 1000.0) / opt.frames : 0.0;
+    double fps = seconds > 0.0 ? opt.frames / seconds : 0.0;
+    printf("headless: %ux%u %s frames=%u total=%.3fs frame=%.3fms fps=%.1f\n",
+           opt.width, opt.height, opt.compactVertices ? "compact" : "standard",
+           opt.frames, seconds, msPerFrame, fps);
+
+    CullingStats culling = renderer.getCullingStats();
+    printf("culling: clusters %u/%u visible, triangles %u/%u visible, draws %u, coarse LOD primitives %u\n",
+           culling.clustersVisible, culling.clustersTotal,
+           culling.trianglesVisible, culling.trianglesTotal, culling.drawCalls, culling.primitivesAtCoarseLod);
+
+    // 3. 결과 이미지 저장 (선택)
+    if (!opt.dumpPath.empty()) {
+        std::vector<uint8_t> pixels;
+        if (!renderer.readLastFrame(pixels)) {
+            LOGE("Failed to read back the last frame");
+            return 1;
+        }
+        VkExtent2D extent = renderer.getRenderExtent();
+        if (!stbi_write_png(opt.dumpPath.c_str(), static_cast<int>(extent.width),
+                            static_cast<int>(extent.height), 4, pixels.data(),
+                            static_cast<int>(extent.width * 4))) {
+            LOGE("Failed to write %s", opt.dumpPath.c_str());
+            return 1;
+        }
+        LOGI("Wrote last frame to %s", opt.dumpPath.c_str());
+    }
+
+    return 0;
+}
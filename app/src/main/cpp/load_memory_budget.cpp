@@ -0,0 +1,30 @@
+#include "load_memory_budget.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+void LoadMemoryBudget::acquire(size_t bytes) {
+    mUsed += bytes;
+    mPeak = std::max(mPeak, mUsed);
+}
+
+void LoadMemoryBudget::release(size_t bytes) {
+    mUsed -= std::min(bytes, mUsed);
+}
+
+size_t LoadMemoryBudget::readPeakResidentBytes() {
+    FILE* file = fopen("/proc/self/status", "r");
+    if (!file) return 0;
+    size_t peakKb = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        if (strncmp(line, "VmHWM:", 6) == 0) {
+            unsigned long long value = 0;
+            if (sscanf(line + 6, "%llu", &value) == 1) peakKb = static_cast<size_t>(value);
+            break;
+        }
+    }
+    fclose(file);
+    return peakKb * 1024;
+}
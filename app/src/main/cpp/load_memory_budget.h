@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+// 모델 로드 중 CPU 측 임시 메모리(문서, 디코딩된 이미지, 프리미티브 변환 결과, 업로드 전 사본)의 예산 추적
+// 호출자가 작업을 시작하기 전에 예상 크기로 fits를 확인하고 acquire, 결과를 업로드해 해제하면 release합니다.
+// 한도를 넘는 작업 하나는 막지 않고(더 나눌 수 없으므로) 기록만 하므로 최대 사용량이 한도를 넘을 수 있습니다.
+// 로드 스레드에서만 사용 (잠금 없음)
+class LoadMemoryBudget {
+public:
+    // limit: 바이트 단위 한도 (0이면 무제한, 사용량만 추적)
+    explicit LoadMemoryBudget(size_t limit = 0) : mLimit(limit) {}
+
+    // 현재 사용량에 bytes를 더해도 한도 이하인지
+    bool fits(size_t bytes) const { return mLimit == 0 || (mUsed <= mLimit && bytes <= mLimit - mUsed); }
+    void acquire(size_t bytes);
+    void release(size_t bytes);
+
+    size_t getLimit() const { return mLimit; }
+    size_t getUsed() const { return mUsed; }
+    size_t getPeak() const { return mPeak; }
+
+    // 프로세스의 최대 상주 메모리 (Linux/Android의 /proc/self/status VmHWM, 읽을 수 없으면 0)
+    static size_t readPeakResidentBytes();
+
+private:
+    size_t mLimit;
+    size_t mUsed = 0;
+    size_t mPeak = 0;
+};
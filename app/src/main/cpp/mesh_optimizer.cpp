@@ -0,0 +1,315 @@
+#include "mesh_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace MeshOptimizer {
+
+namespace {
+// Forsyth 정점 캐시 점수 상수
+constexpr uint32_t kScoreCacheSize = 32;
+constexpr float kCacheDecayPower = 1.5f;
+constexpr float kLastTriScore = 0.75f;
+constexpr float kValenceBoostScale = 2.0f;
+constexpr float kValenceBoostPower = 0.5f;
+
+float vertexScore(int cachePosition, uint32_t remainingTriangles) {
+    // 더 이상 참조하는 삼각형이 없는 정점은 선택 대상이 아님
+    if (remainingTriangles == 0) return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // 직전 삼각형의 정점: 바로 이어 붙이면 스트립처럼 되어 오히려 손해이므로 고정 점수
+            score = kLastTriScore;
+        } else {
+            float scaler = 1.0f / static_cast<float>(kScoreCacheSize - 3);
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, kCacheDecayPower);
+        }
+    }
+    // 남은 삼각형이 적은 정점을 우선 처리해 외톨이 삼각형이 남지 않도록 함
+    score += kValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -kValenceBoostPower);
+    return score;
+}
+
+// Vertex 바이트 단위 해시/비교 (Vertex는 float만으로 구성되어 패딩이 없음)
+struct VertexBytesHash {
+    size_t operator()(const Vertex& v) const {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&v);
+        uint64_t hash = 1469598103934665603ull; // FNV-1a
+        for (size_t i = 0; i < sizeof(Vertex); i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+};
+
+struct VertexBytesEqual {
+    bool operator()(const Vertex& a, const Vertex& b) const {
+        return memcmp(&a, &b, sizeof(Vertex)) == 0;
+    }
+};
+} // namespace
+
+CacheStats analyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize) {
+    CacheStats stats;
+    if (indices.empty() || vertexCount == 0) return stats;
+
+    // FIFO 캐시: 각 정점이 캐시에 들어간 시점(타임스탬프)으로 적중 여부 판단
+    std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+    std::vector<bool> referenced(vertexCount, false);
+    uint32_t timestamp = cacheSize + 1;
+
+    for (uint32_t index : indices) {
+        if (index >= vertexCount) continue;
+        referenced[index] = true;
+        if (timestamp - cacheTimestamps[index] > cacheSize) {
+            cacheTimestamps[index] = timestamp++;
+            stats.transformedVertices++;
+        }
+    }
+
+    size_t uniqueVertices = static_cast<size_t>(std::count(referenced.begin(), referenced.end(), true));
+    size_t triangleCount = indices.size() / 3;
+    stats.acmr = triangleCount ? static_cast<float>(stats.transformedVertices) / triangleCount : 0.0f;
+    stats.atvr = uniqueVertices ? static_cast<float>(stats.transformedVertices) / uniqueVertices : 0.0f;
+    return stats;
+}
+
+size_t weldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    if (vertices.empty()) return 0;
+
+    // 처음 등장한 정점을 대표로 남기고 원래 순서를 유지 (결정적)
+    std::unordered_map<Vertex, uint32_t, VertexBytesHash, VertexBytesEqual> unique;
+    unique.reserve(vertices.size());
+    std::vector<uint32_t> remap(vertices.size());
+    std::vector<Vertex> welded;
+    welded.reserve(vertices.size());
+
+    for (size_t i = 0; i < vertices.size(); i++) {
+        auto result = unique.emplace(vertices[i], static_cast<uint32_t>(welded.size()));
+        if (result.second) {
+            welded.push_back(vertices[i]);
+        }
+        remap[i] = result.first->second;
+    }
+
+    size_t removed = vertices.size() - welded.size();
+    if (removed == 0) return 0;
+
+    for (auto& index : indices) {
+        index = remap[index];
+    }
+    vertices.swap(welded);
+    return removed;
+}
+
+void optimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount) {
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || vertexCount == 0) return;
+
+    // 1. 정점 -> 삼각형 인접 리스트 (CSR)
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) remaining[indices[i]]++;
+
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; v++) adjacencyOffsets[v + 1] = adjacencyOffsets[v] + remaining[v];
+
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (size_t t = 0; t < triangleCount; t++) {
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = indices[t * 3 + k];
+            adjacency[fill[v]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    // 2. 초기 점수 (모든 정점이 캐시 밖)
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t v = 0; v < vertexCount; v++) vertexScores[v] = vertexScore(-1, remaining[v]);
+
+    auto triangleScore = [&](uint32_t t) {
+        return vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+    };
+
+    std::vector<bool> emitted(triangleCount, false);
+    uint32_t bestTriangle = 0;
+    float bestInitialScore = triangleScore(0);
+    for (uint32_t t = 1; t < triangleCount; t++) {
+        float score = triangleScore(t);
+        if (score > bestInitialScore) {
+            bestInitialScore = score;
+            bestTriangle = t;
+        }
+    }
+
+    // 3. 탐욕적 선택: 캐시에 있는 정점의 삼각형 중 점수가 가장 높은 것을 차례로 출력
+    std::vector<uint32_t> result;
+    result.reserve(triangleCount * 3);
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> newCache;
+    cache.reserve(kScoreCacheSize + 3);
+    newCache.reserve(kScoreCacheSize + 3);
+    size_t nextUnemitted = 0;
+    bool haveBest = true;
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; emittedCount++) {
+        if (!haveBest) {
+            // 캐시에 후보가 없으면 입력 순서상 다음 삼각형부터 다시 시작
+            while (emitted[nextUnemitted]) nextUnemitted++;
+            bestTriangle = static_cast<uint32_t>(nextUnemitted);
+        }
+
+        const uint32_t* tri = &indices[bestTriangle * 3];
+        result.insert(result.end(), tri, tri + 3);
+        emitted[bestTriangle] = true;
+
+        // 출력한 삼각형을 각 정점의 남은 인접 리스트에서 제거
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = tri[k];
+            uint32_t* begin = adjacency.data() + adjacencyOffsets[v];
+            uint32_t* end = begin + remaining[v];
+            uint32_t* it = std::find(begin, end, bestTriangle);
+            if (it != end) {
+                std::swap(*it, *(end - 1));
+                remaining[v]--;
+            }
+        }
+
+        // LRU 캐시 갱신: 방금 사용한 정점이 맨 앞
+        newCache.assign(tri, tri + 3);
+        for (uint32_t v : cache) {
+            if (v != tri[0] && v != tri[1] && v != tri[2]) newCache.push_back(v);
+        }
+        for (size_t i = kScoreCacheSize; i < newCache.size(); i++) {
+            vertexScores[newCache[i]] = vertexScore(-1, remaining[newCache[i]]);
+        }
+        if (newCache.size() > kScoreCacheSize) newCache.resize(kScoreCacheSize);
+        cache.swap(newCache);
+
+        for (size_t i = 0; i < cache.size(); i++) {
+            vertexScores[cache[i]] = vertexScore(static_cast<int>(i), remaining[cache[i]]);
+        }
+
+        // 캐시 정점에 인접한 남은 삼각형만 점수를 다시 계산하고 최고점 선택
+        haveBest = false;
+        float bestScore = -1.0f;
+        for (uint32_t v : cache) {
+            const uint32_t* begin = adjacency.data() + adjacencyOffsets[v];
+            for (uint32_t i = 0; i < remaining[v]; i++) {
+                uint32_t t = begin[i];
+                float score = triangleScore(t);
+                if (score > bestScore) {
+                    bestScore = score;
+                    bestTriangle = t;
+                    haveBest = true;
+                }
+            }
+        }
+    }
+
+    indices.swap(result);
+}
+
+void optimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, uint32_t cacheSize) {
+    size_t triangleCount = indices.size() / 3;
+    if (triangleCount < 2) return;
+
+    // 1. 캐시 시뮬레이션에서 세 정점이 모두 미스나는 지점(하드 경계)으로 클러스터 분할
+    //    경계 사이의 순서는 유지하므로 클러스터를 재배치해도 캐시 효율 손실이 작음
+    std::vector<uint32_t> clusterStarts;
+    std::vector<uint32_t> cacheTimestamps(vertices.size(), 0);
+    uint32_t timestamp = cacheSize + 1;
+    for (size_t t = 0; t < triangleCount; t++) {
+        uint32_t misses = 0;
+        for (int k = 0; k < 3; k++) {
+            uint32_t v = indices[t * 3 + k];
+            if (timestamp - cacheTimestamps[v] > cacheSize) {
+                cacheTimestamps[v] = timestamp++;
+                misses++;
+            }
+        }
+        if (t == 0 || misses == 3) clusterStarts.push_back(static_cast<uint32_t>(t));
+    }
+    if (clusterStarts.size() < 2) return;
+    clusterStarts.push_back(static_cast<uint32_t>(triangleCount));
+
+    // 2. 메시 중심
+    glm::vec3 meshCentroid(0.0f);
+    for (uint32_t index : indices) meshCentroid += vertices[index].pos;
+    meshCentroid /= static_cast<float>(indices.size());
+
+    // 3. 클러스터별 정렬 키: (클러스터 중심 - 메시 중심) · 평균 법선
+    //    바깥을 향한 클러스터일수록 다른 면을 가릴 가능성이 높으므로 먼저 그림
+    size_t clusterCount = clusterStarts.size() - 1;
+    std::vector<float> sortKeys(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++) {
+        glm::vec3 centroid(0.0f);
+        glm::vec3 normal(0.0f);
+        float area = 0.0f;
+        for (uint32_t t = clusterStarts[c]; t < clusterStarts[c + 1]; t++) {
+            const glm::vec3& p0 = vertices[indices[t * 3]].pos;
+            const glm::vec3& p1 = vertices[indices[t * 3 + 1]].pos;
+            const glm::vec3& p2 = vertices[indices[t * 3 + 2]].pos;
+            glm::vec3 n = glm::cross(p1 - p0, p2 - p0); // 길이 = 면적 * 2
+            float triangleArea = glm::length(n);
+            centroid += (p0 + p1 + p2) * (triangleArea / 3.0f);
+            normal += n;
+            area += triangleArea;
+        }
+        float normalLength = glm::length(normal);
+        if (area > 0.0f && normalLength > 0.0f) {
+            centroid /= area;
+            sortKeys[c] = glm::dot(centroid - meshCentroid, normal / normalLength);
+        } else {
+            sortKeys[c] = 0.0f;
+        }
+    }
+
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; c++) order[c] = static_cast<uint32_t>(c);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+    for (uint32_t c : order) {
+        result.insert(result.end(), indices.begin() + clusterStarts[c] * 3, indices.begin() + clusterStarts[c + 1] * 3);
+    }
+    indices.swap(result);
+}
+
+void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    constexpr uint32_t kUnused = ~0u;
+    std::vector<uint32_t> remap(vertices.size(), kUnused);
+    std::vector<Vertex> reordered;
+    reordered.reserve(vertices.size());
+
+    for (auto& index : indices) {
+        if (remap[index] == kUnused) {
+            remap[index] = static_cast<uint32_t>(reordered.size());
+            reordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+    vertices.swap(reordered);
+}
+
+void optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    if (vertices.empty()) return;
+    if (indices.empty()) {
+        indices.resize(vertices.size());
+        for (uint32_t i = 0; i < static_cast<uint32_t>(vertices.size()); i++) indices[i] = i;
+    }
+
+    weldVertices(vertices, indices);
+    optimizeVertexCache(indices, vertices.size());
+    optimizeOverdraw(indices, vertices);
+    optimizeVertexFetch(vertices, indices);
+}
+
+} // namespace MeshOptimizer
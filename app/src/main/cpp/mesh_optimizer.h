@@ -0,0 +1,39 @@
+#pragma once
+
+#include "vulkan_types.h"
+
+#include <cstdint>
+#include <vector>
+
+// 임포트 시 메시 최적화 (외부 의존성 없이 결정적으로 동작하므로 로드 시점/오프라인 모두 사용 가능)
+// 권장 순서: weldVertices -> optimizeVertexCache -> optimizeOverdraw -> optimizeVertexFetch
+namespace MeshOptimizer {
+    // 정점 캐시 분석 결과
+    // ACMR: 삼각형당 정점 셰이더 실행 수 (낮을수록 좋음, 이론적 최소 ~0.5)
+    // ATVR: 고유 정점당 정점 셰이더 실행 수 (1.0이 최적)
+    struct CacheStats {
+        uint32_t transformedVertices = 0;
+        float acmr = 0.0f;
+        float atvr = 0.0f;
+    };
+
+    // FIFO 정점 캐시(cacheSize)를 시뮬레이션하여 ACMR/ATVR 계산
+    CacheStats analyzeVertexCache(const std::vector<uint32_t>& indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+    // 완전히 같은 정점(바이트 단위 비교)을 하나로 합치고 인덱스를 재작성. 제거된 정점 수 반환
+    size_t weldVertices(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // 정점 캐시 재사용을 높이도록 삼각형 순서를 재배치 (Forsyth 방식)
+    void optimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount);
+
+    // 캐시 최적화된 순서를 클러스터 단위로 나눈 뒤, 바깥을 향한 클러스터가 먼저 그려지도록 정렬 (오버드로 감소)
+    // optimizeVertexCache 이후에 호출해야 캐시 효율을 크게 잃지 않음
+    void optimizeOverdraw(std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices,
+                          uint32_t cacheSize = 16);
+
+    // 정점을 인덱스에서 처음 참조되는 순서로 재배치 (정점 페치 지역성), 참조되지 않는 정점은 제거
+    void optimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+
+    // 위 단계를 권장 순서로 모두 수행. 인덱스가 없으면 순차 인덱스를 생성한 뒤 최적화
+    void optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices);
+}
@@ -0,0 +1,265 @@
+#include "mesh_simplifier.h"
+#include "mesh_optimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <tuple>
+#include <unordered_map>
+
+namespace MeshSimplifier {
+
+namespace {
+// 대칭 4x4 행렬(평면 거리 제곱의 합)을 10개 값으로 저장
+struct Quadric {
+    float a2 = 0, ab = 0, ac = 0, ad = 0;
+    float b2 = 0, bc = 0, bd = 0;
+    float c2 = 0, cd = 0;
+    float d2 = 0;
+    float weight = 0;
+
+    void addPlane(const glm::vec3& n, float d, float w) {
+        a2 += w * n.x * n.x; ab += w * n.x * n.y; ac += w * n.x * n.z; ad += w * n.x * d;
+        b2 += w * n.y * n.y; bc += w * n.y * n.z; bd += w * n.y * d;
+        c2 += w * n.z * n.z; cd += w * n.z * d;
+        d2 += w * d * d;
+        weight += w;
+    }
+
+    void add(const Quadric& q) {
+        a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad;
+        b2 += q.b2; bc += q.bc; bd += q.bd;
+        c2 += q.c2; cd += q.cd;
+        d2 += q.d2;
+        weight += q.weight;
+    }
+
+    // 점 p에서 평면 거리 제곱의 가중 평균
+    float evaluate(const glm::vec3& p) const {
+        float x = p.x, y = p.y, z = p.z;
+        float sum = a2 * x * x + 2 * ab * x * y + 2 * ac * x * z + 2 * ad * x
+                  + b2 * y * y + 2 * bc * y * z + 2 * bd * y
+                  + c2 * z * z + 2 * cd * z
+                  + d2;
+        return weight > 0.0f ? std::fabs(sum) / weight : 0.0f;
+    }
+};
+
+struct Collapse {
+    uint32_t from;
+    uint32_t to;
+    float cost; // 거리 제곱
+};
+
+struct PositionHash {
+    size_t operator()(const glm::vec3& p) const {
+        uint32_t bits[3];
+        memcpy(bits, &p, sizeof(bits));
+        return static_cast<size_t>((bits[0] * 73856093u) ^ (bits[1] * 19349663u) ^ (bits[2] * 83492791u));
+    }
+};
+
+struct PositionEqual {
+    bool operator()(const glm::vec3& a, const glm::vec3& b) const {
+        return memcmp(&a, &b, sizeof(glm::vec3)) == 0;
+    }
+};
+
+// 경계 엣지(삼각형 하나에만 속함)의 끝점과 이음새 정점을 고정
+std::vector<bool> findLockedVertices(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+    std::vector<bool> locked(vertices.size(), false);
+
+    std::unordered_map<uint64_t, int> edgeCounts;
+    edgeCounts.reserve(indices.size());
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        for (int k = 0; k < 3; k++) {
+            uint32_t a = indices[i + k];
+            uint32_t b = indices[i + (k + 1) % 3];
+            uint64_t key = (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+            edgeCounts[key]++;
+        }
+    }
+    for (const auto& edge : edgeCounts) {
+        if (edge.second == 1) {
+            locked[static_cast<uint32_t>(edge.first >> 32)] = true;
+            locked[static_cast<uint32_t>(edge.first & 0xFFFFFFFFu)] = true;
+        }
+    }
+
+    std::unordered_map<glm::vec3, uint32_t, PositionHash, PositionEqual> firstAtPosition;
+    firstAtPosition.reserve(vertices.size());
+    for (uint32_t v = 0; v < vertices.size(); v++) {
+        auto result = firstAtPosition.emplace(vertices[v].pos, v);
+        if (!result.second) {
+            locked[v] = true;
+            locked[result.first->second] = true;
+        }
+    }
+    return locked;
+}
+
+// u를 v로 옮겼을 때 u에 인접한 삼각형이 뒤집히거나 퇴화하면 true
+bool collapseFlipsTriangle(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                           const std::vector<uint32_t>& adjacencyOffsets, const std::vector<uint32_t>& adjacency,
+                           uint32_t u, uint32_t v) {
+    const glm::vec3& target = vertices[v].pos;
+    for (uint32_t a = adjacencyOffsets[u]; a < adjacencyOffsets[u + 1]; a++) {
+        const uint32_t* tri = &indices[adjacency[a] * 3];
+        if (tri[0] == v || tri[1] == v || tri[2] == v) continue; // 붕괴로 사라질 삼각형
+
+        glm::vec3 p[3];
+        glm::vec3 q[3];
+        for (int k = 0; k < 3; k++) {
+            p[k] = vertices[tri[k]].pos;
+            q[k] = (tri[k] == u) ? target : p[k];
+        }
+        glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+        glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+        if (glm::dot(before, after) <= 0.0f) return true;
+    }
+    return false;
+}
+} // namespace
+
+float simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+               size_t targetIndexCount, float targetError, std::vector<uint32_t>& outIndices) {
+    outIndices = indices;
+    size_t vertexCount = vertices.size();
+    if (outIndices.size() <= targetIndexCount || vertexCount == 0) return 0.0f;
+
+    // 1. 정점별 quadric: 인접 삼각형 평면(면적 가중)의 합
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t i = 0; i + 2 < outIndices.size(); i += 3) {
+        const glm::vec3& p0 = vertices[outIndices[i]].pos;
+        const glm::vec3& p1 = vertices[outIndices[i + 1]].pos;
+        const glm::vec3& p2 = vertices[outIndices[i + 2]].pos;
+        glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+        float doubleArea = glm::length(n);
+        if (doubleArea <= 0.0f) continue;
+        n /= doubleArea;
+        float d = -glm::dot(n, p0);
+        for (int k = 0; k < 3; k++) quadrics[outIndices[i + k]].addPlane(n, d, doubleArea * 0.5f);
+    }
+
+    std::vector<bool> locked = findLockedVertices(vertices, outIndices);
+    float errorLimit = targetError * targetError;
+    float maxCost = 0.0f;
+
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> remap(vertexCount);
+    std::vector<bool> touched(vertexCount);
+
+    // 2. 패스 반복: 비용 순으로 서로 겹치지 않는 붕괴를 한꺼번에 적용
+    while (outIndices.size() > targetIndexCount) {
+        size_t triangleCount = outIndices.size() / 3;
+
+        std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+        for (uint32_t index : outIndices) adjacencyOffsets[index + 1]++;
+        for (size_t v = 0; v < vertexCount; v++) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+        adjacency.resize(outIndices.size());
+        std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t t = 0; t < triangleCount; t++) {
+            for (int k = 0; k < 3; k++) adjacency[fill[outIndices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+        }
+
+        // 2.1 후보: 각 엣지에서 비용이 낮은(고정되지 않은) 방향 하나
+        collapses.clear();
+        for (size_t t = 0; t < triangleCount; t++) {
+            for (int k = 0; k < 3; k++) {
+                uint32_t a = outIndices[t * 3 + k];
+                uint32_t b = outIndices[t * 3 + (k + 1) % 3];
+                if (a > b) continue; // 내부 엣지는 양쪽 삼각형에서 한 번씩 나오므로 한 방향만 처리
+                Quadric q = quadrics[a];
+                q.add(quadrics[b]);
+                float costAB = locked[a] ? INFINITY : q.evaluate(vertices[b].pos);
+                float costBA = locked[b] ? INFINITY : q.evaluate(vertices[a].pos);
+                if (costAB == INFINITY && costBA == INFINITY) continue;
+                if (costAB <= costBA) collapses.push_back({ a, b, costAB });
+                else collapses.push_back({ b, a, costBA });
+            }
+        }
+        if (collapses.empty()) break;
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& x, const Collapse& y) {
+            return std::tie(x.cost, x.from, x.to) < std::tie(y.cost, y.from, y.to);
+        });
+
+        // 2.2 적용: 붕괴로 모양이 바뀌는 영역(u의 1-ring)은 이번 패스에서 다시 건드리지 않음
+        for (uint32_t v = 0; v < vertexCount; v++) remap[v] = v;
+        std::fill(touched.begin(), touched.end(), false);
+        size_t removedTriangles = 0;
+        size_t trianglesToRemove = triangleCount - targetIndexCount / 3;
+        size_t applied = 0;
+
+        for (const Collapse& c : collapses) {
+            if (c.cost > errorLimit || removedTriangles >= trianglesToRemove) break;
+            if (touched[c.from] || touched[c.to]) continue;
+            if (collapseFlipsTriangle(vertices, outIndices, adjacencyOffsets, adjacency, c.from, c.to)) continue;
+
+            remap[c.from] = c.to;
+            quadrics[c.to].add(quadrics[c.from]);
+            maxCost = std::max(maxCost, c.cost);
+            applied++;
+
+            for (uint32_t a = adjacencyOffsets[c.from]; a < adjacencyOffsets[c.from + 1]; a++) {
+                const uint32_t* tri = &outIndices[adjacency[a] * 3];
+                if (tri[0] == c.to || tri[1] == c.to || tri[2] == c.to) removedTriangles++;
+                for (int k = 0; k < 3; k++) touched[tri[k]] = true;
+            }
+        }
+        if (applied == 0) break;
+
+        // 2.3 인덱스 재작성 후 퇴화 삼각형 제거
+        size_t write = 0;
+        for (size_t t = 0; t < triangleCount; t++) {
+            uint32_t a = remap[outIndices[t * 3]];
+            uint32_t b = remap[outIndices[t * 3 + 1]];
+            uint32_t c = remap[outIndices[t * 3 + 2]];
+            if (a == b || b == c || a == c) continue;
+            outIndices[write++] = a;
+            outIndices[write++] = b;
+            outIndices[write++] = c;
+        }
+        outIndices.resize(write);
+    }
+
+    return std::sqrt(maxCost);
+}
+
+std::vector<LodLevel> buildLodChain(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                    uint32_t maxLevels, float reduction, uint32_t minTriangles) {
+    std::vector<LodLevel> levels;
+    if (indices.size() / 3 < static_cast<size_t>(minTriangles) * 2 || vertices.empty()) return levels;
+
+    // 오차 상한은 메시 크기에 비례해 넉넉하게 두고, 실제 선택은 화면 공간 오차로 결정
+    glm::vec3 minPos = vertices[indices[0]].pos;
+    glm::vec3 maxPos = minPos;
+    for (uint32_t index : indices) {
+        minPos = glm::min(minPos, vertices[index].pos);
+        maxPos = glm::max(maxPos, vertices[index].pos);
+    }
+    float maxError = glm::length(maxPos - minPos) * 0.1f;
+
+    size_t previousCount = indices.size();
+    float previousError = 0.0f;
+    for (uint32_t level = 1; level <= maxLevels; level++) {
+        size_t target = static_cast<size_t>(static_cast<float>(indices.size()) * std::pow(reduction, level)) / 3 * 3;
+        if (target < static_cast<size_t>(minTriangles) * 3) break;
+
+        LodLevel lod;
+        float error = simplify(vertices, indices, target, maxError, lod.indices);
+        // 단순화가 거의 진행되지 않으면 더 만들어도 의미 없음
+        if (lod.indices.empty() || lod.indices.size() > previousCount * 9 / 10) break;
+
+        MeshOptimizer::optimizeVertexCache(lod.indices, vertices.size());
+        lod.error = std::max(error, previousError);
+        previousCount = lod.indices.size();
+        previousError = lod.error;
+        levels.push_back(std::move(lod));
+    }
+    return levels;
+}
+
+} // namespace MeshSimplifier
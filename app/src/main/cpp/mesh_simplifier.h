@@ -0,0 +1,27 @@
+#pragma once
+
+#include "vulkan_types.h"
+
+#include <cstdint>
+#include <vector>
+
+// 오차 한계가 있는 엣지 붕괴(Quadric Error Metric) 기반 메시 단순화
+// 정점을 이웃 정점 위치로 붕괴시키기만 하므로 새 정점이 생기지 않고, 모든 LOD가 원본 정점 버퍼를 공유합니다.
+// 경계 정점과 UV/색상 이음새(같은 위치의 서로 다른 정점)는 고정하여 구멍과 텍스처 깨짐을 막습니다.
+namespace MeshSimplifier {
+    struct LodLevel {
+        std::vector<uint32_t> indices;
+        float error = 0.0f; // 원본 대비 최대 기하 오차 (모델 공간 거리)
+    };
+
+    // targetIndexCount 이하가 되거나 오차가 targetError(모델 공간 거리)를 넘기 전까지 단순화
+    // 결과 인덱스를 outIndices에 쓰고, 발생한 최대 오차를 반환
+    float simplify(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                   size_t targetIndexCount, float targetError, std::vector<uint32_t>& outIndices);
+
+    // LOD0(indices)부터 삼각형 수를 단계마다 reduction 비율로 줄인 LOD 체인 생성 (LOD0 제외)
+    // 단순화가 더 진행되지 않거나 minTriangles에 도달하면 중단
+    std::vector<LodLevel> buildLodChain(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                        uint32_t maxLevels = 4, float reduction = 0.5f,
+                                        uint32_t minTriangles = 64);
+}
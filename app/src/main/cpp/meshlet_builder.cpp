@@ -0,0 +1,168 @@
+#include "meshlet_builder.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace MeshletBuilder {
+
+namespace {
+constexpr uint32_t kNoMeshlet = ~0u;
+
+void computeBounds(const std::vector<Vertex>& vertices, const uint32_t* indices, uint32_t indexCount,
+                   Meshlet& meshlet) {
+    // 1. 바운딩 구: AABB 중심 + 최대 거리
+    glm::vec3 minPos = vertices[indices[0]].pos;
+    glm::vec3 maxPos = minPos;
+    for (uint32_t i = 1; i < indexCount; i++) {
+        minPos = glm::min(minPos, vertices[indices[i]].pos);
+        maxPos = glm::max(maxPos, vertices[indices[i]].pos);
+    }
+    meshlet.center = (minPos + maxPos) * 0.5f;
+    float radius = 0.0f;
+    for (uint32_t i = 0; i < indexCount; i++) {
+        radius = std::max(radius, glm::length(vertices[indices[i]].pos - meshlet.center));
+    }
+    meshlet.radius = radius;
+
+    // 2. 법선 콘: 평균 법선을 축으로, 축과 가장 크게 벌어진 법선으로 반각 결정
+    std::vector<glm::vec3> normals;
+    normals.reserve(indexCount / 3);
+    glm::vec3 axis(0.0f);
+    for (uint32_t i = 0; i + 2 < indexCount; i += 3) {
+        const glm::vec3& p0 = vertices[indices[i]].pos;
+        const glm::vec3& p1 = vertices[indices[i + 1]].pos;
+        const glm::vec3& p2 = vertices[indices[i + 2]].pos;
+        glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+        float length = glm::length(n);
+        if (length <= 0.0f) continue; // 퇴화 삼각형은 보이지 않으므로 콘 계산에서 제외
+        n /= length;
+        normals.push_back(n);
+        axis += n;
+    }
+
+    meshlet.coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+    meshlet.coneCutoff = 1.0f;
+    float axisLength = glm::length(axis);
+    if (normals.empty() || axisLength <= 0.0f) return;
+
+    axis /= axisLength;
+    float minDot = 1.0f;
+    for (const auto& n : normals) minDot = std::min(minDot, glm::dot(axis, n));
+
+    meshlet.coneAxis = axis;
+    // 법선이 반구 이상 퍼져 있으면 어느 방향에서 봐도 앞면이 있으므로 컬링 불가
+    if (minDot > 0.0f) {
+        meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+    }
+}
+} // namespace
+
+Meshlet computeCluster(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                       uint32_t firstIndex, uint32_t indexCount) {
+    Meshlet meshlet;
+    meshlet.firstIndex = firstIndex;
+    meshlet.indexCount = indexCount;
+    if (indexCount == 0) return meshlet;
+
+    std::vector<uint32_t> unique(indices.begin() + firstIndex, indices.begin() + firstIndex + indexCount);
+    std::sort(unique.begin(), unique.end());
+    meshlet.vertexCount = static_cast<uint32_t>(std::unique(unique.begin(), unique.end()) - unique.begin());
+
+    computeBounds(vertices, &indices[firstIndex], indexCount, meshlet);
+    return meshlet;
+}
+
+std::vector<Meshlet> build(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+                           uint32_t maxVertices, uint32_t maxTriangles) {
+    std::vector<Meshlet> meshlets;
+    size_t triangleCount = indices.size() / 3;
+    size_t vertexCount = vertices.size();
+    if (triangleCount == 0 || maxVertices < 3 || maxTriangles == 0) return meshlets;
+
+    // 1. 정점 -> 삼각형 인접 리스트 (CSR)
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; i++) adjacencyOffsets[indices[i] + 1]++;
+    for (size_t v = 0; v < vertexCount; v++) adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (size_t t = 0; t < triangleCount; t++) {
+        for (int k = 0; k < 3; k++) {
+            adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+        }
+    }
+
+    // 2. 탐욕적 확장: 현재 메시렛과 정점을 공유하는 삼각형 중 새 정점이 가장 적게 늘어나는 것을 추가
+    std::vector<bool> used(triangleCount, false);
+    std::vector<uint32_t> vertexMeshlet(vertexCount, kNoMeshlet); // 정점이 마지막으로 포함된 메시렛
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    auto newVertexCount = [&](uint32_t t, uint32_t meshletId) {
+        uint32_t a = indices[t * 3], b = indices[t * 3 + 1], c = indices[t * 3 + 2];
+        uint32_t count = (vertexMeshlet[a] != meshletId) ? 1 : 0;
+        if (b != a && vertexMeshlet[b] != meshletId) count++;
+        if (c != a && c != b && vertexMeshlet[c] != meshletId) count++;
+        return count;
+    };
+
+    size_t nextSeed = 0;
+    size_t emittedTriangles = 0;
+    while (emittedTriangles < triangleCount) {
+        uint32_t meshletId = static_cast<uint32_t>(meshlets.size());
+        Meshlet meshlet;
+        meshlet.firstIndex = static_cast<uint32_t>(result.size());
+        uint32_t meshletTriangles = 0;
+        candidates.clear();
+
+        // 시드: 입력 순서상 첫 미사용 삼각형 (캐시 최적화된 순서라 공간적으로도 인접)
+        while (used[nextSeed]) nextSeed++;
+        uint32_t triangle = static_cast<uint32_t>(nextSeed);
+
+        while (true) {
+            uint32_t added = newVertexCount(triangle, meshletId);
+            if (meshlet.vertexCount + added > maxVertices || meshletTriangles + 1 > maxTriangles) break;
+
+            for (int k = 0; k < 3; k++) {
+                uint32_t v = indices[triangle * 3 + k];
+                vertexMeshlet[v] = meshletId;
+                result.push_back(v);
+                for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; a++) {
+                    if (!used[adjacency[a]] && adjacency[a] != triangle) candidates.push_back(adjacency[a]);
+                }
+            }
+            meshlet.vertexCount += added;
+            used[triangle] = true;
+            meshletTriangles++;
+            emittedTriangles++;
+
+            // 다음 후보 선택 (사용된 후보는 제거하며 순회, 동점이면 먼저 들어온 후보 → 결정적)
+            size_t write = 0;
+            uint32_t bestTriangle = 0;
+            uint32_t bestAdded = 4;
+            for (size_t i = 0; i < candidates.size(); i++) {
+                uint32_t t = candidates[i];
+                if (used[t]) continue;
+                candidates[write++] = t;
+                uint32_t count = newVertexCount(t, meshletId);
+                if (count < bestAdded) {
+                    bestAdded = count;
+                    bestTriangle = t;
+                }
+            }
+            candidates.resize(write);
+            // 인접 삼각형이 없으면 (분리된 조각) 메시렛을 닫아 공간적으로 촘촘하게 유지
+            if (bestAdded == 4) break;
+            triangle = bestTriangle;
+        }
+
+        meshlet.indexCount = meshletTriangles * 3;
+        computeBounds(vertices, &result[meshlet.firstIndex], meshlet.indexCount, meshlet);
+        meshlets.push_back(meshlet);
+    }
+
+    indices.swap(result);
+    return meshlets;
+}
+
+} // namespace MeshletBuilder
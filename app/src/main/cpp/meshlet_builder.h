@@ -0,0 +1,32 @@
+#pragma once
+
+#include "vulkan_types.h"
+
+#include <cstdint>
+#include <vector>
+
+// 메시렛(클러스터) 생성: 큰 프리미티브를 정점/삼각형 수가 제한된 작은 덩어리로 나누고
+// 클러스터마다 바운딩 구와 법선 콘을 계산해 CPU에서 프러스텀/백페이스 컬링에 사용합니다.
+// 메시렛은 인덱스 버퍼의 연속 구간이므로 일반 vkCmdDrawIndexed로 그릴 수 있습니다.
+namespace MeshletBuilder {
+    constexpr uint32_t kMaxVertices = 64;
+    constexpr uint32_t kMaxTriangles = 124;
+
+    struct Meshlet {
+        uint32_t firstIndex = 0;  // 프리미티브 인덱스 배열 내 시작 위치
+        uint32_t indexCount = 0;
+        uint32_t vertexCount = 0; // 참조하는 고유 정점 수
+        glm::vec3 center{};       // 바운딩 구
+        float radius = 0.0f;
+        glm::vec3 coneAxis{};     // 법선 콘 (평균 법선 방향)
+        float coneCutoff = 1.0f;  // sin(콘 반각), 1.0이면 백페이스 컬링 불가
+    };
+
+    // 인접 삼각형을 탐욕적으로 모아 메시렛을 만들고, 메시렛 순서대로 indices를 재배치
+    // indices[firstIndex, firstIndex + indexCount) 구간 전체를 하나의 클러스터로 보고 바운딩 구/법선 콘 계산
+    Meshlet computeCluster(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                           uint32_t firstIndex, uint32_t indexCount);
+
+    std::vector<Meshlet> build(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+                               uint32_t maxVertices = kMaxVertices, uint32_t maxTriangles = kMaxTriangles);
+}
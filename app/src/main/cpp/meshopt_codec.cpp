@@ -0,0 +1,519 @@
+#include "meshopt_codec.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MESHOPT_SIMD_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MESHOPT_SIMD_SSE2 1
+#endif
+
+namespace MeshoptCodec {
+namespace {
+constexpr uint8_t kVertexHeader = 0xa0;
+constexpr uint8_t kIndexHeader = 0xe0;
+constexpr uint8_t kSequenceHeader = 0xd0;
+
+constexpr size_t kVertexBlockSizeBytes = 8192; // 블록 하나의 전치 버퍼 크기
+constexpr size_t kVertexBlockMaxSize = 256;    // 블록당 최대 원소 수
+constexpr size_t kByteGroupSize = 16;          // 비트 폭을 공유하는 바이트 묶음
+constexpr size_t kTailMinSize = 32;            // 정점 스트림 끝의 첫 원소(기준값) + 패딩
+
+// 블록당 원소 수: 전치 버퍼에 들어가는 만큼을 16의 배수로 (최대 256)
+size_t getVertexBlockSize(size_t stride) {
+    size_t result = (kVertexBlockSizeBytes / stride) & ~(kByteGroupSize - 1);
+    return std::min(result, kVertexBlockMaxSize);
+}
+
+// 바이트 16개 묶음 하나: bits(2/4)비트 값을 상위 비트부터 읽고, 모든 비트가 1인 값은 뒤쪽 가변 영역의 바이트로 대체
+template <int Bits>
+const uint8_t* unpackGroup(const uint8_t* data, const uint8_t* end, uint8_t* out) {
+    constexpr size_t kPackedSize = kByteGroupSize * Bits / 8;
+    constexpr size_t kPerByte = 8 / Bits;
+    constexpr uint8_t kSentinel = (1 << Bits) - 1;
+    if (static_cast<size_t>(end - data) < kPackedSize) return nullptr;
+    const uint8_t* extra = data + kPackedSize;
+    if (static_cast<size_t>(end - extra) >= kByteGroupSize) {
+        // 대체 바이트는 최대 16개이므로 그만큼 남아 있으면 분기 없이 항상 읽고 커서만 조건부로 전진
+        for (size_t b = 0; b < kPackedSize; b++) {
+            uint8_t packed = data[b];
+            for (size_t j = 0; j < kPerByte; j++) {
+                uint8_t value = (packed >> (8 - Bits * (j + 1))) & kSentinel;
+                bool replaced = value == kSentinel;
+                out[b * kPerByte + j] = replaced ? *extra : value;
+                extra += replaced;
+            }
+        }
+        return extra;
+    }
+    for (size_t b = 0; b < kPackedSize; b++) {
+        uint8_t packed = data[b];
+        for (size_t j = 0; j < kPerByte; j++) {
+            uint8_t value = (packed >> (8 - Bits * (j + 1))) & kSentinel;
+            if (value == kSentinel) {
+                if (extra >= end) return nullptr;
+                value = *extra++;
+            }
+            out[b * kPerByte + j] = value;
+        }
+    }
+    return extra;
+}
+
+const uint8_t* decodeBytesGroup(const uint8_t* data, const uint8_t* end, uint8_t* out, int bitsLog2) {
+    switch (bitsLog2) {
+        case 0:
+            std::memset(out, 0, kByteGroupSize);
+            return data;
+        case 1:
+            return unpackGroup<2>(data, end, out);
+        case 2:
+            return unpackGroup<4>(data, end, out);
+        default:
+            if (static_cast<size_t>(end - data) < kByteGroupSize) return nullptr;
+            std::memcpy(out, data, kByteGroupSize);
+            return data + kByteGroupSize;
+    }
+}
+
+// 바이트 채널 하나(size는 16의 배수): 묶음마다 2비트 헤더로 비트 폭 지정
+const uint8_t* decodeBytes(const uint8_t* data, const uint8_t* end, uint8_t* out, size_t size) {
+    const uint8_t* header = data;
+    size_t headerSize = (size / kByteGroupSize + 3) / 4;
+    if (static_cast<size_t>(end - data) < headerSize) return nullptr;
+    data += headerSize;
+
+    for (size_t i = 0; i < size; i += kByteGroupSize) {
+        size_t group = i / kByteGroupSize;
+        int bitsLog2 = (header[group / 4] >> ((group % 4) * 2)) & 3;
+        data = decodeBytesGroup(data, end, out + i, bitsLog2);
+        if (!data) return nullptr;
+    }
+    return data;
+}
+
+// 4바이트를 한 번에: 바이트마다 zigzag 복원 (v >> 1) ^ -(v & 1)
+inline uint32_t unzigzag8x4(uint32_t v) {
+    return ((v >> 1) & 0x7f7f7f7fu) ^ ((v & 0x01010101u) * 0xffu);
+}
+
+// 4바이트를 한 번에: 바이트 사이 자리올림 없는 덧셈
+inline uint32_t add8x4(uint32_t a, uint32_t b) {
+    return ((a & 0x7f7f7f7fu) + (b & 0x7f7f7f7fu)) ^ ((a ^ b) & 0x80808080u);
+}
+
+#if defined(MESHOPT_SIMD_NEON) || defined(MESHOPT_SIMD_SSE2)
+// 원소 16개 x 채널 4개: 채널별 바이트 배열을 원소별 4바이트로 전치하고, zigzag 복원 후 원소 방향 누적합
+// (레지스터 하나 = 원소 4개, 누적합은 4/8바이트 시프트 덧셈 두 번 + 이전 원소 더하기)
+#if defined(MESHOPT_SIMD_NEON)
+using Byte16 = uint8x16_t;
+
+inline Byte16 unzigzag(Byte16 v) {
+    uint8x16_t sign = vreinterpretq_u8_s8(vnegq_s8(vreinterpretq_s8_u8(vandq_u8(v, vdupq_n_u8(1)))));
+    return veorq_u8(vshrq_n_u8(v, 1), sign);
+}
+
+inline Byte16 prefixSum(Byte16 v, Byte16 previous) {
+    uint8x16_t zero = vdupq_n_u8(0);
+    v = vaddq_u8(v, vextq_u8(zero, v, 12));
+    v = vaddq_u8(v, vextq_u8(zero, v, 8));
+    return vaddq_u8(v, previous);
+}
+
+inline Byte16 broadcastLast(Byte16 v) {
+    return vreinterpretq_u8_u32(vdupq_n_u32(vgetq_lane_u32(vreinterpretq_u32_u8(v), 3)));
+}
+
+inline void store4(uint8_t* dst, size_t stride, Byte16 v) {
+    uint32_t lanes[4];
+    vst1q_u32(lanes, vreinterpretq_u32_u8(v));
+    for (size_t j = 0; j < 4; j++) std::memcpy(dst + j * stride, &lanes[j], 4);
+}
+
+inline void transpose16(const uint8_t* const channels[4], size_t i, Byte16 out[4]) {
+    uint8x16x2_t t01 = vzipq_u8(vld1q_u8(channels[0] + i), vld1q_u8(channels[1] + i));
+    uint8x16x2_t t23 = vzipq_u8(vld1q_u8(channels[2] + i), vld1q_u8(channels[3] + i));
+    uint16x8x2_t lo = vzipq_u16(vreinterpretq_u16_u8(t01.val[0]), vreinterpretq_u16_u8(t23.val[0]));
+    uint16x8x2_t hi = vzipq_u16(vreinterpretq_u16_u8(t01.val[1]), vreinterpretq_u16_u8(t23.val[1]));
+    out[0] = vreinterpretq_u8_u16(lo.val[0]);
+    out[1] = vreinterpretq_u8_u16(lo.val[1]);
+    out[2] = vreinterpretq_u8_u16(hi.val[0]);
+    out[3] = vreinterpretq_u8_u16(hi.val[1]);
+}
+
+inline Byte16 splat4(uint32_t value) { return vreinterpretq_u8_u32(vdupq_n_u32(value)); }
+inline uint32_t lastLane(Byte16 v) { return vgetq_lane_u32(vreinterpretq_u32_u8(v), 3); }
+#else
+using Byte16 = __m128i;
+
+inline Byte16 unzigzag(Byte16 v) {
+    __m128i sign = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(v, _mm_set1_epi8(1)));
+    __m128i half = _mm_and_si128(_mm_srli_epi16(v, 1), _mm_set1_epi8(0x7f));
+    return _mm_xor_si128(half, sign);
+}
+
+inline Byte16 prefixSum(Byte16 v, Byte16 previous) {
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 4));
+    v = _mm_add_epi8(v, _mm_slli_si128(v, 8));
+    return _mm_add_epi8(v, previous);
+}
+
+inline Byte16 broadcastLast(Byte16 v) {
+    return _mm_shuffle_epi32(v, 0xff);
+}
+
+inline void store4(uint8_t* dst, size_t stride, Byte16 v) {
+    uint32_t lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+    for (size_t j = 0; j < 4; j++) std::memcpy(dst + j * stride, &lanes[j], 4);
+}
+
+inline void transpose16(const uint8_t* const channels[4], size_t i, Byte16 out[4]) {
+    __m128i c0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(channels[0] + i));
+    __m128i c1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(channels[1] + i));
+    __m128i c2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(channels[2] + i));
+    __m128i c3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(channels[3] + i));
+    __m128i t01lo = _mm_unpacklo_epi8(c0, c1);
+    __m128i t01hi = _mm_unpackhi_epi8(c0, c1);
+    __m128i t23lo = _mm_unpacklo_epi8(c2, c3);
+    __m128i t23hi = _mm_unpackhi_epi8(c2, c3);
+    out[0] = _mm_unpacklo_epi16(t01lo, t23lo);
+    out[1] = _mm_unpackhi_epi16(t01lo, t23lo);
+    out[2] = _mm_unpacklo_epi16(t01hi, t23hi);
+    out[3] = _mm_unpackhi_epi16(t01hi, t23hi);
+}
+
+inline Byte16 splat4(uint32_t value) { return _mm_set1_epi32(static_cast<int>(value)); }
+inline uint32_t lastLane(Byte16 v) { return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_shuffle_epi32(v, 0xff))); }
+#endif
+
+// 원소 16개를 처리하고 마지막 원소(4바이트)를 반환
+inline uint32_t decodeDeltas16(const uint8_t* const channels[4], size_t i, uint32_t previous, uint8_t* dst,
+                               size_t stride) {
+    Byte16 vertices[4];
+    transpose16(channels, i, vertices);
+    Byte16 last = splat4(previous);
+    for (size_t j = 0; j < 4; j++) {
+        Byte16 v = prefixSum(unzigzag(vertices[j]), last);
+        store4(dst + j * 4 * stride, stride, v);
+        last = broadcastLast(v);
+    }
+    return lastLane(last);
+}
+#endif
+
+// 원소 count개(<= 256) 블록: 바이트 채널마다 차이를 복원해 원소 배열로 전치. lastVertex는 이전 블록의 마지막 원소
+// stride가 4의 배수이므로 채널 4개씩 묶어 차이 누적과 전치를 처리 (SIMD는 원소 16개 단위, 나머지는 32비트 SWAR)
+const uint8_t* decodeVertexBlock(const uint8_t* data, const uint8_t* end, uint8_t* out, size_t count, size_t stride,
+                                 uint8_t* lastVertex) {
+    uint8_t deltas[4][kVertexBlockMaxSize];
+    const uint8_t* const channels[4] = { deltas[0], deltas[1], deltas[2], deltas[3] };
+    size_t alignedCount = (count + kByteGroupSize - 1) & ~(kByteGroupSize - 1);
+    for (size_t k = 0; k < stride; k += 4) {
+        for (size_t c = 0; c < 4; c++) {
+            data = decodeBytes(data, end, deltas[c], alignedCount);
+            if (!data) return nullptr;
+        }
+
+        uint32_t previous;
+        std::memcpy(&previous, lastVertex + k, 4);
+        size_t i = 0;
+#if defined(MESHOPT_SIMD_NEON) || defined(MESHOPT_SIMD_SSE2)
+        for (; i + 16 <= count; i += 16) {
+            previous = decodeDeltas16(channels, i, previous, out + i * stride + k, stride);
+        }
+#endif
+        for (; i < count; i++) {
+            uint32_t delta = static_cast<uint32_t>(deltas[0][i]) | static_cast<uint32_t>(deltas[1][i]) << 8 |
+                             static_cast<uint32_t>(deltas[2][i]) << 16 | static_cast<uint32_t>(deltas[3][i]) << 24;
+            previous = add8x4(previous, unzigzag8x4(delta));
+            std::memcpy(out + i * stride + k, &previous, 4);
+        }
+    }
+    std::memcpy(lastVertex, out + (count - 1) * stride, stride);
+    return data;
+}
+
+// 가변 길이 정수 (7비트씩, 최대 5바이트)
+uint32_t decodeVByte(const uint8_t*& data) {
+    uint8_t lead = *data++;
+    if (lead < 128) return lead;
+    uint32_t result = lead & 127;
+    uint32_t shift = 7;
+    for (int i = 0; i < 4; i++) {
+        uint8_t group = *data++;
+        result |= static_cast<uint32_t>(group & 127) << shift;
+        shift += 7;
+        if (group < 128) break;
+    }
+    return result;
+}
+
+// 직전 자유 인덱스에 대한 zigzag 차이
+uint32_t decodeIndex(const uint8_t*& data, uint32_t last) {
+    uint32_t v = decodeVByte(data);
+    uint32_t delta = (v >> 1) ^ (0u - (v & 1));
+    return last + delta;
+}
+
+inline void writeIndex(uint8_t* out, size_t i, size_t indexSize, uint32_t value) {
+    if (indexSize == 2) {
+        uint16_t narrow = static_cast<uint16_t>(value);
+        std::memcpy(out + i * 2, &narrow, 2);
+    } else {
+        std::memcpy(out + i * 4, &value, 4);
+    }
+}
+
+// 인덱스 코덱의 최근 간선/정점 FIFO (16개 순환)
+struct IndexFifos {
+    uint32_t edges[16][2];
+    uint32_t vertices[16];
+    size_t edgeOffset = 0;
+    size_t vertexOffset = 0;
+
+    IndexFifos() {
+        std::memset(edges, 0xff, sizeof(edges));
+        std::memset(vertices, 0xff, sizeof(vertices));
+    }
+
+    void pushEdge(uint32_t a, uint32_t b) {
+        edges[edgeOffset][0] = a;
+        edges[edgeOffset][1] = b;
+        edgeOffset = (edgeOffset + 1) & 15;
+    }
+
+    void pushVertex(uint32_t v, bool advance = true) {
+        vertices[vertexOffset] = v;
+        vertexOffset = (vertexOffset + (advance ? 1 : 0)) & 15;
+    }
+};
+
+inline int16_t roundToInt16(float value) {
+    return static_cast<int16_t>(static_cast<int>(value + (value >= 0.0f ? 0.5f : -0.5f)));
+}
+
+// OCTAHEDRAL: (x, y, 1.0 기준값, w) 정수 -> 단위 벡터 (x, y, z, w), T는 int8 또는 int16
+template <typename T>
+void decodeFilterOctahedral(uint8_t* data, size_t count) {
+    const float maxValue = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+    for (size_t i = 0; i < count; i++) {
+        T v[4];
+        std::memcpy(v, data + i * sizeof(v), sizeof(v));
+        float x = static_cast<float>(v[0]);
+        float y = static_cast<float>(v[1]);
+        float z = static_cast<float>(v[2]) - std::fabs(x) - std::fabs(y);
+        // 아래쪽 반구(z < 0)는 접힌 좌표를 펼침
+        float t = std::min(z, 0.0f);
+        x += x >= 0.0f ? t : -t;
+        y += y >= 0.0f ? t : -t;
+        float length = std::sqrt(x * x + y * y + z * z);
+        float scale = length > 0.0f ? maxValue / length : 0.0f; // 손상된 0 벡터는 0으로
+        v[0] = static_cast<T>(roundToInt16(x * scale));
+        v[1] = static_cast<T>(roundToInt16(y * scale));
+        v[2] = static_cast<T>(roundToInt16(z * scale));
+        std::memcpy(data + i * sizeof(v), v, sizeof(v));
+    }
+}
+
+// QUATERNION: 가장 큰 성분을 뺀 세 성분 + (스케일 | 빠진 성분 위치) -> 정규화된 int16 쿼터니언
+void decodeFilterQuaternion(uint8_t* data, size_t count) {
+    const float rsqrt2 = 1.0f / std::sqrt(2.0f);
+    for (size_t i = 0; i < count; i++) {
+        int16_t v[4];
+        std::memcpy(v, data + i * sizeof(v), sizeof(v));
+        float scale = rsqrt2 / static_cast<float>(v[3] | 3);
+        float x = static_cast<float>(v[0]) * scale;
+        float y = static_cast<float>(v[1]) * scale;
+        float z = static_cast<float>(v[2]) * scale;
+        float ww = 1.0f - x * x - y * y - z * z;
+        float w = std::sqrt(std::max(ww, 0.0f));
+        int missing = v[3] & 3;
+        int16_t result[4];
+        result[(missing + 1) & 3] = roundToInt16(x * 32767.0f);
+        result[(missing + 2) & 3] = roundToInt16(y * 32767.0f);
+        result[(missing + 3) & 3] = roundToInt16(z * 32767.0f);
+        result[missing] = roundToInt16(w * 32767.0f);
+        std::memcpy(data + i * sizeof(result), result, sizeof(result));
+    }
+}
+
+// EXPONENTIAL: 32비트마다 (8비트 지수, 24비트 가수) -> float
+void decodeFilterExponential(uint8_t* data, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t v;
+        std::memcpy(&v, data + i * 4, 4);
+        int32_t mantissa = static_cast<int32_t>(v << 8) >> 8;
+        int32_t exponent = static_cast<int32_t>(v) >> 24;
+        float value = std::ldexp(static_cast<float>(mantissa), exponent);
+        std::memcpy(data + i * 4, &value, 4);
+    }
+}
+} // namespace
+
+bool decodeVertexBuffer(uint8_t* out, size_t count, size_t stride, const uint8_t* data, size_t size) {
+    if (stride == 0 || stride > 256 || stride % 4 != 0) return false;
+    if (size < 1 + stride || (data[0] & 0xf0) != kVertexHeader || (data[0] & 0x0f) != 0) return false;
+
+    // 첫 블록의 기준값은 스트림 끝에 저장된 첫 원소
+    const uint8_t* end = data + size;
+    uint8_t lastVertex[256];
+    std::memcpy(lastVertex, end - stride, stride);
+
+    const uint8_t* cursor = data + 1;
+    size_t blockSize = getVertexBlockSize(stride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        size_t blockCount = std::min(blockSize, count - offset);
+        cursor = decodeVertexBlock(cursor, end, out + offset * stride, blockCount, stride, lastVertex);
+        if (!cursor) return false;
+    }
+    return static_cast<size_t>(end - cursor) == std::max(stride, kTailMinSize);
+}
+
+bool decodeIndexBuffer(uint8_t* out, size_t count, size_t indexSize, const uint8_t* data, size_t size) {
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4)) return false;
+    // 최소 크기: 헤더 + 삼각형당 코드 1바이트 + 끝의 16바이트 보조 코드 표
+    if (size < 1 + count / 3 + 16 || (data[0] & 0xf0) != kIndexHeader) return false;
+    int version = data[0] & 0x0f;
+    if (version > 1) return false;
+
+    IndexFifos fifo;
+    uint32_t next = 0; // 다음에 처음 등장할 정점
+    uint32_t last = 0; // 직전 자유 인덱스 (차이 부호화 기준)
+    const int freeCode = version >= 1 ? 13 : 15; // v1은 13/14를 last -1/+1로 사용
+
+    const uint8_t* code = data + 1;
+    const uint8_t* cursor = code + count / 3;
+    const uint8_t* safeEnd = data + size - 16;
+    const uint8_t* auxTable = safeEnd;
+
+    for (size_t i = 0; i < count; i += 3) {
+        // 삼각형 하나는 가변 영역에서 최대 16바이트를 읽으므로 보조 표 앞에서 시작하면 버퍼 안에서 끝남
+        if (cursor > safeEnd) return false;
+        uint8_t codeTri = *code++;
+
+        if (codeTri < 0xf0) {
+            // 1. FIFO의 간선 (a, b) + 새 정점/FIFO 정점/자유 인덱스 c
+            int fe = codeTri >> 4;
+            uint32_t a = fifo.edges[(fifo.edgeOffset - 1 - fe) & 15][0];
+            uint32_t b = fifo.edges[(fifo.edgeOffset - 1 - fe) & 15][1];
+            int fec = codeTri & 15;
+            uint32_t c;
+            bool advance = true;
+            if (fec < freeCode) {
+                c = fec == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - 1 - fec) & 15];
+                advance = fec == 0;
+            } else {
+                last = c = fec != 15 ? last + (fec - (fec ^ 3)) : decodeIndex(cursor, last);
+            }
+            writeIndex(out, i + 0, indexSize, a);
+            writeIndex(out, i + 1, indexSize, b);
+            writeIndex(out, i + 2, indexSize, c);
+            fifo.pushVertex(c, advance);
+            fifo.pushEdge(c, b);
+            fifo.pushEdge(a, c);
+        } else {
+            // 2. 간선 없이 세 정점을 모두 지정: 자주 쓰는 조합은 보조 표, 나머지는 가변 영역의 바이트
+            uint32_t a;
+            uint32_t b;
+            uint32_t c;
+            int feb;
+            int fec;
+            if (codeTri < 0xfe) {
+                uint8_t codeAux = auxTable[codeTri & 15];
+                feb = codeAux >> 4;
+                fec = codeAux & 15;
+                a = next++;
+                b = feb == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - feb) & 15];
+                c = fec == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - fec) & 15];
+            } else {
+                uint8_t codeAux = *cursor++;
+                int fea = codeTri == 0xfe ? 0 : 15;
+                feb = codeAux >> 4;
+                fec = codeAux & 15;
+                if (codeAux == 0) next = 0; // 재시작 표시
+                a = fea == 0 ? next++ : 0;
+                b = feb == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - feb) & 15];
+                c = fec == 0 ? next++ : fifo.vertices[(fifo.vertexOffset - fec) & 15];
+                if (fea == 15) last = a = decodeIndex(cursor, last);
+                if (feb == 15) last = b = decodeIndex(cursor, last);
+                if (fec == 15) last = c = decodeIndex(cursor, last);
+            }
+            writeIndex(out, i + 0, indexSize, a);
+            writeIndex(out, i + 1, indexSize, b);
+            writeIndex(out, i + 2, indexSize, c);
+            fifo.pushVertex(a);
+            fifo.pushVertex(b, feb == 0 || feb == 15);
+            fifo.pushVertex(c, fec == 0 || fec == 15);
+            fifo.pushEdge(b, a);
+            fifo.pushEdge(c, b);
+            fifo.pushEdge(a, c);
+        }
+    }
+    // 가변 영역을 정확히 보조 표 앞까지 읽어야 함
+    return cursor == safeEnd;
+}
+
+bool decodeIndexSequence(uint8_t* out, size_t count, size_t indexSize, const uint8_t* data, size_t size) {
+    if (indexSize != 2 && indexSize != 4) return false;
+    // 최소 크기: 헤더 + 인덱스당 1바이트 + 4바이트 꼬리
+    if (size < 1 + count + 4 || (data[0] & 0xf0) != kSequenceHeader || (data[0] & 0x0f) > 1) return false;
+
+    const uint8_t* cursor = data + 1;
+    const uint8_t* safeEnd = data + size - 4;
+    uint32_t last[2] = { 0, 0 };
+    for (size_t i = 0; i < count; i++) {
+        // 인덱스 하나는 최대 5바이트이므로 꼬리 앞에서 시작하면 버퍼 안에서 끝남
+        if (cursor >= safeEnd) return false;
+        uint32_t v = decodeVByte(cursor);
+        uint32_t baseline = v & 1; // 두 기준값 중 어느 쪽에 대한 차이인지
+        v >>= 1;
+        uint32_t index = last[baseline] + ((v >> 1) ^ (0u - (v & 1)));
+        last[baseline] = index;
+        writeIndex(out, i, indexSize, index);
+    }
+    return cursor == safeEnd;
+}
+
+bool applyFilter(uint8_t* data, size_t count, size_t stride, Filter filter) {
+    switch (filter) {
+        case Filter::None:
+            return true;
+        case Filter::Octahedral:
+            if (stride == 4) {
+                decodeFilterOctahedral<int8_t>(data, count);
+            } else if (stride == 8) {
+                decodeFilterOctahedral<int16_t>(data, count);
+            } else {
+                return false;
+            }
+            return true;
+        case Filter::Quaternion:
+            if (stride != 8) return false;
+            decodeFilterQuaternion(data, count);
+            return true;
+        case Filter::Exponential:
+            if (stride % 4 != 0) return false;
+            decodeFilterExponential(data, count * (stride / 4));
+            return true;
+    }
+    return false;
+}
+
+bool decode(uint8_t* out, size_t count, size_t stride, Mode mode, Filter filter, const uint8_t* data,
+            size_t size) {
+    switch (mode) {
+        case Mode::Attributes:
+            return decodeVertexBuffer(out, count, stride, data, size) && applyFilter(out, count, stride, filter);
+        case Mode::Triangles:
+            return filter == Filter::None && decodeIndexBuffer(out, count, stride, data, size);
+        case Mode::Indices:
+            return filter == Filter::None && decodeIndexSequence(out, count, stride, data, size);
+    }
+    return false;
+}
+} // namespace MeshoptCodec
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// EXT_meshopt_compression bufferView 디코더 (meshoptimizer 비트스트림 형식)
+// - ATTRIBUTES: 정점 코덱 v0. 원소를 바이트 단위로 전치해 이전 원소와의 차이(zigzag)를 2/4/8비트 그룹으로 패킹
+// - TRIANGLES : 인덱스 코덱 v0/v1. 간선/정점 FIFO 참조와 가변 길이 정수로 삼각형 목록을 복원
+// - INDICES   : 인덱스 시퀀스 코덱 v0/v1. 두 기준값에 대한 차이를 가변 길이 정수로 저장
+// 필터(OCTAHEDRAL/QUATERNION/EXPONENTIAL)는 ATTRIBUTES 디코딩 결과에 제자리로 적용합니다.
+// 모든 디코더는 입력 범위를 검사하므로 손상된 데이터에서도 범위를 벗어나 읽지 않고 false를 반환합니다.
+namespace MeshoptCodec {
+    enum class Mode : uint8_t { Attributes, Triangles, Indices };
+    enum class Filter : uint8_t { None, Octahedral, Quaternion, Exponential };
+
+    // count개 x stride 바이트 원소를 out(count * stride 바이트)에 디코딩 (stride는 4의 배수, 256 이하)
+    bool decodeVertexBuffer(uint8_t* out, size_t count, size_t stride, const uint8_t* data, size_t size);
+    // 삼각형 목록 인덱스 count개(3의 배수)를 indexSize(2 또는 4) 바이트 정수로 디코딩
+    bool decodeIndexBuffer(uint8_t* out, size_t count, size_t indexSize, const uint8_t* data, size_t size);
+    // 임의 순서 인덱스 count개를 indexSize(2 또는 4) 바이트 정수로 디코딩
+    bool decodeIndexSequence(uint8_t* out, size_t count, size_t indexSize, const uint8_t* data, size_t size);
+    // 디코딩된 원소 count개에 필터를 제자리로 적용. filter와 stride 조합이 잘못되었으면 false
+    bool applyFilter(uint8_t* data, size_t count, size_t stride, Filter filter);
+
+    // bufferView 하나: mode에 맞는 디코더 -> 필터 (필터는 ATTRIBUTES에서만 허용)
+    bool decode(uint8_t* out, size_t count, size_t stride, Mode mode, Filter filter, const uint8_t* data,
+                size_t size);
+}
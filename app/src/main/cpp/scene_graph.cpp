@@ -0,0 +1,121 @@
+#include "scene_graph.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <utility>
+
+std::vector<int32_t> SceneGraph::build(const std::vector<NodeDesc>& nodes, const std::vector<int32_t>& roots) {
+    clear();
+    std::vector<int32_t> remap(nodes.size(), -1);
+
+    // 1. 명시적 스택으로 깊이 우선 전위 순회 (깊은 계층에서도 재귀 깊이 문제 없음)
+    //    자식을 역순으로 넣어야 원래 자식 순서대로 방문
+    std::vector<std::pair<int32_t, int32_t>> stack; // (원본 인덱스, 평탄화된 부모 인덱스)
+    for (auto it = roots.rbegin(); it != roots.rend(); ++it) stack.emplace_back(*it, -1);
+
+    while (!stack.empty()) {
+        auto [source, parent] = stack.back();
+        stack.pop_back();
+
+        if (source < 0 || static_cast<size_t>(source) >= nodes.size()) {
+            LOGW("Scene node index %d out of range, ignoring", source);
+            continue;
+        }
+        if (remap[source] >= 0) {
+            LOGW("Scene node %d referenced more than once, ignoring", source);
+            continue;
+        }
+
+        const NodeDesc& desc = nodes[source];
+        int32_t index = static_cast<int32_t>(mParents.size());
+        remap[source] = index;
+        mParents.push_back(parent);
+        mMeshes.push_back(desc.mesh);
+        mLocalMatrices.push_back(desc.localMatrix);
+        if (desc.mesh >= 0) mMeshNodes.push_back(static_cast<uint32_t>(index));
+
+        for (auto child = desc.children.rbegin(); child != desc.children.rend(); ++child) {
+            stack.emplace_back(*child, index);
+        }
+    }
+
+    // 2. 서브트리 크기: 자식이 항상 뒤에 있으므로 역순으로 한 번 누적하면 됨
+    size_t count = mParents.size();
+    mSubtreeSizes.assign(count, 1);
+    for (size_t i = count; i-- > 0;) {
+        if (mParents[i] >= 0) mSubtreeSizes[mParents[i]] += mSubtreeSizes[i];
+    }
+
+    // 3. 초기 월드 행렬 (부모가 앞에 있으므로 한 번의 순차 패스)
+    mWorldMatrices.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        mWorldMatrices[i] = mParents[i] < 0 ? mLocalMatrices[i] : mWorldMatrices[mParents[i]] * mLocalMatrices[i];
+    }
+    mDirty.assign(count, 0);
+
+    return remap;
+}
+
+void SceneGraph::clear() {
+    mParents.clear();
+    mSubtreeSizes.clear();
+    mMeshes.clear();
+    mLocalMatrices.clear();
+    mWorldMatrices.clear();
+    mDirty.clear();
+    mDirtyNodes.clear();
+    mMeshNodes.clear();
+}
+
+glm::mat4 SceneGraph::composeTransform(const glm::vec3& translation, const glm::quat& rotation,
+                                       const glm::vec3& scale) {
+    // T * R * S (glTF 규약)
+    glm::mat4 m = glm::mat4_cast(rotation);
+    m[0] *= scale.x;
+    m[1] *= scale.y;
+    m[2] *= scale.z;
+    m[3] = glm::vec4(translation, 1.0f);
+    return m;
+}
+
+void SceneGraph::setLocalMatrix(uint32_t node, const glm::mat4& localMatrix) {
+    mLocalMatrices[node] = localMatrix;
+    markDirty(node);
+}
+
+void SceneGraph::setLocalTransform(uint32_t node, const glm::vec3& translation, const glm::quat& rotation,
+                                   const glm::vec3& scale) {
+    setLocalMatrix(node, composeTransform(translation, rotation, scale));
+}
+
+void SceneGraph::markDirty(uint32_t node) {
+    if (mDirty[node]) return;
+    mDirty[node] = 1;
+    mDirtyNodes.push_back(node);
+}
+
+uint32_t SceneGraph::update() {
+    if (mDirtyNodes.empty()) return 0;
+
+    // 오름차순 = 전위 순서이므로 조상이 자손보다 먼저 처리됨.
+    // 이미 다시 계산한 서브트리 구간 안의 dirty 노드는 건너뛰고, 각 구간은 부모 -> 자식 순으로 연속 순회
+    std::sort(mDirtyNodes.begin(), mDirtyNodes.end());
+
+    uint32_t updated = 0;
+    uint32_t coveredEnd = 0;
+    for (uint32_t root : mDirtyNodes) {
+        mDirty[root] = 0;
+        if (root < coveredEnd) continue;
+
+        uint32_t end = root + mSubtreeSizes[root];
+        for (uint32_t i = root; i < end; i++) {
+            int32_t parent = mParents[i];
+            mWorldMatrices[i] = parent < 0 ? mLocalMatrices[i] : mWorldMatrices[parent] * mLocalMatrices[i];
+            mDirty[i] = 0;
+        }
+        updated += end - root;
+        coveredEnd = end;
+    }
+    mDirtyNodes.clear();
+    return updated;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// glTF 노드 계층을 평탄화해 담는 씬 그래프
+// - 노드는 깊이 우선 전위 순서로 저장되므로 부모가 항상 자식보다 앞에 있고,
+//   한 노드의 서브트리는 [node, node + subtreeSize) 연속 구간을 차지함
+// - 로컬/월드 행렬, 부모 인덱스, 메시 인덱스를 각각 별도 배열(SoA)로 보관
+// - 로컬 변환을 바꾸면 해당 노드만 dirty로 표시하고, update()에서 바뀐 서브트리 구간만 순차적으로 다시 계산
+//   (비용은 바뀐 노드 수에 비례하고, 접근은 연속 메모리 순회)
+class SceneGraph {
+public:
+    // 빌드 입력 (glTF 노드 순서 그대로)
+    struct NodeDesc {
+        glm::mat4 localMatrix{1.0f};
+        int32_t mesh = -1;
+        std::vector<int32_t> children;
+    };
+
+    SceneGraph() = default;
+    ~SceneGraph() = default;
+
+    // 복사 방지
+    SceneGraph(const SceneGraph&) = delete;
+    SceneGraph& operator=(const SceneGraph&) = delete;
+
+    // roots에서 시작해 도달 가능한 노드만 평탄화하여 저장하고 월드 행렬까지 계산
+    // 잘못된 인덱스나 중복 참조(순환)는 LOGW 후 무시. 반환값은 원본 노드 인덱스 -> 평탄화 인덱스 (-1 = 미사용)
+    std::vector<int32_t> build(const std::vector<NodeDesc>& nodes, const std::vector<int32_t>& roots);
+    void clear();
+
+    // 로컬 변환 변경 (dirty 표시만 하고 월드 행렬은 update()에서 갱신)
+    void setLocalMatrix(uint32_t node, const glm::mat4& localMatrix);
+    void setLocalTransform(uint32_t node, const glm::vec3& translation, const glm::quat& rotation,
+                           const glm::vec3& scale);
+
+    // dirty 노드의 서브트리만 월드 행렬을 다시 계산. 다시 계산한 노드 수 반환
+    uint32_t update();
+
+    uint32_t getNodeCount() const { return static_cast<uint32_t>(mParents.size()); }
+    int32_t getParent(uint32_t node) const { return mParents[node]; }
+    int32_t getMesh(uint32_t node) const { return mMeshes[node]; }
+    uint32_t getSubtreeSize(uint32_t node) const { return mSubtreeSizes[node]; }
+    const glm::mat4& getLocalMatrix(uint32_t node) const { return mLocalMatrices[node]; }
+    const glm::mat4& getWorldMatrix(uint32_t node) const { return mWorldMatrices[node]; }
+    // 메시를 가진 노드 목록 (평탄화 순서)
+    const std::vector<uint32_t>& getMeshNodes() const { return mMeshNodes; }
+    bool hasPendingChanges() const { return !mDirtyNodes.empty(); }
+
+    static glm::mat4 composeTransform(const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale);
+
+private:
+    std::vector<int32_t> mParents;       // -1이면 루트
+    std::vector<uint32_t> mSubtreeSizes; // 자기 자신 포함
+    std::vector<int32_t> mMeshes;        // -1이면 메시 없음
+    std::vector<glm::mat4> mLocalMatrices;
+    std::vector<glm::mat4> mWorldMatrices;
+    std::vector<uint8_t> mDirty;
+    std::vector<uint32_t> mDirtyNodes;   // dirty로 표시된 노드 (중복 없음)
+    std::vector<uint32_t> mMeshNodes;
+
+    void markDirty(uint32_t node);
+};
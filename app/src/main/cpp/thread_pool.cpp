@@ -0,0 +1,72 @@
+#include "thread_pool.h"
+
+ThreadPool::ThreadPool(uint32_t workerCount) {
+    mWorkers.reserve(workerCount);
+    for (uint32_t i = 0; i < workerCount; i++) {
+        mWorkers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWake.notify_all();
+    for (auto& worker : mWorkers) worker.join();
+}
+
+uint32_t ThreadPool::getDefaultWorkerCount() {
+    // hardware_concurrency는 알 수 없으면 0을 반환
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& job) {
+    if (count == 0) return;
+    // 작업이 하나뿐이거나 작업 스레드가 없으면 깨우는 비용 없이 바로 실행
+    if (count == 1 || mWorkers.empty()) {
+        for (size_t i = 0; i < count; i++) job(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJob = &job;
+        mCount = count;
+        mNext.store(0, std::memory_order_relaxed);
+        mActiveWorkers = static_cast<uint32_t>(mWorkers.size());
+        mGeneration++;
+    }
+    mWake.notify_all();
+    runJobs();
+
+    // 작업 스레드가 job을 더 이상 참조하지 않을 때까지 대기 (job은 호출자 스택에 있음)
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDone.wait(lock, [this]() { return mActiveWorkers == 0; });
+    mJob = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    uint64_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWake.wait(lock, [&]() { return mStop || mGeneration != seenGeneration; });
+            if (mStop) return;
+            seenGeneration = mGeneration;
+        }
+        runJobs();
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (--mActiveWorkers == 0) mDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runJobs() {
+    for (size_t i = mNext.fetch_add(1, std::memory_order_relaxed); i < mCount;
+         i = mNext.fetch_add(1, std::memory_order_relaxed)) {
+        (*mJob)(i);
+    }
+}
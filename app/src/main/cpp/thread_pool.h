@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 임포트용 고정 크기 작업 스레드 풀
+// parallelFor는 [0, count) 인덱스를 원자 카운터로 하나씩 나눠 주므로(동적 분배) 작업 크기가 고르지 않아도
+// 먼저 끝난 스레드가 남은 작업을 가져가고, 호출 스레드도 함께 작업한 뒤 모든 인덱스가 끝나면 반환합니다.
+// 결과는 인덱스별 슬롯에 쓰고 순서가 필요한 처리(GPU 업로드 등)는 반환 후 호출 스레드에서 하도록 설계합니다.
+class ThreadPool {
+public:
+    // workerCount: 호출 스레드를 제외한 작업 스레드 수 (0이면 호출 스레드에서 순서대로 실행)
+    explicit ThreadPool(uint32_t workerCount = getDefaultWorkerCount());
+    ~ThreadPool();
+
+    // 복사 방지
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // 호출 스레드를 포함한 동시 실행 스레드 수
+    uint32_t getThreadCount() const { return static_cast<uint32_t>(mWorkers.size()) + 1; }
+
+    // job(i)를 [0, count)의 각 i에 대해 한 번씩 호출하고 모두 끝나면 반환 (재진입 불가)
+    void parallelFor(size_t count, const std::function<void(size_t)>& job);
+
+    // 기본 작업 스레드 수 (하드웨어 스레드 수 - 1)
+    static uint32_t getDefaultWorkerCount();
+
+private:
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWake; // 새 작업 또는 종료
+    std::condition_variable mDone; // 작업 스레드가 모두 작업을 마침
+    const std::function<void(size_t)>* mJob = nullptr;
+    size_t mCount = 0;
+    std::atomic<size_t> mNext{0};
+    uint32_t mActiveWorkers = 0;
+    uint64_t mGeneration = 0; // parallelFor 호출마다 증가
+    bool mStop = false;
+
+    void workerLoop();
+    void runJobs();
+};
@@ -0,0 +1,68 @@
+// 오프라인 모델 베이커 (호스트 전용)
+// glTF(.gltf/.glb)를 VulkanModel::loadFromFile과 같은 CPU 단계로 변환해 런타임이 매핑 후 바로 업로드하는
+// 베이크 파일(.vkmodel, baked_model.h 형식)로 저장합니다. GPU/Vulkan 드라이버는 필요 없습니다.
+// 정점 포맷은 렌더러 설정과 같아야 하며(다르면 로드 시 거부), 스킨/모프 타깃 모델은 아직 지원하지 않습니다.
+//
+// 사용법: model_baker [--assets DIR] [--compact-vertices] [--threads N] input.gltf output.vkmodel
+//         input은 에셋 루트 기준 경로, output은 파일 시스템 경로
+
+#include "VulkanModel.h"
+#include "Log.h"
+#include "asset_utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef MYGAME_ASSET_DIR
+#define MYGAME_ASSET_DIR "assets"
+#endif
+
+int main(int argc, char** argv) {
+    std::string assetDir = MYGAME_ASSET_DIR;
+    bool compactVertices = false;
+    int32_t workerCount = -1;
+    std::string input;
+    std::string output;
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc);
+        if (strcmp(argv[i], "--assets") == 0 && hasValue) {
+            assetDir = argv[++i];
+        } else if (strcmp(argv[i], "--compact-vertices") == 0) {
+            compactVertices = true;
+        } else if (strcmp(argv[i], "--threads") == 0 && hasValue) {
+            workerCount = std::max(1, atoi(argv[++i])) - 1;
+        } else if (argv[i][0] != '-' && input.empty()) {
+            input = argv[i];
+        } else if (argv[i][0] != '-' && output.empty()) {
+            output = argv[i];
+        } else {
+            input.clear();
+            break;
+        }
+    }
+    if (input.empty() || output.empty()) {
+        fprintf(stderr, "Usage: %s [--assets DIR] [--compact-vertices] [--threads N] input.gltf output.vkmodel\n",
+                argv[0]);
+        return 2;
+    }
+
+    AssetUtils::setHostAssetRoot(assetDir);
+
+    // GPU 자원을 만들지 않으므로 컨텍스트 없이 공유 지오메트리 모드로 생성
+    VulkanModel model(nullptr, true, compactVertices ? VertexFormat::Compact : VertexFormat::Standard);
+    if (workerCount >= 0) model.setImportWorkerCount(static_cast<uint32_t>(workerCount));
+
+    auto start = std::chrono::steady_clock::now();
+    if (!model.bakeToFile(nullptr, input, output)) {
+        LOGE("Failed to bake %s", input.c_str());
+        return 1;
+    }
+    auto end = std::chrono::steady_clock::now();
+    printf("baked %s -> %s (%s vertices) in %.1f ms\n", input.c_str(), output.c_str(),
+           compactVertices ? "compact" : "standard", std::chrono::duration<double, std::milli>(end - start).count());
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include "vertex_quantization.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace VertexQuantization {
+
+uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFFu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (((bits >> 23) & 0xFFu) == 0xFFu) {
+        // Inf / NaN
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    }
+    if (exponent >= 31) {
+        // half 범위 초과 -> Inf
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (exponent <= 0) {
+        // 비정규화 수 (너무 작으면 0)
+        if (exponent < -10) return static_cast<uint16_t>(sign);
+        mantissa |= 0x800000u;
+        uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        // 최근접 짝수 반올림
+        uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (half & 1u))) half++;
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    // 최근접 짝수 반올림 (반올림 올림이 지수로 넘어가도 올바른 값이 됨)
+    uint32_t remainder = mantissa & 0x1FFFu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) half++;
+    return static_cast<uint16_t>(half);
+}
+
+float halfToFloat(uint16_t value) {
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+    uint32_t exponent = (value >> 10) & 0x1Fu;
+    uint32_t mantissa = value & 0x3FFu;
+
+    uint32_t bits;
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        } else {
+            // 비정규화 수 정규화
+            exponent = 127 - 15 + 1;
+            while ((mantissa & 0x400u) == 0) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            mantissa &= 0x3FFu;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+static uint16_t quantizeUnorm16(float value) {
+    float clamped = std::min(std::max(value, 0.0f), 1.0f);
+    return static_cast<uint16_t>(std::lround(clamped * 65535.0f));
+}
+
+static uint8_t quantizeUnorm8(float value) {
+    float clamped = std::min(std::max(value, 0.0f), 1.0f);
+    return static_cast<uint8_t>(std::lround(clamped * 255.0f));
+}
+
+VertexDequantization quantize(const std::vector<Vertex>& vertices, std::vector<CompactVertex>& outVertices,
+                              float positionStep) {
+    VertexDequantization dequant{ glm::vec4(1.0f), glm::vec4(0.0f) };
+    outVertices.resize(vertices.size());
+    if (vertices.empty()) return dequant;
+
+    // 1. 메시 AABB 계산
+    glm::vec3 minPos = vertices[0].pos;
+    glm::vec3 maxPos = vertices[0].pos;
+    for (const auto& v : vertices) {
+        minPos = glm::min(minPos, v.pos);
+        maxPos = glm::max(maxPos, v.pos);
+    }
+    glm::vec3 extent = maxPos - minPos;
+
+    // 2. 축별 [min, max] -> [0, 1] 정규화 후 unorm16 (평평한 축은 scale 0으로 두고 0 기록)
+    //    정수 위치는 min이 격자 위에 있으므로 scale = 간격 * 65535로 잡으면 (p - min) / 간격이 그대로 저장됨
+    glm::vec3 scale = extent;
+    glm::vec3 invScale;
+    for (int axis = 0; axis < 3; axis++) {
+        if (positionStep > 0.0f && extent[axis] / positionStep <= 65535.5f) scale[axis] = positionStep * 65535.0f;
+        invScale[axis] = scale[axis] > 0.0f ? 1.0f / scale[axis] : 0.0f;
+    }
+
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const Vertex& src = vertices[i];
+        CompactVertex& dst = outVertices[i];
+        glm::vec3 normalized = (src.pos - minPos) * invScale;
+        dst.pos[0] = quantizeUnorm16(normalized.x);
+        dst.pos[1] = quantizeUnorm16(normalized.y);
+        dst.pos[2] = quantizeUnorm16(normalized.z);
+        dst.pos[3] = 0;
+        dst.texCoord[0] = floatToHalf(src.texCoord.x);
+        dst.texCoord[1] = floatToHalf(src.texCoord.y);
+        dst.color[0] = quantizeUnorm8(src.color.r);
+        dst.color[1] = quantizeUnorm8(src.color.g);
+        dst.color[2] = quantizeUnorm8(src.color.b);
+        dst.color[3] = 255;
+    }
+
+    dequant.scale = glm::vec4(scale, 0.0f);
+    dequant.offset = glm::vec4(minPos, 1.0f);
+    return dequant;
+}
+
+} // namespace VertexQuantization
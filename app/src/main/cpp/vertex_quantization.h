@@ -0,0 +1,18 @@
+#pragma once
+
+#include "vulkan_types.h"
+
+#include <cstdint>
+#include <vector>
+
+// 정점 양자화 유틸리티 (Vertex -> CompactVertex)
+namespace VertexQuantization {
+    uint16_t floatToHalf(float value);
+    float halfToFloat(uint16_t value);
+
+    // vertices의 AABB로 위치를 unorm16 양자화하고, 셰이더에서 복원할 scale/offset을 반환
+    // positionStep: 위치가 놓인 격자 간격 (KHR_mesh_quantization 정수 위치, float이면 0)
+    //               축 범위가 65535칸 이내면 격자 한 칸을 unorm16 한 칸으로 써서 원본 정수 값을 그대로 보존
+    VertexDequantization quantize(const std::vector<Vertex>& vertices, std::vector<CompactVertex>& outVertices,
+                                  float positionStep = 0.0f);
+}
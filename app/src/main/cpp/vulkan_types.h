@@ -2,9 +2,19 @@
 
 #include "volk.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <glm/glm.hpp>
 
+// 정점 레이아웃 선택
+// Standard: 32바이트 float 정점 (Vertex)
+// Compact : 16바이트 양자화 정점 (CompactVertex), 정점 페치 대역폭 절감용
+enum class VertexFormat {
+    Standard,
+    Compact
+};
+
 struct UniformBufferObject {
     glm::mat4 mvp;
 };
@@ -45,3 +55,108 @@ struct Vertex {
         return attributeDescriptions;
     }
 };
+
+// 컴팩트 정점의 위치 복원 정보 (push constant, 메시/프리미티브마다 다름)
+// 셰이더에서 position = offset + unorm16 * scale
+struct VertexDequantization {
+    glm::vec4 scale;
+    glm::vec4 offset;
+};
+
+// draw마다 push하는 상수 (정점 셰이더)
+// - model  : 노드 월드 행렬 (씬 그래프), 모든 포맷에서 사용
+// - dequant: Compact 포맷에서만 사용 (Standard 파이프라인의 push constant 범위는 model까지만)
+struct DrawPushConstants {
+    glm::mat4 model;
+    VertexDequantization dequant;
+};
+
+// 스킨 정점 속성 (컴퓨트 스키닝 입력, 스킨 메시의 Vertex와 같은 순서)
+// - joints : 조인트 인덱스 4개 (uint16 두 개씩 묶음)
+// - weights: 가중치 4개 (unorm16 두 개씩 묶음, 합이 1이 되도록 정규화)
+struct SkinVertex {
+    uint32_t joints[2];
+    uint32_t weights[2];
+};
+static_assert(sizeof(SkinVertex) == 16, "SkinVertex must match uvec4 in skin.comp");
+
+// 스키닝 디스패치마다 push하는 상수 (컴퓨트 셰이더)
+struct SkinPushConstants {
+    uint32_t sourceVertex; // 원본/스킨 정점 시작 위치
+    uint32_t outputVertex; // 출력 정점 시작 위치
+    uint32_t vertexCount;
+    uint32_t firstJoint;   // 조인트 팔레트 시작 위치
+};
+
+// 모프 타깃이 움직이는 정점 하나 (메시마다 델타가 0이 아닌 정점만 저장, morph.comp의 MorphVertex와 같은 std430 레이아웃)
+// - base  : 바인드 포즈 위치 (결과 = base + sum(weight * delta))
+// - vertex: 변형 지오메트리 정점 버퍼에서의 위치
+// 델타는 메시마다 타깃 순서(target-major)로 모프 정점 수만큼 xyz float 3개씩 연속 저장
+struct MorphVertex {
+    float base[3];
+    uint32_t vertex;
+};
+static_assert(sizeof(MorphVertex) == 16, "MorphVertex must match morph.comp");
+
+// 모프 정점 하나를 움직이는 타깃 델타 (업로드 전 CPU 사본, 업로드 시 메시마다 target-major로 펼침)
+struct MorphDelta {
+    float delta[3];
+    uint32_t target; // 메시 가중치 구간 안의 타깃 인덱스
+};
+
+// 이번 프레임에 가중치가 0이 아닌 타깃 하나 (프레임마다 CPU가 압축해 기록, morph.comp의 MorphTarget)
+struct MorphTarget {
+    uint32_t firstDelta; // 이 타깃의 델타 구간 시작 (xyz 단위, 메시의 모프 정점 순서)
+    float weight;
+};
+static_assert(sizeof(MorphTarget) == 8, "MorphTarget must match morph.comp");
+
+// 모프 디스패치마다 push하는 상수 (메시 하나 = 디스패치 하나)
+struct MorphPushConstants {
+    uint32_t firstMorphVertex; // MorphVertex 시작 위치
+    uint32_t morphVertexCount;
+    uint32_t firstTarget;      // 활성 타깃 버퍼 시작 위치
+    uint32_t targetCount;      // 활성 타깃 수 (0이면 바인드 포즈로 복원)
+};
+
+// 16바이트 양자화 정점
+// - pos     : 메시 AABB 기준 unorm16 (w는 패딩)
+// - texCoord: half float (타일링 UV처럼 [0,1] 범위를 벗어나는 값도 표현 가능)
+// - color   : RGBA8 unorm
+struct CompactVertex {
+    uint16_t pos[4];
+    uint16_t texCoord[2];
+    uint8_t color[4];
+
+    static VkVertexInputBindingDescription getBindingDescription() {
+        VkVertexInputBindingDescription bindingDescription{};
+        bindingDescription.binding = 0;
+        bindingDescription.stride = sizeof(CompactVertex);
+        bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        return bindingDescription;
+    }
+
+    static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions() {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions(3);
+        // Position (location = 0)
+        attributeDescriptions[0].binding = 0;
+        attributeDescriptions[0].location = 0;
+        attributeDescriptions[0].format = VK_FORMAT_R16G16B16A16_UNORM;
+        attributeDescriptions[0].offset = offsetof(CompactVertex, pos);
+
+        // Color (location = 1)
+        attributeDescriptions[1].binding = 0;
+        attributeDescriptions[1].location = 1;
+        attributeDescriptions[1].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributeDescriptions[1].offset = offsetof(CompactVertex, color);
+
+        // Texture Coordinate (location = 2)
+        attributeDescriptions[2].binding = 0;
+        attributeDescriptions[2].location = 2;
+        attributeDescriptions[2].format = VK_FORMAT_R16G16_SFLOAT;
+        attributeDescriptions[2].offset = offsetof(CompactVertex, texCoord);
+
+        return attributeDescriptions;
+    }
+};
+static_assert(sizeof(CompactVertex) == 16, "CompactVertex must stay 16 bytes");
@@ -1,4 +1,10 @@
 glslc shader.vert -o vert.spv
+glslc shader_compact.vert -o vert_compact.spv
 glslc shader.frag -o frag.spv
+glslc skin.comp -o skin.spv
+glslc morph.comp -o morph.spv
 cp vert.spv ../assets/shaders/
-cp frag.spv ../assets/shaders/
\ No newline at end of file
+cp vert_compact.spv ../assets/shaders/
+cp frag.spv ../assets/shaders/
+cp skin.spv ../assets/shaders/
+cp morph.spv ../assets/shaders/
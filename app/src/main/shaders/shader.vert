@@ -4,6 +4,11 @@ layout(binding = 0) uniform UniformBufferObject {
     mat4 mvp;
 } ubo;
 
+// 노드 월드 행렬 (씬 그래프, draw마다 push)
+layout(push_constant) uniform DrawConstants {
+    mat4 model;
+} draw;
+
 layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inColor;
 layout(location = 2) in vec2 inTexCoord;
@@ -12,7 +17,7 @@ layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec2 fragTexCoord;
 
 void main() {
-    gl_Position = ubo.mvp * vec4(inPosition, 1.0);
+    gl_Position = ubo.mvp * draw.model * vec4(inPosition, 1.0);
     fragColor = inColor;
     fragTexCoord = inTexCoord;
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+#version 450
+
+// CompactVertex(16바이트) 입력용 정점 셰이더
+// 위치는 unorm16으로 들어오므로 push constant의 scale/offset으로 메시 로컬 좌표를 복원한 뒤 노드 월드 행렬 적용
+
+layout(binding = 0) uniform UniformBufferObject {
+    mat4 mvp;
+} ubo;
+
+// DrawPushConstants와 같은 레이아웃 (노드 월드 행렬 + 위치 복원 정보)
+layout(push_constant) uniform DrawConstants {
+    mat4 model;
+    vec4 scale;
+    vec4 offset;
+} draw;
+
+layout(location = 0) in vec4 inPosition; // R16G16B16A16_UNORM
+layout(location = 1) in vec4 inColor;    // R8G8B8A8_UNORM
+layout(location = 2) in vec2 inTexCoord; // R16G16_SFLOAT
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec2 fragTexCoord;
+
+void main() {
+    vec3 position = draw.offset.xyz + inPosition.xyz * draw.scale.xyz;
+    gl_Position = ubo.mvp * draw.model * vec4(position, 1.0);
+    fragColor = inColor.rgb;
+    fragTexCoord = inTexCoord;
+}